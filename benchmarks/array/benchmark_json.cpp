@@ -0,0 +1,26 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <benchmark/benchmark.h>
+
+#include <dynd/array.hpp>
+#include <dynd/json_formatter.hpp>
+
+using namespace std;
+using namespace dynd;
+
+template <typename T>
+static void BM_JSON_FormatFloat(benchmark::State &state) {
+  nd::array a = nd::empty(state.range_x(), ndt::make_type<T>());
+  for (int i = 0; i < state.range_x(); ++i) {
+    a(i).vals() = static_cast<T>((i * 7919 % 100003) / 997.0 - 50.0);
+  }
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(format_json(a));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range_x());
+}
+BENCHMARK_TEMPLATE(BM_JSON_FormatFloat, float)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_JSON_FormatFloat, double)->Range(1 << 10, 1 << 16);
@@ -35,5 +35,17 @@ namespace nd {
 
   extern DYND_API callable sum;
 
+  /**
+   * Sums integers exactly into a 128-bit accumulator, int128 for the signed
+   * types and uint128 for the unsigned ones.
+   */
+  extern DYND_API callable wide_sum;
+
+  /**
+   * Reduces integers to ``{sum: int128, count: int64, mean: float64}``, with
+   * the sum exact and the mean rounded once from it.
+   */
+  extern DYND_API callable wide_mean;
+
 } // namespace dynd::nd
 } // namespace dynd
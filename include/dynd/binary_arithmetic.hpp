@@ -4,6 +4,7 @@
 //
 
 #include <dynd/arithmetic.hpp>
+#include <dynd/callables/float16_binary_callable.hpp>
 #include <dynd/callables/multidispatch_callable.hpp>
 #include <dynd/functional.hpp>
 #include <dynd/kernels/arithmetic.hpp>
@@ -24,6 +25,64 @@ inline std::vector<ndt::type> func_ptr(const ndt::type &DYND_UNUSED(dst_tp), siz
   return {src_tp[0], src_tp[1]};
 }
 
+// (float16, float16) is computed in float32 by a float16_binary_callable when
+// the operation is defined for float32, so it is left out of make_all_if
+template <template <typename, typename> class Condition>
+struct _exclude_float16 {
+  template <typename Arg0Type, typename Arg1Type>
+  using type = std::integral_constant<bool, Condition<Arg0Type, Arg1Type>::value &&
+                                                !(Condition<float, float>::value &&
+                                                  std::is_same<Arg0Type, float16>::value &&
+                                                  std::is_same<Arg1Type, float16>::value)>;
+};
+
+template <typename CallableType>
+struct builtin_binary_function;
+
+// The function behind an apply_function_callable, on a pair of scalars
+template <typename FuncType, FuncType Func, typename ReturnType, typename ArgSequence, typename KwdSequence>
+struct builtin_binary_function<
+    nd::functional::detail::apply_function_callable<FuncType, Func, ReturnType, ArgSequence, KwdSequence, 2>> {
+  typedef ReturnType ret_type;
+  typedef typename front<ArgSequence>::type arg0_type;
+  typedef typename front<typename from<ArgSequence, 1>::type>::type arg1_type;
+
+  static void single(char *dst, const char *src0, const char *src1) {
+    *reinterpret_cast<ret_type *>(dst) =
+        Func(*reinterpret_cast<const arg0_type *>(src0), *reinterpret_cast<const arg1_type *>(src1));
+  }
+};
+
+// Adds the function of KernelType<Arg0Type, Arg1Type> to a builtin binary
+// table for the same signatures make_all_if gives a callable
+template <template <typename, typename> class KernelType, template <typename, typename> class Condition>
+struct insert_builtin_binary {
+  template <typename Arg0Type, typename Arg1Type>
+  static void insert(nd::builtin_binary_table &table, std::true_type) {
+    typedef builtin_binary_function<KernelType<Arg0Type, Arg1Type>> function_type;
+    table.insert(ndt::make_type<Arg0Type>().get_id(), ndt::make_type<Arg1Type>().get_id(),
+                 ndt::make_type<typename function_type::ret_type>().get_id(), &function_type::single);
+  }
+
+  template <typename Arg0Type, typename Arg1Type>
+  static void insert(nd::builtin_binary_table &DYND_UNUSED(table), std::false_type) {}
+
+  template <typename TypeSequence>
+  void on_each(nd::builtin_binary_table &table) const {
+    typedef typename front<TypeSequence>::type arg0_type;
+    typedef typename front<typename from<TypeSequence, 1>::type>::type arg1_type;
+    insert<arg0_type, arg1_type>(table, std::integral_constant<bool, Condition<arg0_type, arg1_type>::value>());
+  }
+};
+
+template <template <typename, typename> class KernelType>
+void insert_float16_binary(dispatcher<2, nd::callable> &dispatch, std::true_type) {
+  dispatch.insert(nd::make_callable<nd::float16_binary_callable>(nd::make_callable<KernelType<float, float>>()));
+}
+
+template <template <typename, typename> class KernelType>
+void insert_float16_binary(dispatcher<2, nd::callable> &DYND_UNUSED(dispatch), std::false_type) {}
+
 template <template <typename, typename> class KernelType, template <typename, typename> class Condition,
           typename TypeSequence>
 nd::callable make_binary_arithmetic() {
@@ -32,7 +91,10 @@ nd::callable make_binary_arithmetic() {
       ndt::make_type<ndt::tuple_type>({ndt::make_type<ndt::any_kind_type>(), ndt::make_type<ndt::any_kind_type>()}),
       ndt::make_type<ndt::struct_type>());
 
-  auto dispatcher = nd::callable::template make_all_if<KernelType, Condition, TypeSequence, TypeSequence>(func_ptr);
+  auto dispatcher =
+      nd::callable::template make_all_if<KernelType, _exclude_float16<Condition>::template type, TypeSequence,
+                                         TypeSequence>(func_ptr);
+  insert_float16_binary<KernelType>(dispatcher, std::integral_constant<bool, Condition<float, float>::value>());
   dispatcher.insert(
       {nd::functional::forward_na<0>(ndt::type("Any"), {ndt::type("?Any"), ndt::type("Any")}),
        nd::functional::forward_na<1>(ndt::type("Any"), {ndt::type("Any"), ndt::type("?Any")}),
@@ -58,7 +120,14 @@ nd::callable make_binary_arithmetic() {
                {ndt::make_type<ndt::scalar_kind_type>(), ndt::make_type<ndt::scalar_kind_type>()}),
            ndt::make_type<ndt::struct_type>()))});
 
-  return nd::make_callable<nd::multidispatch_callable<2>>(tp, dispatcher);
+  nd::callable res = nd::make_callable<nd::multidispatch_callable<2>>(tp, dispatcher);
+
+  std::unique_ptr<nd::builtin_binary_table> table(new nd::builtin_binary_table());
+  for_each<typename outer<TypeSequence, TypeSequence>::type>(
+      insert_builtin_binary<KernelType, _exclude_float16<Condition>::template type>(), *table);
+  res->set_builtin_binary_table(std::move(table));
+
+  return res;
 }
 
 } // anonymous namespace
@@ -0,0 +1,121 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/config.hpp>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace dynd {
+
+/**
+ * Helpers for packed bitmaps with one bit per element, stored little-endian
+ * in 64-bit words (element i lives in bit i % 64 of word i / 64). These are
+ * used by kernels which track per-element validity for a whole chunk at once,
+ * so that runs of all-set or all-clear words can be skipped wholesale.
+ */
+namespace bitmap {
+
+  typedef uint64_t word_type;
+
+  static const size_t word_bits = 64;
+
+  /**
+   * The number of words needed to hold ``count`` bits.
+   */
+  inline DYND_CONSTEXPR size_t words(size_t count) { return (count + word_bits - 1) / word_bits; }
+
+  /**
+   * Returns the index of the lowest set bit of a nonzero word.
+   */
+  inline size_t count_trailing_zeros(word_type word) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return index;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    size_t index = 0;
+    while ((word & 1) == 0) {
+      word >>= 1;
+      ++index;
+    }
+    return index;
+#endif
+  }
+
+  /**
+   * Packs ``count`` bytes of boolean mask (0 or 1) into ``bits``, OR-ing them
+   * with what is already there. The words covering [0, count) must have been
+   * initialized by the caller.
+   */
+  inline void pack_or(word_type *bits, const bool1 *mask, size_t count) {
+    const unsigned char *m = reinterpret_cast<const unsigned char *>(mask);
+    size_t nfull = count / word_bits;
+    for (size_t w = 0; w != nfull; ++w, m += word_bits) {
+      word_type word = 0;
+      for (size_t j = 0; j != word_bits; ++j) {
+        word |= word_type(m[j] != 0) << j;
+      }
+      bits[w] |= word;
+    }
+    size_t nrest = count % word_bits;
+    if (nrest != 0) {
+      word_type word = 0;
+      for (size_t j = 0; j != nrest; ++j) {
+        word |= word_type(m[j] != 0) << j;
+      }
+      bits[nfull] |= word;
+    }
+  }
+
+  /**
+   * Returns the index of the first set bit in [begin, end), or ``end`` if
+   * there is none. All-clear words are skipped in a single comparison.
+   */
+  inline size_t find_set(const word_type *bits, size_t begin, size_t end) {
+    if (begin >= end) {
+      return end;
+    }
+    size_t w = begin / word_bits;
+    word_type word = bits[w] & (~word_type(0) << (begin % word_bits));
+    size_t last_word = (end - 1) / word_bits;
+    while (word == 0) {
+      if (++w > last_word) {
+        return end;
+      }
+      word = bits[w];
+    }
+    size_t i = w * word_bits + count_trailing_zeros(word);
+    return i < end ? i : end;
+  }
+
+  /**
+   * Returns the index of the first clear bit in [begin, end), or ``end`` if
+   * there is none. All-set words are skipped in a single comparison.
+   */
+  inline size_t find_clear(const word_type *bits, size_t begin, size_t end) {
+    if (begin >= end) {
+      return end;
+    }
+    size_t w = begin / word_bits;
+    word_type word = ~bits[w] & (~word_type(0) << (begin % word_bits));
+    size_t last_word = (end - 1) / word_bits;
+    while (word == 0) {
+      if (++w > last_word) {
+        return end;
+      }
+      word = ~bits[w];
+    }
+    size_t i = w * word_bits + count_trailing_zeros(word);
+    return i < end ? i : end;
+  }
+
+} // namespace dynd::bitmap
+} // namespace dynd
@@ -40,7 +40,7 @@ namespace nd {
   protected:
     /** Internal constructor. Initializes the buffer memory via one allocation, including the data aligned as needed */
     buffer(const ndt::type &tp, size_t data_offset, size_t data_size, uint64_t flags, buffer_empty_init_tag)
-        : intrusive_ptr(new (data_offset + data_size - sizeof(buffer_memory_block))
+        : intrusive_ptr(new (data_offset + data_size - sizeof(buffer_memory_block), data_offset)
                             buffer_memory_block(tp, data_offset, data_size, flags),
                         false) {}
 
@@ -249,7 +249,7 @@ namespace nd {
     size_t data_offset = inc_to_alignment(sizeof(buffer_memory_block) + tp.get_arrmeta_size(), tp.get_data_alignment());
     size_t data_size = tp.get_default_data_size();
 
-    return buffer(new (data_offset + data_size - sizeof(buffer_memory_block))
+    return buffer(new (data_offset + data_size - sizeof(buffer_memory_block), data_offset)
                       buffer_memory_block(tp, data_offset, data_size, flags),
                   false);
   }
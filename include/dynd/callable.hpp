@@ -37,7 +37,7 @@ namespace nd {
     DYND_API void check_narg(const base_callable *self, size_t narg);
 
     DYND_API void check_arg(const base_callable *self, intptr_t i, const ndt::type &actual_tp,
-                            const char *actual_arrmeta, std::map<std::string, ndt::type> &tp_vars);
+                            const char *actual_arrmeta, ndt::typevar_map &tp_vars);
 
     template <template <typename...> class KernelType>
     struct make_all;
@@ -68,7 +68,7 @@ namespace nd {
     callable_property get_flags() const { return right_associative; }
 
     ndt::type resolve(const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds) {
-      std::map<std::string, ndt::type> tp_vars;
+      ndt::typevar_map tp_vars;
 
       call_graph cg;
       return m_ptr->resolve(nullptr, nullptr, cg, dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
@@ -24,7 +24,7 @@ namespace nd {
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                         const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                         size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                        const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                        const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
         return dst_tp;
       }
 
@@ -34,7 +34,7 @@ namespace nd {
                              intptr_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                              const char *const *DYND_UNUSED(src_arrmeta), kernel_request_t kernreq,
                              intptr_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                             const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                             const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
               ckb->emplace_back<adapt_kernel>(kernreq, m_value_tp, m_forward);
               node = next(node);
             }
@@ -21,7 +21,7 @@ namespace nd {
 
         ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                           const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                          const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                          const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
           typedef nd::functional::apply_function_kernel<FuncType, func, NArg> kernel_type;
 
           cg.emplace_back([kwds = typename kernel_type::kwds_type(nkwd, kwds)](
@@ -8,6 +8,7 @@
 #include <dynd/callables/base_callable.hpp>
 #include <dynd/functional.hpp>
 #include <dynd/kernels/assignment_kernels.hpp>
+#include <dynd/types/categorical_kind_type.hpp>
 #include <dynd/types/fixed_bytes_kind_type.hpp>
 #include <dynd/types/fixed_string_kind_type.hpp>
 #include <dynd/types/float_kind_type.hpp>
@@ -27,7 +28,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode =
           (kwds == NULL || kwds[0].is_na()) ? assign_error_default : kwds[0].as<assign_error_mode>();
       switch (error_mode) {
@@ -79,7 +80,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
       switch (error_mode) {
       case assign_error_default:
@@ -134,7 +135,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       throw std::runtime_error("cannot assign to a fixed_bytes type of a different size");
 
       return dst_tp;
@@ -152,7 +153,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
 
       type_id_t src0_id = src_tp[0].get_id();
@@ -189,7 +190,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       type_id_t dst_id = dst_tp.get_id();
       size_t string_size = 0;
       string_encoding_t string_encoding = string_encoding_ascii;
@@ -224,7 +225,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode =
           (kwds == NULL || kwds[0].is_na()) ? assign_error_default : kwds[0].as<assign_error_mode>();
 
@@ -250,7 +251,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
       const ndt::base_string_type *src_fs = src_tp[0].extended<ndt::base_string_type>();
 
@@ -262,7 +263,8 @@ namespace nd {
           size_t DYND_UNUSED(nsrc), const char *const *DYND_UNUSED(src_arrmeta)) {
         kb.emplace_back<detail::assignment_kernel<ndt::fixed_string_type, string, assign_error_nocheck>>(
             kernreq, get_next_unicode_codepoint_function(src0_encoding, error_mode),
-            get_append_unicode_codepoint_function(dst_encoding, error_mode), dst_data_size,
+            get_append_unicode_codepoint_function(dst_encoding, error_mode),
+            get_transcode_run_function(dst_encoding, src0_encoding), dst_data_size,
             error_mode != assign_error_nocheck);
       });
 
@@ -281,19 +283,20 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
 
       cg.emplace_back([=](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                           const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
                           const char *const *DYND_UNUSED(src_arrmeta)) {
         const ndt::fixed_string_type *src_fs = src_tp[0].extended<ndt::fixed_string_type>();
+        string_encoding_t dst_encoding = dst_tp.extended<ndt::fixed_string_type>()->get_encoding();
         kb.emplace_back<
             detail::assignment_kernel<ndt::fixed_string_type, ndt::fixed_string_type, assign_error_nocheck>>(
             kernreq, get_next_unicode_codepoint_function(src_fs->get_encoding(), error_mode),
-            get_append_unicode_codepoint_function(dst_tp.extended<ndt::fixed_string_type>()->get_encoding(),
-                                                  error_mode),
-            dst_tp.get_data_size(), src_fs->get_data_size(), error_mode != assign_error_nocheck);
+            get_append_unicode_codepoint_function(dst_encoding, error_mode),
+            get_transcode_run_function(dst_encoding, src_fs->get_encoding()), dst_tp.get_data_size(),
+            src_fs->get_data_size(), error_mode != assign_error_nocheck);
       });
 
       return dst_tp;
@@ -311,7 +314,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       cg.emplace_back([=](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                           const char *dst_arrmeta, size_t DYND_UNUSED(nsrc),
                           const char *const *DYND_UNUSED(src_arrmeta)) {
@@ -334,7 +337,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       string_encoding_t dst_encoding = dst_tp.extended<ndt::base_string_type>()->get_encoding();
       string_encoding_t src0_encoding = src_tp[0].extended<ndt::char_type>()->get_encoding();
       size_t src0_data_size = src_tp[0].get_data_size();
@@ -363,7 +366,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                          const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
                          const char *const *src_arrmeta) {
@@ -386,7 +389,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
       string_encoding_t dst_encoding = dst_tp.extended<ndt::base_string_type>()->get_encoding();
       size_t src0_data_size = src_tp[0].get_data_size();
@@ -416,7 +419,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
 
       cg.emplace_back([=](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
@@ -441,7 +444,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data), const char *dst_arrmeta,
                          size_t DYND_UNUSED(nsrc), const char *const *DYND_UNUSED(src_arrmeta)) {
         kb.emplace_back<detail::assignment_kernel<string, ndt::type, assign_error_nocheck>>(
@@ -463,7 +466,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
       const ndt::base_string_type *src_fs = src_tp[0].extended<ndt::base_string_type>();
       size_t dst_data_size = dst_tp.get_data_size();
@@ -474,7 +477,8 @@ namespace nd {
           size_t DYND_UNUSED(nsrc), const char *const *DYND_UNUSED(src_arrmeta)) {
         kb.emplace_back<detail::assignment_kernel<ndt::fixed_string_type, string, assign_error_nocheck>>(
             kernreq, get_next_unicode_codepoint_function(src0_encoding, error_mode),
-            get_append_unicode_codepoint_function(dst_encoding, error_mode), dst_data_size,
+            get_append_unicode_codepoint_function(dst_encoding, error_mode),
+            get_transcode_run_function(dst_encoding, src0_encoding), dst_data_size,
             error_mode != assign_error_nocheck);
       });
 
@@ -493,7 +497,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data), const char *dst_arrmeta,
                          size_t DYND_UNUSED(nsrc), const char *const *src_arrmeta) {
         kb.emplace_back<assignment_kernel<ndt::pointer_type, ndt::pointer_type>>(kernreq);
@@ -506,6 +510,95 @@ namespace nd {
     }
   };
 
+  template <>
+  class assign_callable<ndt::categorical_type, ndt::scalar_kind_type> : public base_callable {
+  public:
+    assign_callable()
+        : base_callable(ndt::make_type<ndt::callable_type>(
+              ndt::make_type<ndt::categorical_kind_type>(), {ndt::make_type<ndt::scalar_kind_type>()},
+              {{ndt::make_type<ndt::option_type>(ndt::make_type<assign_error_mode>()), "error_mode"}})) {}
+
+    ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
+                      const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
+                      const ndt::typevar_map &tp_vars) {
+      const ndt::type &category_tp = dst_tp.extended<ndt::categorical_type>()->get_category_type();
+      bool convert = src_tp[0] != category_tp;
+
+      cg.emplace_back([dst_tp, convert](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                                        const char *DYND_UNUSED(dst_arrmeta), size_t nsrc,
+                                        const char *const *src_arrmeta) {
+        typedef detail::assignment_virtual_kernel<ndt::categorical_type, ndt::scalar_kind_type> self_type;
+
+        intptr_t self_offset = kb.size();
+        kb.emplace_back<self_type>(kernreq, dst_tp, convert);
+        if (convert) {
+          // The child converts the source value into the buffer of the category type
+          const char *buffer_arrmeta = kb.get_at<self_type>(self_offset)->m_buffer.get()->metadata();
+          kb(kernel_request_single, nullptr, buffer_arrmeta, nsrc, src_arrmeta);
+        }
+      });
+
+      if (convert) {
+        assign->resolve(this, nullptr, cg, category_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
+      }
+
+      return dst_tp;
+    }
+  };
+
+  template <>
+  class assign_callable<ndt::scalar_kind_type, ndt::categorical_type> : public base_callable {
+  public:
+    assign_callable()
+        : base_callable(ndt::make_type<ndt::callable_type>(
+              ndt::make_type<ndt::scalar_kind_type>(), {ndt::make_type<ndt::categorical_kind_type>()},
+              {{ndt::make_type<ndt::option_type>(ndt::make_type<assign_error_mode>()), "error_mode"}})) {}
+
+    ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
+                      const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
+      ndt::type src0_tp = src_tp[0];
+      cg.emplace_back([src0_tp](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                                const char *dst_arrmeta, size_t nsrc, const char *const *DYND_UNUSED(src_arrmeta)) {
+        kb.emplace_back<detail::assignment_virtual_kernel<ndt::scalar_kind_type, ndt::categorical_type>>(kernreq,
+                                                                                                           src0_tp);
+
+        const char *child_src_arrmeta = src0_tp.extended<ndt::categorical_type>()->get_category_arrmeta();
+        kb(kernel_request_single, nullptr, dst_arrmeta, nsrc, &child_src_arrmeta);
+      });
+
+      const ndt::type &category_tp = src0_tp.extended<ndt::categorical_type>()->get_category_type();
+      assign->resolve(this, nullptr, cg, dst_tp, 1, &category_tp, nkwd, kwds, tp_vars);
+
+      return dst_tp;
+    }
+  };
+
+  template <>
+  class assign_callable<ndt::categorical_type, ndt::categorical_type> : public base_callable {
+  public:
+    assign_callable()
+        : base_callable(ndt::make_type<ndt::callable_type>(
+              ndt::make_type<ndt::categorical_kind_type>(), {ndt::make_type<ndt::categorical_kind_type>()},
+              {{ndt::make_type<ndt::option_type>(ndt::make_type<assign_error_mode>()), "error_mode"}})) {}
+
+    ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
+                      const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
+                      const ndt::typevar_map &tp_vars) {
+      if (dst_tp == src_tp[0]) {
+        // Identical categoricals share their category values, so copy the storage
+        const ndt::type &storage_tp = dst_tp.extended<ndt::categorical_type>()->get_storage_type();
+        assign->resolve(this, nullptr, cg, storage_tp, 1, &storage_tp, nkwd, kwds, tp_vars);
+      } else {
+        // Otherwise go through the category values of the source
+        static callable f = make_callable<assign_callable<ndt::categorical_type, ndt::scalar_kind_type>>();
+        f->resolve(this, nullptr, cg, dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
+      }
+
+      return dst_tp;
+    }
+  };
+
   template <>
   class assign_callable<ndt::option_type, ndt::option_type> : public base_callable {
   public:
@@ -516,7 +609,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data), const char *dst_arrmeta,
                          size_t nsrc, const char *const *src_arrmeta) {
         intptr_t ckb_offset = kb.size();
@@ -564,7 +657,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                      const std::map<std::string, ndt::type> &tp_vars) {
+                      const ndt::typevar_map &tp_vars) {
       ndt::type src_tp_as_option = ndt::make_type<ndt::option_type>(src_tp[0]);
       static callable f = make_callable<assign_callable<ndt::option_type, ndt::option_type>>();
 
@@ -578,7 +671,7 @@ namespace nd {
                          const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
        *src_arrmeta,
                          kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                         const std::map<std::string, ndt::type> &tp_vars) {
+                         const ndt::typevar_map &tp_vars) {
           // Deal with some float32 to option[T] conversions where any NaN is
           // interpreted
           // as NA.
@@ -597,20 +690,30 @@ namespace nd {
     assign_callable()
         : base_callable(ndt::make_type<ndt::callable_type>(
               ndt::make_type<ndt::option_type>(), {ndt::make_type<string>()},
-              {{ndt::make_type<ndt::option_type>(ndt::make_type<assign_error_mode>()), "error_mode"}})) {}
+              {{ndt::make_type<ndt::option_type>(ndt::make_type<assign_error_mode>()), "error_mode"},
+               {ndt::type("?Fixed * string"), "na_values"}})) {}
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                      const std::map<std::string, ndt::type> &tp_vars) {
+                      const ndt::typevar_map &tp_vars) {
       assign_error_mode error_mode = kwds[0].is_na() ? assign_error_default : kwds[0].as<assign_error_mode>();
 
+      // The strings that mean a missing value, replacing the default tokens
+      // of parse_na when given
+      std::vector<std::string> na_values;
+      if (nkwd > 1 && !kwds[1].is_na()) {
+        for (intptr_t i = 0, i_end = kwds[1].get_dim_size(); i < i_end; ++i) {
+          na_values.push_back(kwds[1](i).as<std::string>());
+        }
+      }
+
       type_id_t tid = dst_tp.get_dtype().extended<ndt::option_type>()->get_value_type().get_id();
       switch (tid) {
       case bool_id:
-        cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
-                           const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
-                           const char *const *DYND_UNUSED(src_arrmeta)) {
-          kb.emplace_back<detail::string_to_option_bool_ck>(kernreq);
+        cg.emplace_back([na_values](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                                    const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
+                                    const char *const *DYND_UNUSED(src_arrmeta)) {
+          kb.emplace_back<detail::string_to_option_bool_ck>(kernreq, na_values);
         });
         break;
       case int8_id:
@@ -621,10 +724,11 @@ namespace nd {
       case float16_id:
       case float32_id:
       case float64_id:
-        cg.emplace_back([tid, error_mode](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
-                                          const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
-                                          const char *const *DYND_UNUSED(src_arrmeta)) {
-          kb.emplace_back<detail::string_to_option_number_ck>(kernreq, tid, error_mode);
+        cg.emplace_back([tid, error_mode, na_values](kernel_builder &kb, kernel_request_t kernreq,
+                                                     char *DYND_UNUSED(data), const char *DYND_UNUSED(dst_arrmeta),
+                                                     size_t DYND_UNUSED(nsrc),
+                                                     const char *const *DYND_UNUSED(src_arrmeta)) {
+          kb.emplace_back<detail::string_to_option_number_ck>(kernreq, tid, error_mode, na_values);
         });
         break;
       case string_id:
@@ -633,13 +737,13 @@ namespace nd {
                            const char *const *src_arrmeta) { kb(kernreq, nullptr, dst_arrmeta, nsrc, src_arrmeta); });
         break;
       default:
-        cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
-                           const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
+        cg.emplace_back([na_values](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                                    const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
           // Fall back to an adaptor that checks for a few standard
           // missing value tokens, then uses the standard value assignment
           intptr_t ckb_offset = kb.size();
           intptr_t root_ckb_offset = ckb_offset;
-          kb.emplace_back<detail::string_to_option_tp_ck>(kernreq);
+          kb.emplace_back<detail::string_to_option_tp_ck>(kernreq, na_values);
 
           ckb_offset = kb.size();
           // First child ckernel is the value assignment
@@ -673,7 +777,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       auto dst_sd = dst_tp.extended<ndt::tuple_type>();
       auto src_sd = src_tp[0].extended<ndt::tuple_type>();
 
@@ -742,7 +846,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       const ndt::struct_type *dst_sd = dst_tp.extended<ndt::struct_type>();
       const ndt::struct_type *src_sd = src_tp[0].extended<ndt::struct_type>();
       intptr_t field_count = dst_sd->get_field_count();
@@ -835,7 +939,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data), const char *dst_arrmeta,
                          size_t nsrc, const char *const *src_arrmeta) {
         intptr_t ckb_offset = kb.size();
@@ -870,7 +974,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       return dst_tp;
     }
 
@@ -879,7 +983,7 @@ namespace nd {
                          const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
        *src_arrmeta,
                          kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                         const std::map<std::string, ndt::type> &tp_vars) {
+                         const ndt::typevar_map &tp_vars) {
           intptr_t ckb_offset = kb.size();
           const ndt::type &storage_tp = src_tp[0].storage_type();
           if (storage_tp.is_expression()) {
@@ -919,7 +1023,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t nsrc, const ndt::type *DYND_UNUSED(src_tp), size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       const callable &inverse = dst_tp.extended<ndt::adapt_type>()->get_inverse();
       const ndt::type &value_tp = dst_tp.value_type();
 
@@ -937,7 +1041,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
 
       ndt::type val_dst_tp =
           dst_tp.get_id() == option_id ? dst_tp.extended<ndt::option_type>()->get_value_type() : dst_tp;
@@ -952,7 +1056,7 @@ namespace nd {
         void instantiate(call_node *&node, char *DYND_UNUSED(data), kernel_builder &kb, const ndt::type &dst_tp,
                          const char *dst_arrmeta, intptr_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                          const char *const *src_arrmeta, kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                         const std::map<std::string, ndt::type> &tp_vars) {
+                         const ndt::typevar_map &tp_vars) {
           ndt::type val_dst_tp =
               dst_tp.get_id() == option_id ? dst_tp.extended<ndt::option_type>()->get_value_type() : dst_tp;
           ndt::type val_src_tp =
@@ -7,9 +7,11 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 #include <typeinfo>
 
 #include <dynd/array.hpp>
+#include <dynd/callables/builtin_binary_table.hpp>
 #include <dynd/callables/call_graph.hpp>
 #include <dynd/kernels/kernel_prefix.hpp>
 #include <dynd/types/callable_type.hpp>
@@ -53,6 +55,8 @@ namespace nd {
   protected:
     std::atomic_long m_use_count;
     ndt::type m_tp;
+    // Shortcuts for two scalar arguments of builtin types, if the callable has any
+    std::unique_ptr<builtin_binary_table> m_builtin_binary;
 
   public:
     base_callable(const ndt::type &tp) : m_use_count(0), m_tp(tp) {}
@@ -90,6 +94,16 @@ namespace nd {
 
     bool is_kwd_variadic() const { return m_tp.extended<ndt::callable_type>()->is_kwd_variadic(); }
 
+    /**
+     * The direct implementations used by ``callable::call`` for two scalar
+     * arguments of builtin types, or NULL. They must compute exactly what the
+     * kernels of the callable would. The table is read without synchronization,
+     * so it may only be replaced while no other thread calls the callable.
+     */
+    const builtin_binary_table *get_builtin_binary_table() const { return m_builtin_binary.get(); }
+
+    void set_builtin_binary_table(std::unique_ptr<builtin_binary_table> table) { m_builtin_binary = std::move(table); }
+
     /**
      * Function prototype for instantiating a kernel from an
      * callable. To use this function, the
@@ -111,7 +125,7 @@ namespace nd {
      */
     virtual ndt::type resolve(base_callable *caller, char *data, call_graph &cg, const ndt::type &res_tp, size_t narg,
                               const ndt::type *arg_tp, size_t nkwd, const array *kwds,
-                              const std::map<std::string, ndt::type> &tp_vars) = 0;
+                              const ndt::typevar_map &tp_vars) = 0;
 
     //    virtual void resolve() {}
 
@@ -127,18 +141,18 @@ namespace nd {
     }
 
     array call(ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, const char *const *src_arrmeta,
-               char *const *src_data, size_t nkwd, const array *kwds, const std::map<std::string, ndt::type> &tp_vars);
+               char *const *src_data, size_t nkwd, const array *kwds, const ndt::typevar_map &tp_vars);
 
     array call(ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, const char *const *src_arrmeta,
-               const array *src_data, size_t nkwd, const array *kwds, const std::map<std::string, ndt::type> &tp_vars);
+               const array *src_data, size_t nkwd, const array *kwds, const ndt::typevar_map &tp_vars);
 
     void call(const ndt::type &dst_tp, const char *dst_arrmeta, array *dst_data, size_t nsrc, const ndt::type *src_tp,
               const char *const *src_arrmeta, const array *src_data, size_t nkwd, const array *kwds,
-              const std::map<std::string, ndt::type> &tp_vars);
+              const ndt::typevar_map &tp_vars);
 
     void call(const ndt::type &dst_tp, const char *dst_arrmeta, char *dst_data, size_t nsrc, const ndt::type *src_tp,
               const char *const *src_arrmeta, char *const *src_data, size_t nkwd, const array *kwds,
-              const std::map<std::string, ndt::type> &tp_vars);
+              const ndt::typevar_map &tp_vars);
 
     friend void intrusive_ptr_retain(base_callable *ptr);
     friend void intrusive_ptr_release(base_callable *ptr);
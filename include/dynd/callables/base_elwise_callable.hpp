@@ -43,7 +43,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *caller, char *codata, call_graph &cg, const ndt::type &res_tp,
                         size_t DYND_UNUSED(narg), const ndt::type *arg_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         data_type data;
         data.ndim = reinterpret_cast<codata_type *>(codata)->ndim;
         bool res_ignore = reinterpret_cast<codata_type *>(codata)->res_ignore;
@@ -40,7 +40,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *caller, char *data, call_graph &cg, const ndt::type &res_tp, size_t nsrc,
                         const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         node_type node;
 
         callable &child = reinterpret_cast<data_type *>(data)->child;
@@ -13,6 +13,13 @@ namespace dynd {
 namespace nd {
 
   class binary_search_callable : public base_callable {
+    template <typename T>
+    static void emplace(kernel_builder &kb, kernel_request_t kernreq, const char *src0_arrmeta) {
+      kb.emplace_back<builtin_binary_search_kernel<T>>(
+          kernreq, reinterpret_cast<const fixed_dim_type_arrmeta *>(src0_arrmeta)->dim_size,
+          reinterpret_cast<const fixed_dim_type_arrmeta *>(src0_arrmeta)->stride);
+    }
+
   public:
     binary_search_callable()
         : base_callable(ndt::make_type<ndt::callable_type>(ndt::make_type<intptr_t>(),
@@ -21,7 +28,67 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &tp_vars) {
+                      const ndt::typevar_map &tp_vars) {
+      ndt::type element_tp = src_tp[0].at_single(0, nullptr);
+
+      // Builtin numeric elements are compared directly
+      type_id_t element_id = element_tp.get_id();
+      if (element_id == src_tp[1].get_id()) {
+        switch (element_id) {
+        case int8_id:
+        case int16_id:
+        case int32_id:
+        case int64_id:
+        case uint8_id:
+        case uint16_id:
+        case uint32_id:
+        case uint64_id:
+        case float32_id:
+        case float64_id:
+          cg.emplace_back([element_id](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                                       const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
+                                       const char *const *src_arrmeta) {
+            switch (element_id) {
+            case int8_id:
+              emplace<int8_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case int16_id:
+              emplace<int16_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case int32_id:
+              emplace<int32_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case int64_id:
+              emplace<int64_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case uint8_id:
+              emplace<uint8_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case uint16_id:
+              emplace<uint16_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case uint32_id:
+              emplace<uint32_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case uint64_id:
+              emplace<uint64_t>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case float32_id:
+              emplace<float>(kb, kernreq, src_arrmeta[0]);
+              break;
+            case float64_id:
+              emplace<double>(kb, kernreq, src_arrmeta[0]);
+              break;
+            default:
+              throw std::runtime_error("unexpected element type in binary search kernel");
+            }
+          });
+          return dst_tp;
+        default:
+          break;
+        }
+      }
+
       cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                          const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
                          const char *const *src_arrmeta) {
@@ -29,11 +96,12 @@ namespace nd {
             kernreq, reinterpret_cast<const fixed_dim_type_arrmeta *>(src_arrmeta[0])->dim_size,
             reinterpret_cast<const fixed_dim_type_arrmeta *>(src_arrmeta[0])->stride);
 
-        const char *child_src_arrmeta[2] = {src_arrmeta[0], src_arrmeta[0]};
-        kb(kernreq | kernel_request_data_only, nullptr, nullptr, 2, child_src_arrmeta);
+        // The kernel only ever calls the comparison one pair at a time
+        const char *element_arrmeta = src_arrmeta[0] + sizeof(fixed_dim_type_arrmeta);
+        const char *child_src_arrmeta[2] = {element_arrmeta, element_arrmeta};
+        kb(kernel_request_single, nullptr, nullptr, 2, child_src_arrmeta);
       });
 
-      ndt::type element_tp = src_tp[0].at_single(0, nullptr);
       ndt::type child_src_tp[2] = {element_tp, element_tp};
 
       total_order->resolve(this, nullptr, cg, ndt::make_type<int>(), 2, child_src_tp, 0, NULL, tp_vars);
@@ -0,0 +1,51 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/types/type_id.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * Direct implementations of a binary callable on scalars of builtin types,
+   * indexed by the ids of the two types. Calling through the table skips
+   * resolution and kernel construction, which are nearly all the cost of an
+   * operation on two scalars.
+   */
+  class builtin_binary_table {
+  public:
+    /**
+     * Computes the result from the two arguments, none of which need to be
+     * aligned.
+     */
+    typedef void (*function_t)(char *dst, const char *src0, const char *src1);
+
+    struct entry {
+      type_id_t ret_id;
+      function_t func;
+    };
+
+  private:
+    entry m_entries[builtin_id_count][builtin_id_count];
+
+  public:
+    builtin_binary_table() : m_entries() {}
+
+    /**
+     * The implementation for the given builtin types, with a null ``func`` if
+     * there is none.
+     */
+    const entry &operator()(type_id_t id0, type_id_t id1) const { return m_entries[id0][id1]; }
+
+    void insert(type_id_t id0, type_id_t id1, type_id_t ret_id, function_t func) {
+      m_entries[id0][id1].ret_id = ret_id;
+      m_entries[id0][id1].func = func;
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <dynd/assignment.hpp>
 #include <dynd/callables/base_callable.hpp>
 #include <dynd/kernels/byteswap_kernels.hpp>
 
@@ -18,17 +19,65 @@ namespace nd {
                                                            {ndt::make_type<ndt::any_kind_type>()})) {}
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
-                      const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
-                      size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t DYND_UNUSED(nkwd),
+                      const array *DYND_UNUSED(kwds), const ndt::typevar_map &tp_vars) {
       size_t src0_data_size = src_tp[0].get_data_size();
+      if (is_fusable(dst_tp, src_tp[0])) {
+        // Swap into a buffer and assign from it, e.g. to widen big-endian
+        // int32 values into native int64 in one pass
+        cg.emplace_back([src0_data_size](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                                         const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
+          kb.emplace_back<byteswap_assign_kernel>(kernreq, src0_data_size);
+
+          kernel_request_t child_kernreq = (kernreq == kernel_request_strided) ? kernel_request_strided
+                                                                               : kernel_request_single;
+          kb(child_kernreq, nullptr, dst_arrmeta, nsrc, src_arrmeta);
+        });
+
+        array error_mode = assign_error_default;
+        return assign->resolve(this, nullptr, cg, dst_tp, nsrc, src_tp, 1, &error_mode, tp_vars);
+      }
+
       cg.emplace_back([src0_data_size](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                                        const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
                                        const char *const *DYND_UNUSED(src_arrmeta)) {
         kb.emplace_back<byteswap_ck>(kernreq, src0_data_size);
       });
 
-      return dst_tp;
+      return dst_tp.is_symbolic() ? src_tp[0] : dst_tp;
+    }
+
+  private:
+    static bool is_numeric(const ndt::type &tp) {
+      switch (tp.get_base_id()) {
+      case bool_kind_id:
+      case int_kind_id:
+      case uint_kind_id:
+      case float_kind_id:
+      case complex_kind_id:
+        return tp.is_builtin();
+      default:
+        return false;
+      }
+    }
+
+    /**
+     * A byteswapped integer or floating-point value can be converted to a
+     * different numeric destination type as it is swapped.
+     */
+    static bool is_fusable(const ndt::type &dst_tp, const ndt::type &src_tp) {
+      if (dst_tp == src_tp || !is_numeric(dst_tp)) {
+        return false;
+      }
+
+      switch (src_tp.get_base_id()) {
+      case int_kind_id:
+      case uint_kind_id:
+      case float_kind_id:
+        return src_tp.get_data_size() <= byteswap_assign_kernel::max_data_size;
+      default:
+        return false;
+      }
     }
   };
 
@@ -41,7 +90,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       size_t src0_data_size = src_tp[0].get_data_size();
       cg.emplace_back([src0_data_size](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                                        const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
@@ -49,7 +98,7 @@ namespace nd {
         kb.emplace_back<pairwise_byteswap_ck>(kernreq, src0_data_size);
       });
 
-      return dst_tp;
+      return dst_tp.is_symbolic() ? src_tp[0] : dst_tp;
     }
   };
 
@@ -12,7 +12,11 @@ namespace dynd {
 namespace nd {
 
   class call_graph : public storagebuf<call_node, call_graph> {
+    size_t m_node_count;
+
   public:
+    call_graph() : m_node_count(0) {}
+
     void destroy() {}
 
     ~call_graph() {
@@ -27,6 +31,7 @@ namespace nd {
     template <typename ClosureType, typename... ArgTypes>
     void emplace_back(ArgTypes &&... args) {
       storagebuf<call_node, call_graph>::emplace_back_sep<ClosureType>(std::forward<ArgTypes>(args)...);
+      ++m_node_count;
     }
 
     template <typename Arg0Type>
@@ -34,6 +39,13 @@ namespace nd {
       typedef remove_reference_then_cv_t<Arg0Type> closure_type;
       this->emplace_back<closure_type, Arg0Type>(std::forward<Arg0Type>(arg0));
     }
+
+    /**
+     * An estimate of the size of the kernel tree this graph instantiates, so
+     * it can be allocated up front. Each node emplaces at most one kernel, and
+     * kernels rarely exceed a cache line.
+     */
+    size_t kernel_size_hint() const { return m_node_count * storagebuf_alignment; }
   };
 
 } // namespace dynd::nd
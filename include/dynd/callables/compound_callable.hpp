@@ -20,7 +20,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                         const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                            const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
           kb.emplace_back<left_compound_kernel>(kernreq);
@@ -44,7 +44,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                         const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                            const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
           kb.emplace_back<right_compound_kernel>(kernreq);
@@ -25,7 +25,7 @@ namespace nd {
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                         const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                         size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         cg.emplace_back([val = m_val](kernel_builder & kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                                       const char *dst_arrmeta, size_t DYND_UNUSED(nsrc),
                                       const char *const *DYND_UNUSED(src_arrmeta)) {
@@ -23,7 +23,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &DYND_UNUSED(dst_tp), size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       cg.emplace_back(
           [](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
              const char *DYND_UNUSED(dst_arrmeta), size_t DYND_UNUSED(nsrc),
@@ -0,0 +1,82 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/callable.hpp>
+#include <dynd/callables/base_callable.hpp>
+#include <dynd/callables/default_instantiable_callable.hpp>
+#include <dynd/kernels/describe_kernel.hpp>
+#include <dynd/types/scalar_kind_type.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * The return type of nd::describe, matching the layout of describe_stats.
+   */
+  inline ndt::type make_describe_type() {
+    return ndt::type("{count: int64, sum: float64, mean: float64, m2: float64, min: float64, max: float64, "
+                     "var: float64, stddev: float64}");
+  }
+
+  class describe_init_callable : public default_instantiable_callable<describe_init_kernel> {
+  public:
+    describe_init_callable()
+        : default_instantiable_callable<describe_init_kernel>(
+              ndt::make_type<ndt::callable_type>(make_describe_type(), {ndt::make_type<ndt::scalar_kind_type>()})) {}
+  };
+
+  template <typename Arg0Type>
+  class describe_callable : public default_instantiable_callable<describe_kernel<Arg0Type>> {
+  public:
+    describe_callable()
+        : default_instantiable_callable<describe_kernel<Arg0Type>>(
+              ndt::make_type<ndt::callable_type>(make_describe_type(), {ndt::make_type<Arg0Type>()})) {}
+  };
+
+  class describe_finalize_callable : public default_instantiable_callable<describe_finalize_kernel> {
+  public:
+    describe_finalize_callable()
+        : default_instantiable_callable<describe_finalize_kernel>(
+              ndt::make_type<ndt::callable_type>(make_describe_type(), {make_describe_type()})) {}
+  };
+
+  /**
+   * The nd::describe callable, which runs a reduction that merges the
+   * statistics and then an elementwise finalize over its result, so var and
+   * stddev are computed once per output instead of once per merge.
+   */
+  class describe_entry_callable : public base_callable {
+    callable m_reduction;
+    callable m_finalize;
+
+  public:
+    describe_entry_callable(const callable &reduction, const callable &finalize)
+        : base_callable(reduction->get_type()), m_reduction(reduction), m_finalize(finalize) {}
+
+    ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
+                      const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
+                      const ndt::typevar_map &tp_vars) {
+      cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                         const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
+        intptr_t root_ckb_offset = kb.size();
+        kb.emplace_back<describe_entry_kernel>(kernreq);
+        kb(kernreq | kernel_request_data_only, nullptr, dst_arrmeta, nsrc, src_arrmeta);
+
+        intptr_t finalize_offset = kb.size();
+        kb.get_at<describe_entry_kernel>(root_ckb_offset)->finalize_offset = finalize_offset - root_ckb_offset;
+        kb(kernreq | kernel_request_data_only, nullptr, dst_arrmeta, 1, &dst_arrmeta);
+      });
+
+      ndt::type ret_tp = m_reduction->resolve(this, nullptr, cg, dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
+      m_finalize->resolve(this, nullptr, cg, ret_tp, 1, &ret_tp, 0, nullptr, tp_vars);
+
+      return ret_tp;
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
@@ -32,7 +32,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *data, call_graph &cg, const ndt::type &dst_tp,
                         size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         const ndt::callable_type *child_tp =
             reinterpret_cast<data_type *>(data)->child->get_type().template extended<ndt::callable_type>();
         bool first = reinterpret_cast<data_type *>(data)->first;
@@ -20,7 +20,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &DYND_UNUSED(res_tp), size_t DYND_UNUSED(narg), const ndt::type *arg_tp,
-                      size_t DYND_UNUSED(nkwd), const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      size_t DYND_UNUSED(nkwd), const array *kwds, const ndt::typevar_map &tp_vars) {
       std::string name = kwds[0].as<std::string>();
       intptr_t i = arg_tp[0].extended<ndt::struct_type>()->get_field_index(name);
       uintptr_t arrmeta_offset = arg_tp[0].extended<ndt::struct_type>()->get_arrmeta_offset(i);
@@ -54,7 +54,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &DYND_UNUSED(res_tp), size_t DYND_UNUSED(narg), const ndt::type *arg_tp,
                       size_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       ndt::type dt = arg_tp[0].get_dtype();
       std::string name = kwds[0].as<std::string>();
 
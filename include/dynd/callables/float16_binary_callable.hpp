@@ -0,0 +1,59 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/callables/base_callable.hpp>
+#include <dynd/kernels/float16_binary_kernel.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * Implements a binary operation on (float16, float16) by computing it with
+   * a (float32, float32) child. A float32 result is narrowed back to float16,
+   * any other result type (e.g. bool from a logical operation) is kept.
+   */
+  class float16_binary_callable : public base_callable {
+    callable m_child;
+
+    static ndt::type make_ret_type(const callable &child) {
+      return (child->get_ret_type().get_id() == float32_id) ? ndt::make_type<float16>() : child->get_ret_type();
+    }
+
+  public:
+    float16_binary_callable(const callable &child)
+        : base_callable(ndt::make_type<ndt::callable_type>(
+              make_ret_type(child), {ndt::make_type<float16>(), ndt::make_type<float16>()})),
+          m_child(child) {}
+
+    ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
+                      const ndt::type &DYND_UNUSED(dst_tp), size_t DYND_UNUSED(nsrc),
+                      const ndt::type *DYND_UNUSED(src_tp), size_t nkwd, const array *kwds,
+                      const ndt::typevar_map &tp_vars) {
+      bool narrow = m_child->get_ret_type().get_id() == float32_id;
+
+      cg.emplace_back([narrow](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                               const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
+        if (narrow) {
+          kb.emplace_back<float16_binary_kernel<true>>(kernreq);
+        } else {
+          kb.emplace_back<float16_binary_kernel<false>>(kernreq);
+        }
+
+        kernel_request_t child_kernreq = (kernreq == kernel_request_strided) ? kernel_request_strided
+                                                                             : kernel_request_single;
+        kb(child_kernreq, nullptr, dst_arrmeta, nsrc, src_arrmeta);
+      });
+
+      ndt::type child_src_tp[2] = {ndt::make_type<float>(), ndt::make_type<float>()};
+      m_child->resolve(this, nullptr, cg, m_child->get_ret_type(), 2, child_src_tp, nkwd, kwds, tp_vars);
+
+      return get_ret_type();
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
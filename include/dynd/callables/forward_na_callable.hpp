@@ -22,33 +22,56 @@ namespace nd {
 
     ndt::type resolve(base_callable *caller, char *DYND_UNUSED(data), call_graph &cg, const ndt::type &dst_tp,
                       size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                      const std::map<std::string, ndt::type> &tp_vars) {
-      cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data), const char *dst_arrmeta,
-                         size_t nsrc, const char *const *src_arrmeta) {
+                      const ndt::typevar_map &tp_vars) {
+      ndt::type src_value_tp[2];
+      for (intptr_t i = 0; i < 2; ++i) {
+        src_value_tp[i] = src_tp[i];
+      }
+      for (intptr_t i : std::array<index_t, sizeof...(I)>({I...})) {
+        src_value_tp[i] = src_value_tp[i].extended<ndt::option_type>()->get_value_type();
+      }
+
+      // Floating-point operations never trap, so for them it is cheaper to
+      // compute over NA values and overwrite the results than to split the
+      // computation into runs. That is only known for the builtin arithmetic
+      // and comparison dispatch, which forwards to the caller; a user child
+      // never sees the NA payloads.
+      bool compute_through = m_child.is_null();
+      for (intptr_t i = 0; i < 2; ++i) {
+        switch (src_value_tp[i].get_id()) {
+        case float32_id:
+        case float64_id:
+        case complex_float32_id:
+        case complex_float64_id:
+          break;
+        default:
+          compute_through = false;
+        }
+      }
+
+      cg.emplace_back([compute_through](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
+                                        const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
         size_t self_offset = kb.size();
-        kb.emplace_back<forward_na_kernel<I...>>(kernreq);
+        kb.emplace_back<forward_na_kernel<I...>>(kernreq, compute_through);
 
-        kb(kernel_request_single, nullptr, dst_arrmeta, nsrc, src_arrmeta);
+        // The strided kernel hands whole runs of available or missing values
+        // to its children, so they are requested as strided in that case
+        kernel_request_t child_kernreq = (kernreq == kernel_request_strided) ? kernel_request_strided
+                                                                             : kernel_request_single;
+
+        kb(child_kernreq, nullptr, dst_arrmeta, nsrc, src_arrmeta);
 
         for (intptr_t i : std::array<index_t, sizeof...(I)>({I...})) {
           size_t is_na_offset = kb.size() - self_offset;
-          kb(kernel_request_single, nullptr, nullptr, 1, src_arrmeta + i);
+          kb(child_kernreq, nullptr, nullptr, 1, src_arrmeta + i);
           kb.get_at<forward_na_kernel<I...>>(self_offset)->is_na_offset[i] = is_na_offset;
         }
 
         size_t assign_na_offset = kb.size() - self_offset;
-        kb(kernel_request_single, nullptr, nullptr, 0, nullptr);
+        kb(child_kernreq, nullptr, nullptr, 0, nullptr);
         kb.get_at<forward_na_kernel<I...>>(self_offset)->assign_na_offset = assign_na_offset;
       });
 
-      ndt::type src_value_tp[2];
-      for (intptr_t i = 0; i < 2; ++i) {
-        src_value_tp[i] = src_tp[i];
-      }
-      for (intptr_t i : std::array<index_t, sizeof...(I)>({I...})) {
-        src_value_tp[i] = src_value_tp[i].extended<ndt::option_type>()->get_value_type();
-      }
-
       base_callable *child;
       if (m_child.is_null()) {
         child = caller;
@@ -56,9 +79,13 @@ namespace nd {
         child = m_child.get();
       }
 
-      ndt::type res_value_tp =
-          child->resolve(this, nullptr, cg, dst_tp.is_symbolic() ? child->get_ret_type() : dst_tp, 2, src_value_tp,
-                         nkwd, kwds, tp_vars);
+      // The child computes the value type of the option result
+      ndt::type dst_value_tp = dst_tp.is_symbolic() ? child->get_ret_type() : dst_tp;
+      if (dst_value_tp.get_id() == option_id) {
+        dst_value_tp = dst_value_tp.extended<ndt::option_type>()->get_value_type();
+      }
+
+      ndt::type res_value_tp = child->resolve(this, nullptr, cg, dst_value_tp, 2, src_value_tp, nkwd, kwds, tp_vars);
 
       for (index_t i : std::array<index_t, sizeof...(I)>({I...})) {
         is_na->resolve(this, nullptr, cg, ndt::make_type<bool>(), 1, src_tp + i, 0, nullptr, tp_vars);
@@ -38,7 +38,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                       const ndt::type &DYND_UNUSED(dst_tp), size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       return src_tp[0];
     }
 
@@ -47,7 +47,7 @@ namespace nd {
                          const char *DYND_UNUSED(dst_arrmeta), intptr_t DYND_UNUSED(nsrc),
                          const ndt::type *DYND_UNUSED(src_tp), const char *const *DYND_UNUSED(src_arrmeta),
                          kernel_request_t kernreq, intptr_t DYND_UNUSED(nkwd), const nd::array *DYND_UNUSED(kwds),
-                         const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                         const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
           ckb->emplace_back<index_kernel<Arg0ID>>(kernreq);
           node = next(node);
           delete reinterpret_cast<data_type *>(data);
@@ -78,7 +78,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                      const std::map<std::string, ndt::type> &tp_vars) {
+                      const ndt::typevar_map &tp_vars) {
       ndt::type child_src_tp = src_tp[0].extended<ndt::fixed_dim_type>()->get_element_type();
       return index->resolve(this, nullptr, cg, dst_tp, nsrc, &child_src_tp, nkwd, kwds, tp_vars);
     }
@@ -87,7 +87,7 @@ namespace nd {
                          const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
        *src_arrmeta,
                          kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                         const std::map<std::string, ndt::type> &tp_vars) {
+                         const ndt::typevar_map &tp_vars) {
           ckb->emplace_back<index_kernel<fixed_dim_id>>(
               kernreq, *reinterpret_cast<data_type *>(data)->indices,
               reinterpret_cast<const ndt::fixed_dim_type::metadata_type *>(src_arrmeta[0])->stride);
@@ -23,7 +23,7 @@ namespace nd {
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                       size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       return dst_tp;
     }
 
@@ -32,7 +32,7 @@ namespace nd {
                          const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
        *src_arrmeta,
                          kernel_request_t kernreq, intptr_t nkwd, const array *kwds,
-                         const std::map<std::string, ndt::type> &tp_vars) {
+                         const ndt::typevar_map &tp_vars) {
           intptr_t mean_offset = ckb->size();
           ckb->emplace_back<mean_kernel>(kernreq, src_tp[0].get_size(src_arrmeta[0]));
           node = next(node);
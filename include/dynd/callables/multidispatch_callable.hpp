@@ -38,8 +38,14 @@ namespace nd {
     multidispatch_callable(const ndt::type &tp, const dispatcher<2, callable> &dispatcher)
         : base_dispatch_callable(tp), m_dispatcher(dispatcher) {}
 
+    /**
+     * Adds an overload and drops the builtin binary table. This is not
+     * thread-safe: no other thread may call the callable while it runs.
+     */
     void overload(const callable &value) {
       m_dispatcher.insert(value);
+      // The new overload may take over some builtin signatures
+      m_builtin_binary.reset();
     }
 
     const callable &specialize(const ndt::type &dst_tp, intptr_t nsrc, const ndt::type *src_tp) {
@@ -74,14 +74,14 @@ namespace nd {
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                         const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                         size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                        const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                        const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
         return dst_tp;
       }
 
 /*
       char *data_init(const ndt::type &DYND_UNUSED(dst_tp), intptr_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       intptr_t DYND_UNUSED(nkwd), const array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
         char *data = reinterpret_cast<char *>(
             new data_type(src_tp, kwds[0].get_dim_size(), reinterpret_cast<int *>(kwds[0].data()),
                           kwds[1].is_na() ? NULL : reinterpret_cast<int *>(kwds[1].data())));
@@ -97,7 +97,7 @@ namespace nd {
 /*
       void resolve_dst_type(char *DYND_UNUSED(data), ndt::type &dst_tp, intptr_t DYND_UNUSED(nsrc),
                             const ndt::type *src_tp, intptr_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                            const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                            const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
         // swap in the input dimension values for the Fixed**N
         intptr_t ndim = src_tp[0].get_ndim();
         dimvector shape(ndim);
@@ -110,7 +110,7 @@ namespace nd {
       void instantiate(call_node *&DYND_UNUSED(node), char *data, kernel_builder *ckb, const ndt::type &dst_tp,
                        const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const *src_arrmeta,
                        kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                       const std::map<std::string, ndt::type> &tp_vars) {
+                       const ndt::typevar_map &tp_vars) {
         intptr_t neighborhood_offset = ckb->size();
         ckb->emplace_back<neighborhood_kernel<N>>(
             kernreq, reinterpret_cast<const fixed_dim_type_arrmeta *>(dst_arrmeta)->stride,
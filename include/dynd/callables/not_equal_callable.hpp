@@ -30,7 +30,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       size_t field_count = src_tp[0].extended<ndt::tuple_type>()->get_field_count();
 
       auto bsd = src_tp->extended<ndt::tuple_type>();
@@ -86,7 +86,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       size_t field_count = src_tp[0].extended<ndt::struct_type>()->get_field_count();
 
       auto bsd = src_tp->extended<ndt::struct_type>();
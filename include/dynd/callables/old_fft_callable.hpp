@@ -23,7 +23,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                       const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                      const std::map<std::string, ndt::type> &tp_vars) {
+                      const ndt::typevar_map &tp_vars) {
       return resolve_dst_type_<std::is_same<fftw_src_type, double>::value>(dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
     }
 
@@ -31,7 +31,7 @@ namespace nd {
     typename std::enable_if<real_to_complex, ndt::type>::type
     resolve_dst_type_(const ndt::type &DYND_UNUSED(dst_tp), intptr_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       intptr_t DYND_UNUSED(nkwd), const nd::array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       nd::array shape = kwds[0];
 
       intptr_t ndim = src_tp[0].get_ndim();
@@ -45,7 +45,7 @@ namespace nd {
     typename std::enable_if<!real_to_complex, ndt::type>::type
     resolve_dst_type_(const ndt::type &DYND_UNUSED(dst_tp), intptr_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                       intptr_t DYND_UNUSED(nkwd), const nd::array *kwds,
-                      const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       nd::array shape = kwds[0];
       if (shape.is_na()) {
         return src_tp[0];
@@ -59,7 +59,7 @@ namespace nd {
     }
 
     void resolve_dst_type(char *DYND_UNUSED(data), ndt::type &dst_tp, intptr_t nsrc, const ndt::type *src_tp,
-                          intptr_t nkwd, const nd::array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                          intptr_t nkwd, const nd::array *kwds, const ndt::typevar_map &tp_vars) {
       dst_tp = resolve_dst_type_<std::is_same<fftw_src_type, double>::value>(dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
     }
 
@@ -67,7 +67,7 @@ namespace nd {
     void instantiate(call_node *&node, char *DYND_UNUSED(data), kernel_builder *ckb, const ndt::type &dst_tp,
                      const char *dst_arrmeta, intptr_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                      const char *const *src_arrmeta, kernel_request_t kernreq, intptr_t DYND_UNUSED(nkwd),
-                     const nd::array *kwds, const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                     const nd::array *kwds, const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
       int flags;
       if (kwds[2].is_na()) {
         flags = FFTW_ESTIMATE;
@@ -24,7 +24,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *caller, char *data, call_graph &cg, const ndt::type &dst_tp,
                         size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         base_callable *child = reinterpret_cast<data_type *>(data)->child;
         size_t &i = reinterpret_cast<data_type *>(data)->i;
 
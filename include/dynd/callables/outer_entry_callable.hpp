@@ -29,7 +29,7 @@ namespace nd {
 
         ndt::type resolve(base_callable *DYND_UNUSED(caller), char *data, call_graph &cg, const ndt::type &dst_tp,
                           size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                          const std::map<std::string, ndt::type> &tp_vars) {
+                          const ndt::typevar_map &tp_vars) {
           base_callable *child = reinterpret_cast<data_type *>(data)->child;
           const size_t &i = reinterpret_cast<data_type *>(data)->i;
 
@@ -50,7 +50,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                         const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         data_type data{m_child.get(), 0};
 
         size_t &i = data.i;
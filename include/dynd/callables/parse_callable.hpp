@@ -30,7 +30,7 @@ namespace nd {
 
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                         const ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp, size_t nkwd, const array *kwds,
-                        const std::map<std::string, ndt::type> &tp_vars) {
+                        const ndt::typevar_map &tp_vars) {
         cg.emplace_back([](kernel_builder &kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                            const char *dst_arrmeta, size_t nsrc, const char *const *src_arrmeta) {
           intptr_t self_offset = kb.size();
@@ -53,7 +53,7 @@ namespace nd {
                              const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
          *src_arrmeta,
                              kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                             const std::map<std::string, ndt::type> &tp_vars) {
+                             const ndt::typevar_map &tp_vars) {
               intptr_t ckb_offset = ckb->size();
               intptr_t self_offset = ckb_offset;
               ckb->emplace_back<parse_kernel<option_id>>(kernreq);
@@ -83,7 +83,7 @@ namespace nd {
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                         const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                         size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                        const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                        const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
         return dst_tp;
       }
 
@@ -92,7 +92,7 @@ namespace nd {
                              const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
          *src_arrmeta,
                              kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                             const std::map<std::string, ndt::type> &tp_vars) {
+                             const ndt::typevar_map &tp_vars) {
               intptr_t ckb_offset = ckb->size();
               size_t field_count = dst_tp.extended<ndt::struct_type>()->get_field_count();
               const std::vector<uintptr_t> &arrmeta_offsets =
@@ -128,7 +128,7 @@ namespace nd {
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                         const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                         size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                        const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                        const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
         return dst_tp;
       }
 
@@ -137,7 +137,7 @@ namespace nd {
                              const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
          *src_arrmeta,
                              kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                             const std::map<std::string, ndt::type> &tp_vars) {
+                             const ndt::typevar_map &tp_vars) {
               ckb->emplace_back<parse_kernel<fixed_dim_id>>(kernreq, dst_tp,
                                                             reinterpret_cast<const size_stride_t
          *>(dst_arrmeta)->dim_size,
@@ -165,7 +165,7 @@ namespace nd {
       ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &DYND_UNUSED(cg),
                         const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *DYND_UNUSED(src_tp),
                         size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
-                        const std::map<std::string, ndt::type> &DYND_UNUSED(tp_vars)) {
+                        const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
         return dst_tp;
       }
 
@@ -174,7 +174,7 @@ namespace nd {
                              const char *dst_arrmeta, intptr_t nsrc, const ndt::type *src_tp, const char *const
          *src_arrmeta,
                              kernel_request_t kernreq, intptr_t nkwd, const nd::array *kwds,
-                             const std::map<std::string, ndt::type> &tp_vars) {
+                             const ndt::typevar_map &tp_vars) {
               ckb->emplace_back<parse_kernel<var_dim_id>>(
                   kernreq, dst_tp, reinterpret_cast<const ndt::var_dim_type::metadata_type *>(dst_arrmeta)->blockref,
                   reinterpret_cast<const ndt::var_dim_type::metadata_type *>(dst_arrmeta)->stride);
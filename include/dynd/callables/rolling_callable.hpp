@@ -0,0 +1,113 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/callables/base_callable.hpp>
+#include <dynd/kernels/rolling_kernel.hpp>
+#include <dynd/types/fixed_dim_type.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * Applies ``WindowType`` over a sliding window of ``window`` elements along
+   * the last dimension. The leading dimensions, which must all be fixed, are
+   * iterated over by the kernel, each row independently. The elements of the
+   * result are of ``WindowType<T>::result_type``.
+   */
+  template <template <typename> class WindowType>
+  class rolling_callable : public base_callable {
+    typedef void (*emplace_t)(kernel_builder &kb, kernel_request_t kernreq, intptr_t window, intptr_t ndim,
+                              const char *dst_arrmeta, const char *src_arrmeta);
+
+    intptr_t m_window;
+
+    template <typename T>
+    static void emplace(kernel_builder &kb, kernel_request_t kernreq, intptr_t window, intptr_t ndim,
+                        const char *dst_arrmeta, const char *src_arrmeta) {
+      kb.emplace_back<rolling_kernel<WindowType<T>>>(kernreq, window, ndim, dst_arrmeta, src_arrmeta);
+    }
+
+    template <typename T>
+    static void select(emplace_t &emplace_fn, ndt::type &res_el_tp) {
+      emplace_fn = &emplace<T>;
+      res_el_tp = ndt::make_type<typename WindowType<T>::result_type>();
+    }
+
+  public:
+    rolling_callable(intptr_t window)
+        : base_callable(ndt::type("(Dims... * Scalar) -> Dims... * Scalar")), m_window(window) {
+      if (window < 1) {
+        throw std::invalid_argument("rolling window size must be at least 1, got " + std::to_string(window));
+      }
+    }
+
+    ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
+                      const ndt::type &DYND_UNUSED(dst_tp), size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
+                      size_t DYND_UNUSED(nkwd), const array *DYND_UNUSED(kwds),
+                      const ndt::typevar_map &DYND_UNUSED(tp_vars)) {
+      intptr_t ndim = src_tp[0].get_ndim();
+      if (ndim == 0) {
+        throw type_error("a rolling window requires at least one dimension, got " + src_tp[0].str());
+      }
+      ndt::type el_tp = src_tp[0];
+      for (intptr_t i = 0; i < ndim; ++i) {
+        if (el_tp.get_id() != fixed_dim_id) {
+          throw type_error("a rolling window requires fixed dimensions, got " + src_tp[0].str());
+        }
+        el_tp = el_tp.extended<ndt::fixed_dim_type>()->get_element_type();
+      }
+
+      emplace_t emplace_fn;
+      ndt::type res_el_tp;
+      switch (el_tp.get_id()) {
+      case int8_id:
+        select<int8_t>(emplace_fn, res_el_tp);
+        break;
+      case int16_id:
+        select<int16_t>(emplace_fn, res_el_tp);
+        break;
+      case int32_id:
+        select<int32_t>(emplace_fn, res_el_tp);
+        break;
+      case int64_id:
+        select<int64_t>(emplace_fn, res_el_tp);
+        break;
+      case uint8_id:
+        select<uint8_t>(emplace_fn, res_el_tp);
+        break;
+      case uint16_id:
+        select<uint16_t>(emplace_fn, res_el_tp);
+        break;
+      case uint32_id:
+        select<uint32_t>(emplace_fn, res_el_tp);
+        break;
+      case uint64_id:
+        select<uint64_t>(emplace_fn, res_el_tp);
+        break;
+      case float32_id:
+        select<float>(emplace_fn, res_el_tp);
+        break;
+      case float64_id:
+        select<double>(emplace_fn, res_el_tp);
+        break;
+      default:
+        throw type_error("a rolling window does not support element type " + el_tp.str());
+      }
+
+      intptr_t window = m_window;
+      cg.emplace_back([emplace_fn, window, ndim](kernel_builder &kb, kernel_request_t kernreq,
+                                                 char *DYND_UNUSED(data), const char *dst_arrmeta,
+                                                 size_t DYND_UNUSED(nsrc), const char *const *src_arrmeta) {
+        emplace_fn(kb, kernreq, window, ndim, dst_arrmeta, src_arrmeta[0]);
+      });
+
+      return src_tp[0].with_replaced_dtype(res_el_tp);
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
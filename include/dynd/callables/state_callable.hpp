@@ -22,7 +22,7 @@ namespace nd {
 
     ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), call_graph &cg,
                       const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp, size_t nkwd,
-                      const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                      const array *kwds, const ndt::typevar_map &tp_vars) {
       cg.emplace_back([i = m_i](kernel_builder & kb, kernel_request_t kernreq, char *DYND_UNUSED(data),
                                 const char *dst_arrmeta, size_t DYND_UNUSED(nsrc), const char *const *src_arrmeta) {
         size_t self_offset = kb.size();
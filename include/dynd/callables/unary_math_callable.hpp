@@ -0,0 +1,28 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/callables/default_instantiable_callable.hpp>
+#include <dynd/kernels/unary_math_kernel.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * The (Arg0Type) -> return type overload of a unary math function such as
+   * dynd::detail::inline_exp.
+   */
+  template <template <typename> class FuncType, typename Arg0Type>
+  class unary_math_callable : public default_instantiable_callable<unary_math_kernel<FuncType, Arg0Type>> {
+  public:
+    unary_math_callable()
+        : default_instantiable_callable<unary_math_kernel<FuncType, Arg0Type>>(ndt::make_type<ndt::callable_type>(
+              ndt::make_type<typename unary_math_kernel<FuncType, Arg0Type>::dst_type>(),
+              {ndt::make_type<Arg0Type>()})) {}
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
@@ -0,0 +1,51 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/callables/default_instantiable_callable.hpp>
+#include <dynd/kernels/wide_sum_kernel.hpp>
+#include <dynd/types/scalar_kind_type.hpp>
+
+namespace dynd {
+namespace nd {
+
+  class wide_sum_init_callable : public default_instantiable_callable<wide_sum_init_kernel> {
+  public:
+    wide_sum_init_callable()
+        : default_instantiable_callable<wide_sum_init_kernel>(ndt::make_type<ndt::callable_type>(
+              ndt::make_type<ndt::scalar_kind_type>(), {ndt::make_type<ndt::scalar_kind_type>()})) {}
+  };
+
+  template <typename Arg0Type>
+  class wide_sum_callable : public default_instantiable_callable<wide_sum_kernel<Arg0Type>> {
+  public:
+    wide_sum_callable()
+        : default_instantiable_callable<wide_sum_kernel<Arg0Type>>(ndt::make_type<ndt::callable_type>(
+              ndt::make_type<typename wide_sum_kernel<Arg0Type>::dst_type>(), {ndt::make_type<Arg0Type>()})) {}
+  };
+
+  /**
+   * The return type of nd::wide_mean, matching the layout of wide_mean_stats.
+   */
+  inline ndt::type make_wide_mean_type() { return ndt::type("{sum: int128, count: int64, mean: float64}"); }
+
+  class wide_mean_init_callable : public default_instantiable_callable<wide_mean_init_kernel> {
+  public:
+    wide_mean_init_callable()
+        : default_instantiable_callable<wide_mean_init_kernel>(
+              ndt::make_type<ndt::callable_type>(make_wide_mean_type(), {ndt::make_type<ndt::scalar_kind_type>()})) {}
+  };
+
+  template <typename Arg0Type>
+  class wide_mean_callable : public default_instantiable_callable<wide_mean_kernel<Arg0Type>> {
+  public:
+    wide_mean_callable()
+        : default_instantiable_callable<wide_mean_kernel<Arg0Type>>(
+              ndt::make_type<ndt::callable_type>(make_wide_mean_type(), {ndt::make_type<Arg0Type>()})) {}
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
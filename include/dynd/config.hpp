@@ -29,9 +29,51 @@
  */
 #define DYND_UNUSED(x)
 
-/** The number of elements to process at once when doing chunking/buffering */
+/**
+ * The number of elements to process at once when doing chunking/buffering
+ * with fixed size (e.g. stack) buffers. Heap buffers are sized at runtime
+ * with dynd::get_buffer_chunk_size.
+ */
 #define DYND_BUFFER_CHUNK_SIZE 128
 
+/**
+ * How many elements ahead strided kernels prefetch a source whose stride is
+ * at least a cache line.
+ */
+#ifndef DYND_PREFETCH_DISTANCE
+#define DYND_PREFETCH_DISTANCE 16
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define DYND_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#else
+#define DYND_PREFETCH(ADDR)
+#endif
+
+/**
+ * The alignment of the data of nd::array buffers too large for the
+ * per-thread pools, 64 keeps it cache line aligned.
+ */
+#ifndef DYND_BUFFER_LARGE_ALIGNMENT
+#define DYND_BUFFER_LARGE_ALIGNMENT 64
+#endif
+
+/**
+ * nd::array buffers of at least this many bytes are aligned to 2 MiB and, on
+ * Linux, advised to use transparent huge pages. Zero disables this.
+ */
+#ifndef DYND_BUFFER_HUGE_PAGE_THRESHOLD
+#define DYND_BUFFER_HUGE_PAGE_THRESHOLD 0
+#endif
+
+/**
+ * The number of bytes of the innermost operand of nd::functional::outer that
+ * are kept in cache and reused across rows, tiling larger dimensions.
+ */
+#ifndef DYND_OUTER_TILE_BYTES
+#define DYND_OUTER_TILE_BYTES 16384
+#endif
+
 #ifdef __clang__
 
 #if __has_feature(cxx_constexpr)
@@ -657,6 +699,12 @@ bool built_with_cuda();
 
 } // namespace dynd
 
+// Whether int128 and uint128 arithmetic is done with the compiler's 128-bit
+// integers, which have the same representation
+#if defined(__SIZEOF_INT128__) && !defined(__CUDACC__)
+#define DYND_USE_NATIVE_INT128
+#endif
+
 namespace dynd {
 
 class bool1;
@@ -994,6 +1042,39 @@ using std::isnan;
 
 DYNDT_API void load(const std::string &path);
 
+/**
+ * The size in bytes of the given level (1, 2 or 3) of data cache, as detected
+ * when first asked for, or a typical size if it could not be detected.
+ */
+DYNDT_API size_t get_data_cache_size(int level);
+
+/**
+ * The number of elements of ``element_size`` bytes that a chunked pipeline
+ * (e.g. a multi-step conversion) should process at once, so that its
+ * intermediate buffers stay in cache. This is sized from half the L1 data
+ * cache, unless overridden with set_buffer_chunk_bytes.
+ */
+DYNDT_API size_t get_buffer_chunk_size(size_t element_size);
+
+/**
+ * Overrides the number of bytes each buffer of a chunked pipeline targets.
+ * Zero restores the size derived from the detected caches.
+ */
+DYNDT_API void set_buffer_chunk_bytes(size_t bytes);
+
+/**
+ * Contiguous destinations of at least this many bytes are written by
+ * assignment with non-temporal stores, where supported, as they would evict
+ * the whole last level cache anyway.
+ */
+DYNDT_API size_t get_nontemporal_store_threshold();
+
+/**
+ * Overrides the non-temporal store threshold. Zero restores the size of the
+ * detected last level cache.
+ */
+DYNDT_API void set_nontemporal_store_threshold(size_t bytes);
+
 typedef intptr_t index_t;
 
 template <typename T, typename BinaryFunction>
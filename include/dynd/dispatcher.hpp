@@ -5,11 +5,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 
 // #include <sparsehash/dense_hash_map>
 
 #include <dynd/type_registry.hpp>
+#include <dynd/types/type_pattern.hpp>
 
 namespace dynd {
 
@@ -130,10 +132,32 @@ inline std::ostream &print_ids(std::ostream &o, size_t nids, const ndt::type *tp
   return o;
 }
 
+namespace detail {
+
+  template <size_t N>
+  struct builtin_dispatch_table_size {
+    static const size_t value = builtin_id_count * builtin_dispatch_table_size<N - 1>::value;
+  };
+
+  template <>
+  struct builtin_dispatch_table_size<0> {
+    static const size_t value = 1;
+  };
+
+} // namespace dynd::detail
+
 template <size_t N, typename T>
 class dispatcher {
   typedef std::map<size_t, T> Map;
 
+  // Signatures made of builtin types are resolved with a table indexed by
+  // their ids, which is only worth it for one or two arguments
+  static const bool use_builtin_table = N <= 2;
+  static const size_t builtin_table_size = use_builtin_table ? detail::builtin_dispatch_table_size<N>::value : 0;
+
+  // Entries of the builtin table, with child i stored as i + 1
+  enum { builtin_unresolved = 0, builtin_not_found = -1 };
+
 public:
   typedef T value_type;
 
@@ -145,8 +169,51 @@ public:
 
 private:
   std::vector<T> m_children;
+  // The dispatch types of each child, compiled for matching, in the same order
+  std::vector<std::array<ndt::type_pattern, N>> m_children_patterns;
   //  map_type m_map;
   dispatch_t m_dispatch;
+  // Filled lazily, so concurrent lookups may race to write the same value
+  std::unique_ptr<std::atomic<int>[]> m_builtin_table;
+
+  void reset_builtin_table() {
+    if (!use_builtin_table) {
+      return;
+    }
+    if (m_builtin_table == nullptr) {
+      m_builtin_table.reset(new std::atomic<int>[builtin_table_size]);
+    }
+    for (size_t i = 0; i < builtin_table_size; ++i) {
+      m_builtin_table[i].store(builtin_unresolved, std::memory_order_relaxed);
+    }
+  }
+
+  std::array<ndt::type, N> dispatch_types(const T &child) const {
+    return as_array<N>(m_dispatch(child->get_ret_type(), child->get_narg(), child->get_arg_types().data()));
+  }
+
+  static bool match(const std::array<ndt::type_pattern, N> &patterns, const std::array<ndt::type, N> &tps) {
+    for (size_t i = 0; i < N; ++i) {
+      if (!patterns[i].match(tps[i])) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Finds the first child, in topological order, that the types match, or -1.
+   */
+  intptr_t find(const std::array<ndt::type, N> &tps) const {
+    for (size_t i = 0; i < m_children.size(); ++i) {
+      if (match(m_children_patterns[i], tps)) {
+        return i;
+      }
+    }
+
+    return -1;
+  }
 
   static size_t hash_combine(size_t seed, type_id_t id) { return seed ^ (id + (seed << 6) + (seed >> 2)); }
 
@@ -165,9 +232,12 @@ private:
   }
 
 public:
-  dispatcher(dispatch_t dispatch) : m_dispatch(dispatch) {}
+  dispatcher(dispatch_t dispatch) : m_dispatch(dispatch) { reset_builtin_table(); }
 
-  dispatcher(const dispatcher &other) : m_children(other.m_children), m_dispatch(other.m_dispatch) {}
+  dispatcher(const dispatcher &other)
+      : m_children(other.m_children), m_children_patterns(other.m_children_patterns), m_dispatch(other.m_dispatch) {
+    reset_builtin_table();
+  }
 
   template <typename Iterator>
   dispatcher(dispatch_t dispatch, Iterator begin, Iterator end) : m_dispatch(dispatch) {
@@ -176,29 +246,36 @@ public:
     assign(begin, end);
   }
 
+  dispatcher &operator=(const dispatcher &other) {
+    m_children = other.m_children;
+    m_children_patterns = other.m_children_patterns;
+    m_dispatch = other.m_dispatch;
+    reset_builtin_table();
+    return *this;
+  }
+
   dispatcher(dispatch_t dispatch, std::initializer_list<T> pairs) : dispatcher(dispatch, pairs.begin(), pairs.end()) {}
 
   template <typename Iterator>
   void assign(Iterator begin, Iterator end) {
     m_children.resize(end - begin);
 
+    std::vector<std::array<ndt::type, N>> tps(m_children.size());
+    for (size_t i = 0; i < tps.size(); ++i) {
+      tps[i] = dispatch_types(begin[i]);
+    }
+
     std::vector<std::vector<size_t>> edges(m_children.size());
     for (size_t i = 0; i < edges.size(); ++i) {
-      const auto &f_i = begin[i];
-      std::array<ndt::type, N> tp_i =
-          as_array<N>(m_dispatch(f_i->get_ret_type(), f_i->get_narg(), f_i->get_arg_types().data()));
+      const std::array<ndt::type, N> &tp_i = tps[i];
 
       for (size_t j = i + 1; j < edges.size(); ++j) {
-        const auto &f_j = begin[j];
-        std::array<ndt::type, N> tp_j =
-            as_array<N>(m_dispatch(f_j->get_ret_type(), f_j->get_narg(), f_j->get_arg_types().data()));
+        const std::array<ndt::type, N> &tp_j = tps[j];
 
         if (ambiguous(tp_i, tp_j)) {
           bool ok = false;
           for (size_t k = 0; k < edges.size(); ++k) {
-            const auto &f_k = begin[k];
-            std::array<ndt::type, N> tp_k =
-                as_array<N>(m_dispatch(f_k->get_ret_type(), f_k->get_narg(), f_k->get_arg_types().data()));
+            const std::array<ndt::type, N> &tp_k = tps[k];
 
             if (supercedes(tp_k, tp_i) && supercedes(tp_k, tp_j)) {
               ok = true;
@@ -225,6 +302,15 @@ public:
 
     topological_sort(begin, end, edges, m_children.begin());
 
+    m_children_patterns.resize(m_children.size());
+    for (size_t i = 0; i < m_children.size(); ++i) {
+      std::array<ndt::type, N> tps = dispatch_types(m_children[i]);
+      for (size_t j = 0; j < N; ++j) {
+        m_children_patterns[i][j] = ndt::type_pattern(tps[j]);
+      }
+    }
+    reset_builtin_table();
+
     //    m_map.clear();
   }
 
@@ -260,24 +346,37 @@ public:
       ids[i] = tps[i].get_id();
     }
 
-    //    size_t key = hash(ids);
-
-    /*
-        const auto &it = m_map.find(key);
-        if (it != m_map.end()) {
-          return it->second;
+    // A builtin type is fully described by its id, so the child found for
+    // builtin ids can be remembered in a table indexed by them
+    std::atomic<int> *entry = nullptr;
+    int cached = builtin_unresolved;
+    if (use_builtin_table) {
+      size_t index = 0;
+      for (size_t i = 0; i < N; ++i) {
+        if (!tps[i].is_builtin()) {
+          index = builtin_table_size;
+          break;
         }
-    */
-
-    for (const T &child : m_children) {
-      std::array<ndt::type, N> other_tps =
-          as_array<N>(m_dispatch(child->get_ret_type(), child->get_narg(), child->get_arg_types().data()));
+        index = index * builtin_id_count + ids[i];
+      }
 
-      if (supercedes(tps, other_tps)) {
-        return child;
+      if (index < builtin_table_size) {
+        entry = &m_builtin_table[index];
+        cached = entry->load(std::memory_order_relaxed);
+        if (cached > 0) {
+          return m_children[cached - 1];
+        }
       }
     }
 
+    intptr_t i = (cached == builtin_not_found) ? -1 : find(tps);
+    if (entry != nullptr && cached == builtin_unresolved) {
+      entry->store((i < 0) ? static_cast<int>(builtin_not_found) : static_cast<int>(i + 1), std::memory_order_relaxed);
+    }
+    if (i >= 0) {
+      return m_children[i];
+    }
+
     std::stringstream ss;
     ss << "signature not found for (";
     for (size_t i = 0; i < N; ++i) {
@@ -27,6 +27,18 @@ DYNDT_API float halfbits_to_float(uint16_t value);
 
 DYNDT_API double halfbits_to_double(uint16_t value);
 
+// Bulk conversions between contiguous buffers. These give the same results
+// as the scalar conversions above, but use the F16C instructions when the
+// CPU supports them, and otherwise a branch-free loop the compiler can
+// vectorize.
+DYNDT_API void halfbits_to_floats(float *dst, const uint16_t *src, size_t count);
+
+DYNDT_API void halfbits_to_doubles(double *dst, const uint16_t *src, size_t count);
+
+DYNDT_API void floats_to_halfbits(uint16_t *dst, const float *src, size_t count);
+
+DYNDT_API void doubles_to_halfbits(uint16_t *dst, const double *src, size_t count);
+
 class DYNDT_API float16 {
   uint16_t m_bits;
 
@@ -0,0 +1,138 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <chrono>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <dynd/config.hpp>
+
+namespace dynd {
+namespace ndt {
+  class type;
+} // namespace dynd::ndt
+
+namespace nd {
+
+  class base_callable;
+
+  /**
+   * What the instrumentation recorded for one callable, over all of its
+   * top-level calls. The times are in nanoseconds, and execution time
+   * includes that of any callables called from within the kernel.
+   */
+  struct callable_stats {
+    // The registry path of the callable (e.g. "dynd.nd.add"), or its type if it is not registered
+    std::string name;
+    uint64_t calls;
+    uint64_t resolve_ns;
+    uint64_t build_ns;
+    // The total size of the kernels built, over all the calls
+    uint64_t kernel_bytes;
+    uint64_t execute_ns;
+    // The total number of destination elements produced
+    uint64_t elements;
+  };
+
+  /**
+   * Whether the instrumentation was compiled in, with the DYND_INSTRUMENT
+   * CMake option. Without it, the hooks compile to nothing and there is never
+   * anything recorded.
+   */
+  DYND_API bool is_instrumentation_available();
+
+  /**
+   * Switches the recording of calls on or off. It is off by default.
+   */
+  DYND_API void set_instrumentation_enabled(bool enabled);
+
+  DYND_API bool is_instrumentation_enabled();
+
+  /**
+   * The statistics of every callable called while the instrumentation was
+   * enabled, most expensive first.
+   */
+  DYND_API std::vector<callable_stats> get_callable_stats();
+
+  /**
+   * Discards everything recorded so far.
+   */
+  DYND_API void reset_callable_stats();
+
+  /**
+   * Writes the callable statistics as a JSON object with a "callables" list.
+   */
+  DYND_API void dump_callable_stats_json(std::ostream &o);
+
+  /**
+   * Writes the recorded calls in the Chrome trace event format, which can be
+   * loaded into chrome://tracing. Each call is a resolve, a build and an
+   * execute event. Only the first 2^20 calls are kept.
+   */
+  DYND_API void dump_callable_trace(std::ostream &o);
+
+  namespace detail {
+
+    DYND_API void record_call(base_callable *self, std::chrono::steady_clock::time_point start,
+                              std::chrono::steady_clock::time_point resolved,
+                              std::chrono::steady_clock::time_point built, size_t kernel_bytes,
+                              std::chrono::steady_clock::time_point executed, const ndt::type &dst_tp,
+                              const char *dst_arrmeta);
+
+    /**
+     * Times the phases of one call of a callable, used through the
+     * DYND_INSTRUMENT_* macros.
+     */
+    class call_recorder {
+      base_callable *m_self;
+      std::chrono::steady_clock::time_point m_start, m_resolved, m_built;
+      size_t m_kernel_bytes;
+
+    public:
+      call_recorder(base_callable *self) : m_self(is_instrumentation_enabled() ? self : NULL), m_kernel_bytes(0) {
+        if (m_self != NULL) {
+          m_start = std::chrono::steady_clock::now();
+        }
+      }
+
+      void resolved() {
+        if (m_self != NULL) {
+          m_resolved = std::chrono::steady_clock::now();
+        }
+      }
+
+      void built(size_t kernel_bytes) {
+        if (m_self != NULL) {
+          m_built = std::chrono::steady_clock::now();
+          m_kernel_bytes = kernel_bytes;
+        }
+      }
+
+      void executed(const ndt::type &dst_tp, const char *dst_arrmeta) {
+        if (m_self != NULL) {
+          record_call(m_self, m_start, m_resolved, m_built, m_kernel_bytes, std::chrono::steady_clock::now(), dst_tp,
+                      dst_arrmeta);
+        }
+      }
+    };
+
+  } // namespace dynd::nd::detail
+} // namespace dynd::nd
+} // namespace dynd
+
+#ifdef DYND_INSTRUMENT
+#define DYND_INSTRUMENT_CALL_BEGIN(SELF) dynd::nd::detail::call_recorder dynd_call_recorder(SELF)
+#define DYND_INSTRUMENT_CALL_RESOLVED() dynd_call_recorder.resolved()
+#define DYND_INSTRUMENT_CALL_BUILT(KB) dynd_call_recorder.built((KB).size())
+#define DYND_INSTRUMENT_CALL_EXECUTED(DST_TP, DST_ARRMETA) dynd_call_recorder.executed(DST_TP, DST_ARRMETA)
+#else
+#define DYND_INSTRUMENT_CALL_BEGIN(SELF)
+#define DYND_INSTRUMENT_CALL_RESOLVED()
+#define DYND_INSTRUMENT_CALL_BUILT(KB)
+#define DYND_INSTRUMENT_CALL_EXECUTED(DST_TP, DST_ARRMETA)
+#endif
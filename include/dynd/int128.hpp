@@ -5,8 +5,47 @@
 
 #pragma once
 
+#include <cmath>
 #include <limits>
 
+namespace dynd {
+namespace detail {
+
+  /**
+   * Converts the 128-bit unsigned value ``hi * 2^64 + lo`` to a floating point
+   * type with a single rounding. The top 64 bits are converted by the hardware,
+   * with any lower bits folded into a sticky bit so ties still round correctly.
+   */
+  template <typename T>
+  T uint128_to_float(uint64_t hi, uint64_t lo)
+  {
+    if (hi == 0) {
+      return static_cast<T>(lo);
+    }
+
+    int shift = 1;
+    for (uint64_t h = hi, bits = 32; bits > 0; bits /= 2) {
+      if (h >> bits) {
+        shift += static_cast<int>(bits);
+        h >>= bits;
+      }
+    }
+
+    uint64_t top, sticky;
+    if (shift == 64) {
+      top = hi;
+      sticky = lo;
+    }
+    else {
+      top = (hi << (64 - shift)) | (lo >> shift);
+      sticky = lo << (64 - shift);
+    }
+    return std::ldexp(static_cast<T>(top | (sticky != 0)), shift);
+  }
+
+} // namespace dynd::detail
+} // namespace dynd
+
 #if !defined(DYND_HAS_INT128)
 
 namespace dynd {
@@ -90,14 +129,31 @@ public:
     m_lo = lo_p1;
   }
 
-  int128 &operator+=(const int128 &rhs)
-  {
-    uint64_t lo = m_lo + rhs.m_lo;
-    *this = int128(m_hi + ~rhs.m_hi + (lo < m_lo), lo);
-
-    return *this;
+#ifdef DYND_USE_NATIVE_INT128
+  /**
+   * Converts from and to the bits of the compiler's 128-bit integer. Arithmetic
+   * is done on the unsigned type so that overflow wraps instead of being
+   * undefined.
+   */
+  static int128 from_bits(unsigned __int128 bits) {
+    return int128(static_cast<uint64_t>(bits >> 64), static_cast<uint64_t>(bits));
   }
 
+  unsigned __int128 bits() const { return (static_cast<unsigned __int128>(m_hi) << 64) | m_lo; }
+
+  __int128 native() const { return static_cast<__int128>(bits()); }
+#endif
+
+  int128 &operator+=(const int128 &rhs) { return *this = *this + rhs; }
+
+  int128 &operator-=(const int128 &rhs) { return *this = *this - rhs; }
+
+  int128 &operator*=(const int128 &rhs) { return *this = *this * rhs; }
+
+  int128 &operator/=(const int128 &rhs) { return *this = divide(rhs); }
+
+  int128 &operator%=(const int128 &rhs) { return *this = remainder(rhs); }
+
   int128 operator-() const
   {
     // twos complement negation, ~x + 1
@@ -114,24 +170,119 @@ public:
 
   int128 operator-(const int128 &rhs) const
   {
-    uint64_t lo = m_lo + ~rhs.m_lo + 1;
-    return int128(m_hi + ~rhs.m_hi + (lo < m_lo), lo);
+    uint64_t lo = m_lo - rhs.m_lo;
+    return int128(m_hi - rhs.m_hi - (m_lo < rhs.m_lo), lo);
   }
 
   int128 operator*(uint32_t rhs) const;
 
-  //     int128 operator/(uint32_t rhs) const;
+  /**
+   * Multiplies, wrapping on overflow like the builtin unsigned integers.
+   */
+  int128 operator*(const int128 &rhs) const
+  {
+#ifdef DYND_USE_NATIVE_INT128
+    return from_bits(bits() * rhs.bits());
+#else
+    return multiply(rhs);
+#endif
+  }
+
+  int128 operator%(const int128 &rhs) const { return remainder(rhs); }
+
+  int128 operator&(const int128 &rhs) const { return int128(m_hi & rhs.m_hi, m_lo & rhs.m_lo); }
+
+  int128 operator|(const int128 &rhs) const { return int128(m_hi | rhs.m_hi, m_lo | rhs.m_lo); }
+
+  int128 operator^(const int128 &rhs) const { return int128(m_hi ^ rhs.m_hi, m_lo ^ rhs.m_lo); }
+
+  int128 operator<<(int shift) const
+  {
+    shift &= 127;
+    if (shift == 0) {
+      return *this;
+    }
+    if (shift >= 64) {
+      return int128(m_lo << (shift - 64), 0ULL);
+    }
+    return int128((m_hi << shift) | (m_lo >> (64 - shift)), m_lo << shift);
+  }
+
+  /**
+   * An arithmetic shift, filling with the sign bit.
+   */
+  int128 operator>>(int shift) const
+  {
+    shift &= 127;
+    if (shift == 0) {
+      return *this;
+    }
+    uint64_t sign = is_negative() ? 0xffffffffffffffffULL : 0ULL;
+    if (shift >= 64) {
+      return int128(sign, static_cast<uint64_t>(static_cast<int64_t>(m_hi) >> (shift - 64)));
+    }
+    return int128(static_cast<uint64_t>(static_cast<int64_t>(m_hi) >> shift), (m_lo >> shift) | (m_hi << (64 - shift)));
+  }
+
+  /**
+   * Divides, truncating toward zero like the builtin integers. The minimum
+   * value divided by -1 wraps back to the minimum value, and dividing by zero
+   * throws zero_division_error.
+   */
+  int128 divide(const int128 &rhs) const
+  {
+#ifdef DYND_USE_NATIVE_INT128
+    if (rhs.m_hi == 0 && rhs.m_lo == 0) {
+      throw_zero_division();
+    }
+    if (rhs.m_hi == 0xffffffffffffffffULL && rhs.m_lo == 0xffffffffffffffffULL) {
+      return -*this;
+    }
+    return from_bits(static_cast<unsigned __int128>(native() / rhs.native()));
+#else
+    int128 quotient, rem;
+    divrem(rhs, quotient, rem);
+    return quotient;
+#endif
+  }
+
+  /**
+   * The remainder of divide, which has the sign of the dividend.
+   */
+  int128 remainder(const int128 &rhs) const
+  {
+#ifdef DYND_USE_NATIVE_INT128
+    if (rhs.m_hi == 0 && rhs.m_lo == 0) {
+      throw_zero_division();
+    }
+    if (rhs.m_hi == 0xffffffffffffffffULL && rhs.m_lo == 0xffffffffffffffffULL) {
+      return int128(0);
+    }
+    return from_bits(static_cast<unsigned __int128>(native() % rhs.native()));
+#else
+    int128 quotient, rem;
+    divrem(rhs, quotient, rem);
+    return rem;
+#endif
+  }
+
+  /**
+   * The portable multiply and divide, used when the compiler has no 128-bit
+   * integer. They are built either way so they can be checked against it.
+   */
+  int128 multiply(const int128 &rhs) const;
+  void divrem(const int128 &rhs, int128 &out_quotient, int128 &out_remainder) const;
 
-  int128 &operator/=(int128 DYND_UNUSED(rhs)) { throw std::runtime_error("operator/= is not implemented for int128"); }
+  static void throw_zero_division();
 
   operator float() const
   {
     if (*this < int128(0)) {
       int128 tmp = -(*this);
-      return tmp.m_lo + tmp.m_hi * 18446744073709551616.f;
+      return -detail::uint128_to_float<float>(tmp.m_hi, tmp.m_lo);
     }
     else {
-      return m_lo + m_hi * 18446744073709551616.f;
+      return detail::uint128_to_float<float>(m_hi, m_lo);
     }
   }
 
@@ -139,10 +290,10 @@ public:
   {
     if (*this < int128(0)) {
       int128 tmp = -(*this);
-      return tmp.m_lo + tmp.m_hi * 18446744073709551616.0;
+      return -detail::uint128_to_float<double>(tmp.m_hi, tmp.m_lo);
     }
     else {
-      return m_lo + m_hi * 18446744073709551616.0;
+      return detail::uint128_to_float<double>(m_hi, m_lo);
     }
   }
 
@@ -267,9 +418,44 @@ struct common_type<T, dynd::int128> : common_type<dynd::int128, T> {
 
 namespace dynd {
 
-inline int128 operator/(int128 DYND_UNUSED(lhs), int128 DYND_UNUSED(rhs))
+inline int128 operator/(const int128 &lhs, const int128 &rhs) { return lhs.divide(rhs); }
+
+/**
+ * Overflow-checked arithmetic. Each stores the wrapped result in ``out``,
+ * returning true if the exact result did not fit in an int128.
+ */
+inline bool add_overflow(const int128 &lhs, const int128 &rhs, int128 &out)
 {
-  throw std::runtime_error("operator/ is not implemented for int128");
+  out = lhs + rhs;
+  // Overflow when both operands have the same sign, and the result a different one
+  return !lhs.is_negative() == !rhs.is_negative() && !lhs.is_negative() != !out.is_negative();
+}
+
+inline bool sub_overflow(const int128 &lhs, const int128 &rhs, int128 &out)
+{
+  out = lhs - rhs;
+  return !lhs.is_negative() != !rhs.is_negative() && !lhs.is_negative() != !out.is_negative();
+}
+
+inline bool mul_overflow(const int128 &lhs, const int128 &rhs, int128 &out)
+{
+#ifdef DYND_USE_NATIVE_INT128
+  __int128 result;
+  bool overflow = __builtin_mul_overflow(lhs.native(), rhs.native(), &result);
+  out = int128::from_bits(static_cast<unsigned __int128>(result));
+  return overflow;
+#else
+  out = lhs * rhs;
+  if (!lhs || !rhs) {
+    return false;
+  }
+  // The minimum value times -1 is the one case where dividing back traps
+  const int128 min_value(0x8000000000000000ULL, 0ULL);
+  if ((lhs == -1 && rhs == min_value) || (rhs == -1 && lhs == min_value)) {
+    return true;
+  }
+  return out.divide(rhs) != lhs;
+#endif
 }
 
 inline bool operator==(int lhs, const int128 &rhs) { return rhs == lhs; }
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <dynd/callable.hpp>
 
 namespace dynd {
@@ -12,5 +14,31 @@ namespace nd {
 
   extern DYND_API callable serialize;
 
+  /**
+   * Writes an array to a binary container file. The file holds a 64-byte
+   * header, the datashape of the array, the data in its default layout
+   * starting at a 64-byte boundary, and a heap section with the elements of
+   * var dimensions and the bytes of strings.
+   *
+   * The values are written in native byte order, so the file is only read
+   * back on machines with the same byte order and pointer size.
+   *
+   * \param filename  The file to write.
+   * \param a  The array to write. Its type may be made of fixed and var
+   *           dimensions, tuples, structs, strings, bytes and POD scalars.
+   */
+  DYND_API void save_binary(const std::string &filename, const array &a);
+
+  /**
+   * Loads an array written by save_binary. The file is memory mapped, and
+   * unless the type contains strings or bytes, which own their memory, the
+   * returned array points straight at the mapped pages. In that case it is
+   * read-only and keeps the file mapped for as long as it is alive, so loading
+   * costs nothing until the data is touched.
+   *
+   * \param filename  The file to load.
+   */
+  DYND_API array load_binary(const std::string &filename);
+
 } // namespace dynd::nd
 } // namespace dynd
@@ -18,4 +18,15 @@ namespace dynd {
  */
 DYND_API nd::array format_json(const nd::array &a, bool struct_as_list = false);
 
+/**
+ * Formats the nd::array as JSON, streaming it to the output stream in
+ * blocks instead of building the whole string in memory.
+ *
+ * \param o  The stream to write the UTF-8 JSON to, e.g. an std::ofstream.
+ * \param a  The array to format as JSON.
+ * \param struct_as_list  If true, formats struct objects as lists, otherwise
+ *                        formats them as objects/dicts.
+ */
+DYND_API void format_json(std::ostream &o, const nd::array &a, bool struct_as_list = false);
+
 } // namespace dynd
@@ -147,14 +147,142 @@ namespace detail {
     DYND_END_ALLOW_INT_FLOAT_CAST
   };
 
-  template <typename Arg0Type>
-  struct inline_sqrt {
-    static auto f(Arg0Type a) { return std::sqrt(a); }
+  // float32 to the power of float32 stays in single precision
+  template <>
+  struct inline_pow<float, float> {
+    static float f(float a, float b) { return std::pow(a, b); }
   };
 
-  template <typename Arg0Type>
-  struct inline_cbrt {
-    static auto f(Arg0Type a) { return std::cbrt(a); }
+  inline float bits_to_float(int32_t bits) {
+    float res;
+    memcpy(&res, &bits, sizeof(res));
+    return res;
+  }
+
+  inline int32_t float_to_bits(float value) {
+    int32_t res;
+    memcpy(&res, &value, sizeof(res));
+    return res;
+  }
+
+  /**
+   * Single precision exp, accurate to within 1 ulp (the Cephes expf
+   * polynomial). This is the scalar reference for the SSE2 bulk version in
+   * math.cpp, the two must give identical results.
+   */
+  inline float exp_float32(float x) {
+    // Beyond these, the result is +inf or 0 anyway. NaN becomes -104, and is
+    // restored at the end
+    float xc = (x > -104.0f) ? x : -104.0f;
+    xc = (xc < 89.0f) ? xc : 89.0f;
+
+    // x = n * log(2) + r, with |r| <= log(2) / 2, rounding n with the 1.5 * 2^23 trick
+    float n = (xc * 1.44269504088896341f + 12582912.0f) - 12582912.0f;
+    float r = xc - n * 0.693359375f;
+    r = r + n * 2.12194440e-4f;
+
+    float p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    float y = p * r * r + r + 1.0f;
+
+    // Scale by 2^n in two steps, so that subnormal results and n = 128 work
+    int32_t ni = static_cast<int32_t>(n);
+    int32_t n1 = ni >> 1;
+    int32_t n2 = ni - n1;
+    y = y * bits_to_float((n1 + 127) << 23) * bits_to_float((n2 + 127) << 23);
+
+    return (x == x) ? y : x;
+  }
+
+  /**
+   * Single precision natural logarithm, accurate to within 1 ulp (the Cephes
+   * logf polynomial). Like exp_float32, it has an SSE2 bulk version.
+   */
+  inline float log_float32(float x) {
+    // Bring subnormals into the normal range
+    bool subnormal = x < 1.17549435e-38f;
+    float xs = subnormal ? x * 8388608.0f : x;
+    int32_t bits = float_to_bits(xs);
+
+    // x = m * 2^e, with sqrt(1/2) <= m < sqrt(2)
+    int32_t e = ((bits >> 23) & 0xff) - 126 - (subnormal ? 23 : 0);
+    float m = bits_to_float((bits & 0x007fffff) | 0x3f000000);
+    bool small = m < 0.707106781186547524f;
+    e = small ? e - 1 : e;
+    m = (small ? m + m : m) - 1.0f;
+
+    float z = m * m;
+    float p = 7.0376836292e-2f;
+    p = p * m - 1.1514610310e-1f;
+    p = p * m + 1.1676998740e-1f;
+    p = p * m - 1.2420140846e-1f;
+    p = p * m + 1.4249322787e-1f;
+    p = p * m - 1.6668057665e-1f;
+    p = p * m + 2.0000714765e-1f;
+    p = p * m - 2.4999993993e-1f;
+    p = p * m + 3.3333331174e-1f;
+    float fe = static_cast<float>(e);
+    float y = p * m * z - 2.12194440e-4f * fe - 0.5f * z;
+    y = (m + y) + 0.693359375f * fe;
+
+    // log(0) = -inf, log(inf) = inf, and NaN for negative values or NaN
+    y = (x == 0.0f) ? -std::numeric_limits<float>::infinity() : y;
+    y = (x == std::numeric_limits<float>::infinity()) ? x : y;
+    return (x >= 0.0f) ? y : std::numeric_limits<float>::quiet_NaN();
+  }
+
+  /**
+   * Bulk versions of exp_float32 and log_float32 over contiguous arrays,
+   * vectorized with SSE2 where available.
+   */
+  DYND_API void exp_float32(float *dst, const float *src, size_t count);
+  DYND_API void log_float32(float *dst, const float *src, size_t count);
+
+  // The unary math functions use the std overloads for real types, and the
+  // dynd overloads (found by argument-dependent lookup) for complex types.
+  // Integers are computed in double precision.
+#define DYND_DEF_UNARY_MATH_FUNC(NAME)                                                                                 \
+  template <typename Arg0Type>                                                                                         \
+  struct inline_##NAME {                                                                                               \
+    static auto f(Arg0Type a) {                                                                                        \
+      using std::NAME;                                                                                                 \
+      return NAME(a);                                                                                                  \
+    }                                                                                                                  \
+  };
+
+  DYND_DEF_UNARY_MATH_FUNC(sqrt)
+  DYND_DEF_UNARY_MATH_FUNC(cbrt)
+  DYND_DEF_UNARY_MATH_FUNC(cos)
+  DYND_DEF_UNARY_MATH_FUNC(sin)
+  DYND_DEF_UNARY_MATH_FUNC(tan)
+  DYND_DEF_UNARY_MATH_FUNC(exp)
+  DYND_DEF_UNARY_MATH_FUNC(expm1)
+  DYND_DEF_UNARY_MATH_FUNC(log)
+  DYND_DEF_UNARY_MATH_FUNC(log1p)
+  DYND_DEF_UNARY_MATH_FUNC(tanh)
+  DYND_DEF_UNARY_MATH_FUNC(erf)
+
+#undef DYND_DEF_UNARY_MATH_FUNC
+
+  // The optional contiguous() member is used by unary_math_kernel for
+  // contiguous runs
+
+  template <>
+  struct inline_exp<float> {
+    static float f(float a) { return exp_float32(a); }
+
+    static void contiguous(float *dst, const float *src, size_t count) { exp_float32(dst, src, count); }
+  };
+
+  template <>
+  struct inline_log<float> {
+    static float f(float a) { return log_float32(a); }
+
+    static void contiguous(float *dst, const float *src, size_t count) { log_float32(dst, src, count); }
   };
 
   // Arithmetic operators that need zero checking.
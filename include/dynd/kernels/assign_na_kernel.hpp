@@ -12,6 +12,29 @@
 namespace dynd {
 namespace nd {
 
+  namespace detail {
+
+    /**
+     * Fills ``count`` values of type ``ValueType`` with ``value``. The
+     * contiguous case is a plain indexed loop over a typed pointer so that
+     * the compiler can vectorize it.
+     */
+    template <typename ValueType>
+    void assign_na_strided(char *dst, intptr_t dst_stride, size_t count, ValueType value) {
+      if (dst_stride == static_cast<intptr_t>(sizeof(ValueType))) {
+        ValueType *dst_data = reinterpret_cast<ValueType *>(dst);
+        for (size_t i = 0; i != count; ++i) {
+          dst_data[i] = value;
+        }
+      } else {
+        for (size_t i = 0; i != count; ++i, dst += dst_stride) {
+          *reinterpret_cast<ValueType *>(dst) = value;
+        }
+      }
+    }
+
+  } // namespace dynd::nd::detail
+
   template <typename ReturnValueType, typename Enable = void>
   struct assign_na_kernel;
 
@@ -40,9 +63,7 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *DYND_UNUSED(src), const intptr_t *DYND_UNUSED(src_stride),
                  size_t count) {
-      for (size_t i = 0; i != count; ++i, dst += dst_stride) {
-        *reinterpret_cast<ReturnValueType *>(dst) = std::numeric_limits<ReturnValueType>::min();
-      }
+      detail::assign_na_strided<ReturnValueType>(dst, dst_stride, count, std::numeric_limits<ReturnValueType>::min());
     }
   };
 
@@ -55,9 +76,7 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *DYND_UNUSED(src), const intptr_t *DYND_UNUSED(src_stride),
                  size_t count) {
-      for (size_t i = 0; i != count; ++i, dst += dst_stride) {
-        *reinterpret_cast<ReturnValueType *>(dst) = std::numeric_limits<ReturnValueType>::max();
-      }
+      detail::assign_na_strided<ReturnValueType>(dst, dst_stride, count, std::numeric_limits<ReturnValueType>::max());
     }
   };
 
@@ -69,9 +88,7 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *DYND_UNUSED(src), const intptr_t *DYND_UNUSED(src_stride),
                  size_t count) {
-      for (size_t i = 0; i != count; ++i, dst += dst_stride) {
-        *reinterpret_cast<uint32_t *>(dst) = DYND_FLOAT32_NA_AS_UINT;
-      }
+      detail::assign_na_strided<uint32_t>(dst, dst_stride, count, DYND_FLOAT32_NA_AS_UINT);
     }
   };
 
@@ -83,9 +100,7 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *DYND_UNUSED(src), const intptr_t *DYND_UNUSED(src_stride),
                  size_t count) {
-      for (size_t i = 0; i != count; ++i, dst += dst_stride) {
-        *reinterpret_cast<uint64_t *>(dst) = DYND_FLOAT64_NA_AS_UINT;
-      }
+      detail::assign_na_strided<uint64_t>(dst, dst_stride, count, DYND_FLOAT64_NA_AS_UINT);
     }
   };
 
@@ -98,9 +113,16 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *DYND_UNUSED(src), const intptr_t *DYND_UNUSED(src_stride),
                  size_t count) {
-      for (size_t i = 0; i != count; ++i, dst += dst_stride) {
-        reinterpret_cast<uint32_t *>(dst)[0] = DYND_FLOAT32_NA_AS_UINT;
-        reinterpret_cast<uint32_t *>(dst)[1] = DYND_FLOAT32_NA_AS_UINT;
+      if (dst_stride == static_cast<intptr_t>(2 * sizeof(uint32_t))) {
+        uint32_t *dst_data = reinterpret_cast<uint32_t *>(dst);
+        for (size_t i = 0; i != 2 * count; ++i) {
+          dst_data[i] = DYND_FLOAT32_NA_AS_UINT;
+        }
+      } else {
+        for (size_t i = 0; i != count; ++i, dst += dst_stride) {
+          reinterpret_cast<uint32_t *>(dst)[0] = DYND_FLOAT32_NA_AS_UINT;
+          reinterpret_cast<uint32_t *>(dst)[1] = DYND_FLOAT32_NA_AS_UINT;
+        }
       }
     }
   };
@@ -114,9 +136,16 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *DYND_UNUSED(src), const intptr_t *DYND_UNUSED(src_stride),
                  size_t count) {
-      for (size_t i = 0; i != count; ++i, dst += dst_stride) {
-        reinterpret_cast<uint64_t *>(dst)[0] = DYND_FLOAT64_NA_AS_UINT;
-        reinterpret_cast<uint64_t *>(dst)[1] = DYND_FLOAT64_NA_AS_UINT;
+      if (dst_stride == static_cast<intptr_t>(2 * sizeof(uint64_t))) {
+        uint64_t *dst_data = reinterpret_cast<uint64_t *>(dst);
+        for (size_t i = 0; i != 2 * count; ++i) {
+          dst_data[i] = DYND_FLOAT64_NA_AS_UINT;
+        }
+      } else {
+        for (size_t i = 0; i != count; ++i, dst += dst_stride) {
+          reinterpret_cast<uint64_t *>(dst)[0] = DYND_FLOAT64_NA_AS_UINT;
+          reinterpret_cast<uint64_t *>(dst)[1] = DYND_FLOAT64_NA_AS_UINT;
+        }
       }
     }
   };
@@ -12,6 +12,7 @@
 #include <dynd/fpstatus.hpp>
 #include <dynd/kernels/base_kernel.hpp>
 #include <dynd/kernels/cuda_launch.hpp>
+#include <dynd/kernels/nontemporal_store.hpp>
 #include <dynd/kernels/tuple_assignment_kernels.hpp>
 #include <dynd/math.hpp>
 #include <dynd/option.hpp>
@@ -23,6 +24,7 @@
 #include <dynd/types/fixed_bytes_type.hpp>
 #include <dynd/types/fixed_string_type.hpp>
 #include <dynd/types/option_type.hpp>
+#include <dynd/types/scalar_kind_type.hpp>
 #include <dynd/types/type_id.hpp>
 #include <map>
 
@@ -81,6 +83,52 @@ inline void to_lower(std::string &s) {
   }
 }
 
+/**
+ * Gets the UTF-8 text of a string value, with surrounding whitespace trimmed.
+ * A ``string`` is read in place, and any other string type is converted into
+ * ``buffer`` first.
+ */
+inline void get_trimmed_utf8_range(const ndt::type &string_tp, const char *arrmeta, const char *data,
+                                   assign_error_mode error_mode, std::string &buffer, const char *&out_begin,
+                                   const char *&out_end) {
+  if (string_tp.get_id() == string_id) {
+    out_begin = reinterpret_cast<const string *>(data)->begin();
+    out_end = reinterpret_cast<const string *>(data)->end();
+  } else {
+    buffer = string_tp.extended<ndt::base_string_type>()->get_utf8_string(arrmeta, data, error_mode);
+    out_begin = buffer.data();
+    out_end = buffer.data() + buffer.size();
+  }
+  out_begin = trim_begin(out_begin, out_end);
+  out_end = trim_end(out_begin, out_end);
+}
+
+/**
+ * Calls ``parse_fn(dst, begin, end)`` on the trimmed UTF-8 text of each of
+ * ``count`` strings, as get_trimmed_utf8_range gets it. The string type is
+ * checked once for the whole run, and any conversion buffer is shared.
+ */
+template <typename ParseFn>
+inline void parse_strided_strings(const ndt::type &string_tp, const char *arrmeta, assign_error_mode error_mode,
+                                  char *dst, intptr_t dst_stride, const char *src, intptr_t src_stride, size_t count,
+                                  ParseFn parse_fn) {
+  const char *begin, *end;
+  if (string_tp.get_id() == string_id) {
+    for (size_t i = 0; i != count; ++i, dst += dst_stride, src += src_stride) {
+      begin = reinterpret_cast<const string *>(src)->begin();
+      end = reinterpret_cast<const string *>(src)->end();
+      begin = trim_begin(begin, end);
+      parse_fn(dst, begin, trim_end(begin, end));
+    }
+  } else {
+    std::string buffer;
+    for (size_t i = 0; i != count; ++i, dst += dst_stride, src += src_stride) {
+      get_trimmed_utf8_range(string_tp, arrmeta, src, error_mode, buffer, begin, end);
+      parse_fn(dst, begin, end);
+    }
+  }
+}
+
 namespace nd {
   namespace detail {
 
@@ -103,6 +151,66 @@ namespace nd {
 #pragma warning(pop)
 #endif
       }
+
+#if !DYND_ASSIGNMENT_TRACING
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#endif
+      // A contiguous run larger than the last level cache is streamed past the
+      // cache instead of evicting it
+      template <typename T = ReturnType>
+      static std::enable_if_t<is_nontemporal_storable<T>::value, bool>
+      assign_streaming(char *dst, const Arg0Type *src, size_t count) {
+        if (count * sizeof(T) < get_nontemporal_store_threshold()) {
+          return false;
+        }
+        for (size_t i = 0; i != count; ++i, dst += sizeof(T)) {
+          nontemporal_store(dst, static_cast<T>(src[i]));
+        }
+        nontemporal_store_fence();
+        return true;
+      }
+
+      template <typename T = ReturnType>
+      static std::enable_if_t<!is_nontemporal_storable<T>::value, bool>
+      assign_streaming(char *DYND_UNUSED(dst), const Arg0Type *DYND_UNUSED(src), size_t DYND_UNUSED(count)) {
+        return false;
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        const char *src0 = src[0];
+        intptr_t src0_stride = src_stride[0];
+
+        if (dst_stride == static_cast<intptr_t>(sizeof(ReturnType)) &&
+            src0_stride == static_cast<intptr_t>(sizeof(Arg0Type))) {
+          const Arg0Type *src0_values = reinterpret_cast<const Arg0Type *>(src0);
+          if (!assign_streaming(dst, src0_values, count)) {
+            ReturnType *dst_values = reinterpret_cast<ReturnType *>(dst);
+            for (size_t i = 0; i != count; ++i) {
+              dst_values[i] = static_cast<ReturnType>(src0_values[i]);
+            }
+          }
+          return;
+        }
+
+        if (src0_stride >= 64 || src0_stride <= -64) {
+          // One element per cache line, which the hardware prefetchers may not
+          // follow across pages
+          for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src0_stride) {
+            DYND_PREFETCH(src0 + DYND_PREFETCH_DISTANCE * src0_stride);
+            *reinterpret_cast<ReturnType *>(dst) = static_cast<ReturnType>(*reinterpret_cast<const Arg0Type *>(src0));
+          }
+        } else {
+          for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src0_stride) {
+            *reinterpret_cast<ReturnType *>(dst) = static_cast<ReturnType>(*reinterpret_cast<const Arg0Type *>(src0));
+          }
+        }
+      }
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#endif
     };
 
     // Complex floating point -> non-complex with no error checking
@@ -473,6 +581,68 @@ namespace nd {
       }
     };
 
+    // float16 -> float32/float64, which is always exact
+    template <typename ReturnType, assign_error_mode ErrorMode>
+    struct assignment_kernel<ReturnType, float16, ErrorMode,
+                             std::enable_if_t<std::is_same<ReturnType, float>::value ||
+                                              std::is_same<ReturnType, double>::value>>
+        : base_strided_kernel<assignment_kernel<ReturnType, float16, ErrorMode>, 1> {
+      static void convert(float *dst, const uint16_t *src, size_t count) { halfbits_to_floats(dst, src, count); }
+
+      static void convert(double *dst, const uint16_t *src, size_t count) { halfbits_to_doubles(dst, src, count); }
+
+      void single(char *dst, char *const *src) {
+        *reinterpret_cast<ReturnType *>(dst) = static_cast<ReturnType>(*reinterpret_cast<float16 *>(src[0]));
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        if (dst_stride == static_cast<intptr_t>(sizeof(ReturnType)) &&
+            src_stride[0] == static_cast<intptr_t>(sizeof(float16))) {
+          convert(reinterpret_cast<ReturnType *>(dst), reinterpret_cast<const uint16_t *>(src[0]), count);
+        } else {
+          char *src0 = src[0];
+          for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src_stride[0]) {
+            single(dst, &src0);
+          }
+        }
+      }
+    };
+
+    // float32/float64 -> float16, which raises on overflow like the float16 constructors
+    template <typename Arg0Type, assign_error_mode ErrorMode>
+    struct assignment_kernel<float16, Arg0Type, ErrorMode,
+                             std::enable_if_t<std::is_same<Arg0Type, float>::value ||
+                                              std::is_same<Arg0Type, double>::value>>
+        : base_strided_kernel<assignment_kernel<float16, Arg0Type, ErrorMode>, 1> {
+      static void convert(uint16_t *dst, const float *src, size_t count) { floats_to_halfbits(dst, src, count); }
+
+      static void convert(uint16_t *dst, const double *src, size_t count) { doubles_to_halfbits(dst, src, count); }
+
+      void single(char *dst, char *const *src) {
+        Arg0Type s = *reinterpret_cast<Arg0Type *>(src[0]);
+        float16 d(s);
+        if (ErrorMode == assign_error_inexact && s == s && static_cast<Arg0Type>(d) != s) {
+          std::stringstream ss;
+          ss << "inexact precision loss while assigning " << ndt::make_type<Arg0Type>() << " value ";
+          ss << s << " to " << ndt::make_type<float16>();
+          throw std::runtime_error(ss.str());
+        }
+        *reinterpret_cast<float16 *>(dst) = d;
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        if (ErrorMode != assign_error_inexact && dst_stride == static_cast<intptr_t>(sizeof(float16)) &&
+            src_stride[0] == static_cast<intptr_t>(sizeof(Arg0Type))) {
+          convert(reinterpret_cast<uint16_t *>(dst), reinterpret_cast<const Arg0Type *>(src[0]), count);
+        } else {
+          char *src0 = src[0];
+          for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src_stride[0]) {
+            single(dst, &src0);
+          }
+        }
+      }
+    };
+
     // Anything -> boolean with overflow checking
     template <typename Arg0Type>
     struct assignment_kernel<bool1, Arg0Type, assign_error_overflow>
@@ -834,28 +1004,71 @@ namespace nd {
     };
 
     struct DYND_API string_to_option_bool_ck : nd::base_strided_kernel<string_to_option_bool_ck, 1> {
+      std::vector<std::string> m_na_values;
+
+      string_to_option_bool_ck(const std::vector<std::string> &na_values) : m_na_values(na_values) {}
+
       void single(char *dst, char *const *src) {
         const string *std = reinterpret_cast<string *>(src[0]);
-        *reinterpret_cast<bool1 *>(dst) = parse<bool>(std->begin(), std->end());
+        if (parse_na(std->begin(), std->end(), m_na_values)) {
+          *reinterpret_cast<int8_t *>(dst) = DYND_BOOL_NA;
+        } else {
+          *reinterpret_cast<bool1 *>(dst) = parse<bool>(std->begin(), std->end());
+        }
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        const char *src0 = src[0];
+        intptr_t src0_stride = src_stride[0];
+        for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src0_stride) {
+          const string *std = reinterpret_cast<const string *>(src0);
+          if (parse_na(std->begin(), std->end(), m_na_values)) {
+            *reinterpret_cast<int8_t *>(dst) = DYND_BOOL_NA;
+          } else {
+            *reinterpret_cast<bool1 *>(dst) = parse<bool>(std->begin(), std->end());
+          }
+        }
       }
     };
 
     struct DYND_API string_to_option_number_ck : nd::base_strided_kernel<string_to_option_number_ck, 1> {
       type_id_t m_tid;
       assign_error_mode m_errmode;
+      std::vector<std::string> m_na_values;
 
       string_to_option_number_ck() {}
 
-      string_to_option_number_ck(type_id_t tid, assign_error_mode errmode) : m_tid(tid), m_errmode(errmode) {}
+      string_to_option_number_ck(type_id_t tid, assign_error_mode errmode, const std::vector<std::string> &na_values)
+          : m_tid(tid), m_errmode(errmode), m_na_values(na_values) {}
 
       void single(char *dst, char *const *src) {
         const string *std = reinterpret_cast<string *>(src[0]);
-        string_to_number(dst, m_tid, std->begin(), std->end(), m_errmode);
+        if (parse_na(std->begin(), std->end(), m_na_values)) {
+          assign_number_na(dst, m_tid);
+        } else {
+          string_to_number_value(dst, m_tid, std->begin(), std->end(), m_errmode);
+        }
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        const char *src0 = src[0];
+        intptr_t src0_stride = src_stride[0];
+        for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src0_stride) {
+          const string *std = reinterpret_cast<const string *>(src0);
+          if (parse_na(std->begin(), std->end(), m_na_values)) {
+            assign_number_na(dst, m_tid);
+          } else {
+            string_to_number_value(dst, m_tid, std->begin(), std->end(), m_errmode);
+          }
+        }
       }
     };
 
     struct DYND_API string_to_option_tp_ck : nd::base_strided_kernel<string_to_option_tp_ck, 1> {
       intptr_t m_dst_assign_na_offset;
+      std::vector<std::string> m_na_values;
+
+      string_to_option_tp_ck(const std::vector<std::string> &na_values) : m_na_values(na_values) {}
 
       ~string_to_option_tp_ck() {
         // value_assign
@@ -866,7 +1079,7 @@ namespace nd {
 
       void single(char *dst, char *const *src) {
         const string *std = reinterpret_cast<string *>(src[0]);
-        if (parse_na(std->begin(), std->end())) {
+        if (parse_na(std->begin(), std->end(), m_na_values)) {
           // It's not available, assign an NA
           kernel_prefix *dst_assign_na = get_child(m_dst_assign_na_offset);
           kernel_single_t dst_assign_na_fn = dst_assign_na->get_function<kernel_single_t>();
@@ -1008,11 +1221,13 @@ namespace nd {
       intptr_t m_src_element_size;
       next_unicode_codepoint_t m_next_fn;
       append_unicode_codepoint_t m_append_fn;
+      transcode_run_t m_run_fn;
 
       assignment_kernel(string_encoding_t dst_encoding, string_encoding_t src_encoding, intptr_t src_element_size,
                         next_unicode_codepoint_t next_fn, append_unicode_codepoint_t append_fn)
           : m_dst_encoding(dst_encoding), m_src_encoding(src_encoding), m_src_element_size(src_element_size),
-            m_next_fn(next_fn), m_append_fn(append_fn) {}
+            m_next_fn(next_fn), m_append_fn(append_fn),
+            m_run_fn(get_transcode_run_function(dst_encoding, src_encoding)) {}
 
       void single(char *dst, char *const *src) {
         dynd::string *dst_d = reinterpret_cast<dynd::string *>(dst);
@@ -1023,6 +1238,7 @@ namespace nd {
         const char *src_end = src[0] + m_src_element_size;
         next_unicode_codepoint_t next_fn = m_next_fn;
         append_unicode_codepoint_t append_fn = m_append_fn;
+        transcode_run_t run_fn = m_run_fn;
         uint32_t cp;
 
         // Allocate the initial output as the src number of characters + some padding
@@ -1032,6 +1248,12 @@ namespace nd {
 
         dst_current = dst_begin;
         while (src_begin < src_end) {
+          // Convert whole runs of valid characters directly, and only go code
+          // point by code point for what follows them
+          run_fn(src_begin, src_end, dst_current, dst_end);
+          if (src_begin == src_end) {
+            break;
+          }
           cp = next_fn(src_begin, src_end);
           // Append the codepoint, or increase the allocated memory as necessary
           if (cp != 0) {
@@ -1067,10 +1289,17 @@ namespace nd {
 
       void single(char *dst, char *const *src) {
         // Get the string from the source
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], assign_error_nocheck);
-        trim(s);
-        *reinterpret_cast<bool1 *>(dst) = parse<bool>(s.data(), s.data() + s.size(), nocheck);
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], assign_error_nocheck, buffer, begin, end);
+        *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end, nocheck);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, assign_error_nocheck, dst, dst_stride, src[0], src_stride[0],
+                              count, [](char *dst, const char *begin, const char *end) {
+                                *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end, nocheck);
+                              });
       }
     };
 
@@ -1085,10 +1314,17 @@ namespace nd {
 
       void single(char *dst, char *const *src) {
         // Get the string from the source
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], assign_error_inexact);
-        trim(s);
-        *reinterpret_cast<bool1 *>(dst) = parse<bool>(s.data(), s.data() + s.size());
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], assign_error_inexact, buffer, begin, end);
+        *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, assign_error_inexact, dst, dst_stride, src[0], src_stride[0],
+                              count, [](char *dst, const char *begin, const char *end) {
+                                *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+                              });
       }
     };
 
@@ -1103,10 +1339,17 @@ namespace nd {
 
       void single(char *dst, char *const *src) {
         // Get the string from the source
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], assign_error_default);
-        trim(s);
-        *reinterpret_cast<bool1 *>(dst) = parse<bool>(s.data(), s.data() + s.size());
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], assign_error_default, buffer, begin, end);
+        *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, assign_error_default, dst, dst_stride, src[0], src_stride[0],
+                              count, [](char *dst, const char *begin, const char *end) {
+                                *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+                              });
       }
     };
 
@@ -1121,10 +1364,17 @@ namespace nd {
 
       void single(char *dst, char *const *src) {
         // Get the string from the source
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], assign_error_overflow);
-        trim(s);
-        *reinterpret_cast<bool1 *>(dst) = parse<bool>(s.data(), s.data() + s.size());
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], assign_error_overflow, buffer, begin, end);
+        *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, assign_error_overflow, dst, dst_stride, src[0], src_stride[0],
+                              count, [](char *dst, const char *begin, const char *end) {
+                                *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+                              });
       }
     };
 
@@ -1139,10 +1389,17 @@ namespace nd {
 
       void single(char *dst, char *const *src) {
         // Get the string from the source
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], assign_error_fractional);
-        trim(s);
-        *reinterpret_cast<bool1 *>(dst) = parse<bool>(s.data(), s.data() + s.size());
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], assign_error_fractional, buffer, begin, end);
+        *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, assign_error_fractional, dst, dst_stride, src[0],
+                              src_stride[0], count, [](char *dst, const char *begin, const char *end) {
+                                *reinterpret_cast<bool1 *>(dst) = parse<bool>(begin, end);
+                              });
       }
     };
 
@@ -1159,36 +1416,74 @@ namespace nd {
                         assign_error_mode error_mode = ErrorMode)
           : src_string_tp(src_string_tp), src_arrmeta(src_arrmeta), error_mode(error_mode) {}
 
-      void single(char *dst, char *const *src) {
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], error_mode);
-        trim(s);
+      // Parses the trimmed text of one string, returning false if it overflows
+      bool parse_value(char *dst, const char *begin, const char *end) const {
         bool negative = false;
-        if (!s.empty() && s[0] == '-') {
-          s.erase(0, 1);
+        if (begin < end && *begin == '-') {
+          ++begin;
           negative = true;
         }
-        T result;
+        uint64_t value;
         if (error_mode == assign_error_nocheck) {
-          uint64_t value = parse<uint64_t>(s.data(), s.data() + s.size(), nocheck);
-          result = negative ? static_cast<T>(-static_cast<int64_t>(value)) : static_cast<T>(value);
+          value = parse<uint64_t>(begin, end, nocheck);
         } else {
-          bool overflow = false;
-          uint64_t value = parse<uint64_t>(s.data(), s.data() + s.size());
-          if (overflow || overflow_check<T>::is_overflow(value, negative)) {
-            raise_string_cast_overflow_error(ndt::make_type<T>(), src_string_tp, src_arrmeta, src[0]);
+          value = parse<uint64_t>(begin, end);
+          if (overflow_check<T>::is_overflow(value, negative)) {
+            return false;
           }
-          result = negative ? static_cast<T>(-static_cast<int64_t>(value)) : static_cast<T>(value);
         }
-        *reinterpret_cast<T *>(dst) = result;
+        *reinterpret_cast<T *>(dst) = negative ? static_cast<T>(-static_cast<int64_t>(value)) : static_cast<T>(value);
+        return true;
+      }
+
+      void single(char *dst, char *const *src) {
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], error_mode, buffer, begin, end);
+        if (!parse_value(dst, begin, end)) {
+          raise_string_cast_overflow_error(ndt::make_type<T>(), begin, end);
+        }
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, error_mode, dst, dst_stride, src[0], src_stride[0], count,
+                              [this](char *dst, const char *begin, const char *end) {
+                                if (!parse_value(dst, begin, end)) {
+                                  raise_string_cast_overflow_error(ndt::make_type<T>(), begin, end);
+                                }
+                              });
       }
     };
 
-    template <typename ReturnType>
-    struct assignment_virtual_kernel<ReturnType, string, std::enable_if_t<is_unsigned_integral<ReturnType>::value>>
-        : base_strided_kernel<assignment_virtual_kernel<ReturnType, string>, 1> {
+    template <typename ReturnType, assign_error_mode ErrorMode>
+    struct assignment_kernel<ReturnType, string, ErrorMode, std::enable_if_t<is_unsigned_integral<ReturnType>::value>>
+        : base_strided_kernel<assignment_kernel<ReturnType, string, ErrorMode>, 1> {
+      ndt::type src_string_tp;
+      const char *src_arrmeta;
+      assign_error_mode error_mode;
+
+      assignment_kernel(const ndt::type &src_string_tp, const char *src_arrmeta,
+                        assign_error_mode error_mode = ErrorMode)
+          : src_string_tp(src_string_tp), src_arrmeta(src_arrmeta), error_mode(error_mode) {}
+
+      void parse_value(char *dst, const char *begin, const char *end) const {
+        if (error_mode == assign_error_nocheck) {
+          *reinterpret_cast<ReturnType *>(dst) = parse<ReturnType>(begin, end, nocheck);
+        } else {
+          *reinterpret_cast<ReturnType *>(dst) = parse<ReturnType>(begin, end);
+        }
+      }
+
       void single(char *dst, char *const *src) {
-        *reinterpret_cast<ReturnType *>(dst) = parse<ReturnType>(*reinterpret_cast<string *>(src[0]));
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], error_mode, buffer, begin, end);
+        parse_value(dst, begin, end);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, error_mode, dst, dst_stride, src[0], src_stride[0], count,
+                              [this](char *dst, const char *begin, const char *end) { parse_value(dst, begin, end); });
       }
     };
 
@@ -1210,20 +1505,16 @@ namespace nd {
       assignment_kernel(const ndt::type &src_string_tp, const char *src_arrmeta, assign_error_mode error_mode)
           : src_string_tp(src_string_tp), src_arrmeta(src_arrmeta), error_mode(error_mode) {}
 
-      void single(char *dst, char *const *src) {
-        // Get the string from the source
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], error_mode);
-        trim(s);
-        double value = parse<double>(s.data(), s.data() + s.size());
+      void parse_value(char *dst, const char *begin, const char *end) const {
+        if (error_mode == assign_error_default || error_mode == assign_error_nocheck) {
+          // Parsing straight to float rounds once, instead of through double
+          *reinterpret_cast<float *>(dst) = parse<float>(begin, end);
+          return;
+        }
+        double value = parse<double>(begin, end);
         // Assign double -> float according to the error mode
         char *child_src[1] = {reinterpret_cast<char *>(&value)};
         switch (error_mode) {
-        case assign_error_default:
-        case assign_error_nocheck:
-          dynd::nd::detail::assignment_kernel<float, double, assign_error_nocheck>::single_wrapper(NULL, dst,
-                                                                                                   child_src);
-          break;
         case assign_error_overflow:
           dynd::nd::detail::assignment_kernel<float, double, assign_error_overflow>::single_wrapper(NULL, dst,
                                                                                                     child_src);
@@ -1240,6 +1531,19 @@ namespace nd {
           throw std::runtime_error("error");
         }
       }
+
+      void single(char *dst, char *const *src) {
+        // Get the string from the source
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], error_mode, buffer, begin, end);
+        parse_value(dst, begin, end);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, error_mode, dst, dst_stride, src[0], src_stride[0], count,
+                              [this](char *dst, const char *begin, const char *end) { parse_value(dst, begin, end); });
+      }
     };
 
     template <assign_error_mode ErrorMode>
@@ -1254,11 +1558,17 @@ namespace nd {
 
       void single(char *dst, char *const *src) {
         // Get the string from the source
-        std::string s = reinterpret_cast<const ndt::base_string_type *>(src_string_tp.extended())
-                            ->get_utf8_string(src_arrmeta, src[0], error_mode);
-        trim(s);
-        double value = parse<double>(s.data(), s.data() + s.size());
-        *reinterpret_cast<double *>(dst) = value;
+        std::string buffer;
+        const char *begin, *end;
+        get_trimmed_utf8_range(src_string_tp, src_arrmeta, src[0], error_mode, buffer, begin, end);
+        *reinterpret_cast<double *>(dst) = parse<double>(begin, end);
+      }
+
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        parse_strided_strings(src_string_tp, src_arrmeta, error_mode, dst, dst_stride, src[0], src_stride[0], count,
+                              [](char *dst, const char *begin, const char *end) {
+                                *reinterpret_cast<double *>(dst) = parse<double>(begin, end);
+                              });
       }
     };
 
@@ -1296,23 +1606,30 @@ namespace nd {
         : base_strided_kernel<assignment_kernel<ndt::fixed_string_type, ndt::fixed_string_type, ErrorMode>, 1> {
       next_unicode_codepoint_t m_next_fn;
       append_unicode_codepoint_t m_append_fn;
+      transcode_run_t m_run_fn;
       intptr_t m_dst_data_size, m_src_data_size;
       bool m_overflow_check;
 
-      assignment_kernel(next_unicode_codepoint_t next_fn, append_unicode_codepoint_t append_fn, intptr_t dst_data_size,
-                        intptr_t src_data_size, bool overflow_check)
-          : m_next_fn(next_fn), m_append_fn(append_fn), m_dst_data_size(dst_data_size), m_src_data_size(src_data_size),
-            m_overflow_check(overflow_check) {}
+      assignment_kernel(next_unicode_codepoint_t next_fn, append_unicode_codepoint_t append_fn,
+                        transcode_run_t run_fn, intptr_t dst_data_size, intptr_t src_data_size,
+                        bool overflow_check)
+          : m_next_fn(next_fn), m_append_fn(append_fn), m_run_fn(run_fn), m_dst_data_size(dst_data_size),
+            m_src_data_size(src_data_size), m_overflow_check(overflow_check) {}
 
       void single(char *dst, char *const *src) {
         char *dst_end = dst + m_dst_data_size;
         const char *src_end = src[0] + m_src_data_size;
         next_unicode_codepoint_t next_fn = m_next_fn;
         append_unicode_codepoint_t append_fn = m_append_fn;
+        transcode_run_t run_fn = m_run_fn;
         uint32_t cp = 0;
 
         char *src_copy = src[0];
         while (src_copy < src_end && dst < dst_end) {
+          run_fn(const_cast<const char *&>(src_copy), src_end, dst, dst_end);
+          if (src_copy == src_end || dst == dst_end) {
+            break;
+          }
           cp = next_fn(const_cast<const char *&>(src_copy), src_end);
           // The fixed_string type uses null-terminated strings
           if (cp == 0) {
@@ -1358,12 +1675,13 @@ namespace nd {
         : base_strided_kernel<assignment_kernel<ndt::fixed_string_type, string, ErrorMode>, 1> {
       next_unicode_codepoint_t m_next_fn;
       append_unicode_codepoint_t m_append_fn;
+      transcode_run_t m_run_fn;
       intptr_t m_dst_data_size;
       bool m_overflow_check;
 
-      assignment_kernel(next_unicode_codepoint_t next_fn, append_unicode_codepoint_t append_fn, intptr_t dst_data_size,
-                        bool overflow_check)
-          : m_next_fn(next_fn), m_append_fn(append_fn), m_dst_data_size(dst_data_size),
+      assignment_kernel(next_unicode_codepoint_t next_fn, append_unicode_codepoint_t append_fn,
+                        transcode_run_t run_fn, intptr_t dst_data_size, bool overflow_check)
+          : m_next_fn(next_fn), m_append_fn(append_fn), m_run_fn(run_fn), m_dst_data_size(dst_data_size),
             m_overflow_check(overflow_check) {}
 
       void single(char *dst, char *const *src) {
@@ -1373,9 +1691,14 @@ namespace nd {
         const char *src_end = src_d->end();
         next_unicode_codepoint_t next_fn = m_next_fn;
         append_unicode_codepoint_t append_fn = m_append_fn;
+        transcode_run_t run_fn = m_run_fn;
         uint32_t cp;
 
         while (src_begin < src_end && dst < dst_end) {
+          run_fn(src_begin, src_end, dst, dst_end);
+          if (src_begin == src_end || dst == dst_end) {
+            break;
+          }
           cp = next_fn(src_begin, src_end);
           append_fn(cp, dst, dst_end);
         }
@@ -1406,6 +1729,63 @@ namespace nd {
       }
     };
 
+    /**
+     * Assigns category values to a categorical, encoding each one with a
+     * lookup in the hash index of the categorical type. When the source is
+     * not of the category type, a child kernel first converts it into a
+     * buffer of that type.
+     */
+    template <>
+    struct assignment_virtual_kernel<ndt::categorical_type, ndt::scalar_kind_type>
+        : base_strided_kernel<assignment_virtual_kernel<ndt::categorical_type, ndt::scalar_kind_type>, 1> {
+      ndt::type m_dst_tp;
+      const ndt::categorical_type *m_dst_cat;
+      array m_buffer;
+
+      assignment_virtual_kernel(const ndt::type &dst_tp, bool convert)
+          : m_dst_tp(dst_tp), m_dst_cat(dst_tp.extended<ndt::categorical_type>()) {
+        if (convert) {
+          m_buffer = empty(m_dst_cat->get_category_type());
+        }
+      }
+
+      ~assignment_virtual_kernel() {
+        if (!m_buffer.is_null()) {
+          get_child()->destroy();
+        }
+      }
+
+      void single(char *dst, char *const *src) {
+        const char *category_data = src[0];
+        if (!m_buffer.is_null()) {
+          get_child()->single(m_buffer.data(), src);
+          category_data = m_buffer.cdata();
+        }
+        m_dst_cat->set_value(dst, m_dst_cat->get_value_from_category(m_dst_cat->get_category_arrmeta(), category_data));
+      }
+    };
+
+    /**
+     * Assigns from a categorical by assigning its category values with a
+     * child kernel.
+     */
+    template <>
+    struct assignment_virtual_kernel<ndt::scalar_kind_type, ndt::categorical_type>
+        : base_strided_kernel<assignment_virtual_kernel<ndt::scalar_kind_type, ndt::categorical_type>, 1> {
+      ndt::type m_src_tp;
+      const ndt::categorical_type *m_src_cat;
+
+      assignment_virtual_kernel(const ndt::type &src_tp)
+          : m_src_tp(src_tp), m_src_cat(src_tp.extended<ndt::categorical_type>()) {}
+
+      ~assignment_virtual_kernel() { get_child()->destroy(); }
+
+      void single(char *dst, char *const *src) {
+        char *child_src[1] = {const_cast<char *>(m_src_cat->get_category_data_from_value(m_src_cat->get_value(src[0])))};
+        get_child()->single(dst, child_src);
+      }
+    };
+
     template <>
     struct assignment_virtual_kernel<ndt::type, ndt::type>
         : base_strided_kernel<assignment_virtual_kernel<ndt::type, ndt::type>, 1> {
@@ -5,7 +5,12 @@
 
 #pragma once
 
-#include <dynd/kernels/base_kernel.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <dynd/kernels/base_strided_kernel.hpp>
 
 namespace dynd {
 namespace nd {
@@ -16,6 +21,8 @@ namespace nd {
 
     binary_search_kernel(intptr_t src0_size, intptr_t src0_stride) : src0_size(src0_size), src0_stride(src0_stride) {}
 
+    ~binary_search_kernel() { get_child()->destroy(); }
+
     void single(char *dst, char *const *src)
     {
       kernel_prefix *child = get_child();
@@ -53,5 +60,240 @@ namespace nd {
     }
   };
 
+  /**
+   * Binary search of an array of the builtin type ``T``, comparing elements
+   * directly instead of through a comparison child.
+   *
+   * A strided call that searches the same array for every value (i.e. the
+   * array is broadcast, as when binary_search is applied elementwise) is
+   * resolved as a batch, using the first of these that applies:
+   *
+   *  - a merge against the array, if the values are themselves sorted
+   *  - an interpolation search, if the keys of the array are close to uniform
+   *  - a branchless search of an Eytzinger (breadth-first) copy of the array,
+   *    if there are enough values to pay for building it
+   *  - a branchless lower bound search
+   *
+   * The batch searches return the first matching index.
+   */
+  template <typename T>
+  struct builtin_binary_search_kernel : base_strided_kernel<builtin_binary_search_kernel<T>, 2> {
+    // Arrays smaller than this are searched directly
+    static const intptr_t min_batch_size = 64;
+    // How many interpolation steps to take before finishing with a binary search
+    static const int max_interpolation_steps = 8;
+
+    const intptr_t src0_size;
+    const intptr_t src0_stride;
+    // The Eytzinger layout of the array at m_eytzinger_src, 1-based, and the
+    // original index of each element
+    const char *m_eytzinger_src;
+    std::vector<T> m_eytzinger;
+    std::vector<intptr_t> m_eytzinger_index;
+
+    builtin_binary_search_kernel(intptr_t src0_size, intptr_t src0_stride)
+        : src0_size(src0_size), src0_stride(src0_stride), m_eytzinger_src(NULL) {}
+
+    T at(const char *src0, intptr_t i) const { return *reinterpret_cast<const T *>(src0 + i * src0_stride); }
+
+    intptr_t found_or_missing(const char *src0, intptr_t i, T value) const {
+      return (i < src0_size && at(src0, i) == value) ? i : -1;
+    }
+
+    /**
+     * The first index in [first, last) whose element is not less than
+     * ``value``, or ``last``. The loop has no data-dependent branch.
+     */
+    intptr_t lower_bound(const char *src0, intptr_t first, intptr_t last, T value) const {
+      intptr_t len = last - first;
+      if (len == 0) {
+        return first;
+      }
+      while (len > 1) {
+        intptr_t half = len / 2;
+        first = (at(src0, first + half) < value) ? first + half : first;
+        len -= half;
+      }
+      return first + (at(src0, first) < value);
+    }
+
+    void single(char *dst, char *const *src) {
+      T value = *reinterpret_cast<const T *>(src[1]);
+
+      intptr_t first = 0, last = src0_size;
+      while (first < last) {
+        intptr_t trial = first + (last - first) / 2;
+        T trial_value = at(src[0], trial);
+        if (value < trial_value) {
+          last = trial;
+        } else if (trial_value < value) {
+          first = trial + 1;
+        } else {
+          *reinterpret_cast<intptr_t *>(dst) = trial;
+          return;
+        }
+      }
+
+      *reinterpret_cast<intptr_t *>(dst) = -1;
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+      if (src_stride[0] != 0 || src0_size < min_batch_size) {
+        char *src_copy[2] = {src[0], src[1]};
+        for (size_t i = 0; i != count; ++i) {
+          single(dst, src_copy);
+          dst += dst_stride;
+          src_copy[0] += src_stride[0];
+          src_copy[1] += src_stride[1];
+        }
+        return;
+      }
+
+      if (values_sorted(src[1], src_stride[1], count)) {
+        merge_search(dst, dst_stride, src[0], src[1], src_stride[1], count);
+      } else if (keys_uniform(src[0])) {
+        interpolation_search(dst, dst_stride, src[0], src[1], src_stride[1], count);
+      } else if (count >= static_cast<size_t>(src0_size / 8)) {
+        eytzinger_search(dst, dst_stride, src[0], src[1], src_stride[1], count);
+      } else {
+        const char *src1 = src[1];
+        for (size_t i = 0; i != count; ++i, dst += dst_stride, src1 += src_stride[1]) {
+          T value = *reinterpret_cast<const T *>(src1);
+          *reinterpret_cast<intptr_t *>(dst) = found_or_missing(src[0], lower_bound(src[0], 0, src0_size, value), value);
+        }
+      }
+    }
+
+    static bool values_sorted(const char *src1, intptr_t src1_stride, size_t count) {
+      for (size_t i = 1; i < count; ++i) {
+        // Written so that a NaN makes the values unsorted
+        if (!(*reinterpret_cast<const T *>(src1 + (i - 1) * src1_stride) <=
+              *reinterpret_cast<const T *>(src1 + i * src1_stride))) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    /**
+     * Whether a sample of the keys lies close to the line between the first
+     * and last keys, which is where interpolation search does well.
+     */
+    bool keys_uniform(const char *src0) const {
+      double front = static_cast<double>(at(src0, 0)), back = static_cast<double>(at(src0, src0_size - 1));
+      double span = back - front;
+      // Also rejects NaN and infinite keys
+      if (!(span > 0) || !(span < std::numeric_limits<double>::infinity())) {
+        return false;
+      }
+
+      double tolerance = static_cast<double>(src0_size) / 32;
+      for (intptr_t j = 1; j < 8; ++j) {
+        intptr_t i = (src0_size - 1) * j / 8;
+        double expected = (static_cast<double>(at(src0, i)) - front) / span * static_cast<double>(src0_size - 1);
+        if (!(std::abs(expected - static_cast<double>(i)) <= tolerance)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    void merge_search(char *dst, intptr_t dst_stride, const char *src0, const char *src1, intptr_t src1_stride,
+                      size_t count) const {
+      // Every element before pos is less than the previous value
+      intptr_t pos = 0;
+      for (size_t i = 0; i != count; ++i, dst += dst_stride, src1 += src1_stride) {
+        T value = *reinterpret_cast<const T *>(src1);
+
+        // Gallop forward from pos, then search the last step
+        intptr_t first = pos, last = pos, step = 1;
+        while (last < src0_size && at(src0, last) < value) {
+          first = last + 1;
+          last += step;
+          step *= 2;
+        }
+        pos = lower_bound(src0, first, std::min(last, src0_size), value);
+
+        *reinterpret_cast<intptr_t *>(dst) = found_or_missing(src0, pos, value);
+      }
+    }
+
+    void interpolation_search(char *dst, intptr_t dst_stride, const char *src0, const char *src1,
+                              intptr_t src1_stride, size_t count) const {
+      for (size_t i = 0; i != count; ++i, dst += dst_stride, src1 += src1_stride) {
+        T value = *reinterpret_cast<const T *>(src1);
+
+        // Every element before first is less than value, and no element from
+        // last on is
+        intptr_t first = 0, last = src0_size;
+        for (int step = 0; step < max_interpolation_steps && last - first > 16; ++step) {
+          double lo = static_cast<double>(at(src0, first)), hi = static_cast<double>(at(src0, last - 1));
+          if (!(lo < hi)) {
+            break;
+          }
+          double fraction = (static_cast<double>(value) - lo) / (hi - lo);
+          // A NaN fraction falls through to the binary search
+          if (!(fraction >= 0)) {
+            fraction = 0;
+          } else if (!(fraction <= 1)) {
+            fraction = 1;
+          }
+          intptr_t guess = first + static_cast<intptr_t>(fraction * static_cast<double>(last - 1 - first));
+          if (at(src0, guess) < value) {
+            first = guess + 1;
+          } else {
+            last = guess;
+          }
+        }
+
+        *reinterpret_cast<intptr_t *>(dst) = found_or_missing(src0, lower_bound(src0, first, last, value), value);
+      }
+    }
+
+    // Fills the Eytzinger layout with the sorted elements from index i on by
+    // an in-order walk of the implicit tree, returning the next index
+    intptr_t build_eytzinger(const char *src0, intptr_t i, intptr_t k) {
+      if (k <= src0_size) {
+        i = build_eytzinger(src0, i, 2 * k);
+        m_eytzinger[k] = at(src0, i);
+        m_eytzinger_index[k] = i++;
+        i = build_eytzinger(src0, i, 2 * k + 1);
+      }
+      return i;
+    }
+
+    void eytzinger_search(char *dst, intptr_t dst_stride, const char *src0, const char *src1, intptr_t src1_stride,
+                          size_t count) {
+      if (m_eytzinger_src != src0) {
+        m_eytzinger.resize(src0_size + 1);
+        m_eytzinger_index.resize(src0_size + 1);
+        build_eytzinger(src0, 0, 1);
+        m_eytzinger_src = src0;
+      }
+
+      const T *keys = m_eytzinger.data();
+      for (size_t i = 0; i != count; ++i, dst += dst_stride, src1 += src1_stride) {
+        T value = *reinterpret_cast<const T *>(src1);
+
+        intptr_t k = 1;
+        while (k <= src0_size) {
+#if defined(__GNUC__) || defined(__clang__)
+          // The descendants four levels down share a cache line
+          __builtin_prefetch(keys + std::min(16 * k, src0_size));
+#endif
+          k = 2 * k + (keys[k] < value);
+        }
+        // Undo the right turns taken after the last left turn, which lands on
+        // the lower bound (or zero if every element is less than value)
+        while (k & 1) {
+          k >>= 1;
+        }
+        k >>= 1;
+
+        *reinterpret_cast<intptr_t *>(dst) = (k != 0 && keys[k] == value) ? m_eytzinger_index[k] : -1;
+      }
+    }
+  };
+
 } // namespace dynd::nd
 } // namespace dynd
@@ -33,6 +33,13 @@ inline uint64_t byteswap_value(uint64_t value)
          ((value & 0xff000000000000ULL) >> 40) | (value >> 56);
 }
 
+/**
+ * Byteswaps ``count`` contiguous values of ``data_size`` bytes each. Values
+ * of 2, 4, 8 or 16 bytes are shuffled in vector registers when the CPU
+ * supports it. ``dst`` may be the same as ``src`` for an in-place swap.
+ */
+DYND_API void byteswap_contiguous(char *dst, const char *src, size_t data_size, size_t count);
+
 namespace nd {
 
   struct byteswap_ck : base_strided_kernel<byteswap_ck, 1> {
@@ -40,11 +47,11 @@ namespace nd {
 
     byteswap_ck(size_t data_size) : data_size(data_size) {}
 
-    void single(char *dst, char *const *src)
+    static void swap(char *dst, const char *src, size_t data_size)
     {
       // Do a different loop for in-place swap versus copying swap,
       // so this one kernel function works correctly for both cases.
-      if (src[0] == dst) {
+      if (src == dst) {
         // In-place swap
         for (size_t j = 0; j < data_size / 2; ++j) {
           std::swap(dst[j], dst[data_size - j - 1]);
@@ -52,10 +59,26 @@ namespace nd {
       }
       else {
         for (size_t j = 0; j < data_size; ++j) {
-          dst[j] = src[0][data_size - j - 1];
+          dst[j] = src[data_size - j - 1];
         }
       }
     }
+
+    void single(char *dst, char *const *src) { swap(dst, src[0], data_size); }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count)
+    {
+      intptr_t size = static_cast<intptr_t>(data_size);
+      if (dst_stride == size && src_stride[0] == size) {
+        byteswap_contiguous(dst, src[0], data_size, count);
+        return;
+      }
+
+      const char *src0 = src[0];
+      for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src_stride[0]) {
+        swap(dst, src0, data_size);
+      }
+    }
   };
 
   struct pairwise_byteswap_ck : base_strided_kernel<pairwise_byteswap_ck, 1> {
@@ -65,24 +88,75 @@ namespace nd {
 
     void single(char *dst, char *const *src)
     {
-      // Do a different loop for in-place swap versus copying swap,
-      // so this one kernel function works correctly for both cases.
-      if (src[0] == dst) {
-        // In-place swap
-        for (size_t j = 0; j < data_size / 4; ++j) {
-          std::swap(dst[j], dst[data_size / 2 - j - 1]);
-        }
-        for (size_t j = 0; j < data_size / 4; ++j) {
-          std::swap(dst[data_size / 2 + j], dst[data_size - j - 1]);
-        }
+      byteswap_ck::swap(dst, src[0], data_size / 2);
+      byteswap_ck::swap(dst + data_size / 2, src[0] + data_size / 2, data_size / 2);
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count)
+    {
+      intptr_t size = static_cast<intptr_t>(data_size);
+      if (dst_stride == size && src_stride[0] == size) {
+        // Contiguous pairs are contiguous values of half the size
+        byteswap_contiguous(dst, src[0], data_size / 2, 2 * count);
+        return;
       }
-      else {
-        for (size_t j = 0; j < data_size / 2; ++j) {
-          dst[j] = src[0][data_size / 2 - j - 1];
+
+      char *src0 = src[0];
+      for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src_stride[0]) {
+        single(dst, &src0);
+      }
+    }
+  };
+
+  /**
+   * Byteswaps values into a buffer and assigns them to the destination with
+   * the child kernel, a chunk at a time, so converting non-native values to
+   * a different type (e.g. big-endian int32 to native int64) is one pass over
+   * the data.
+   */
+  struct byteswap_assign_kernel : base_strided_kernel<byteswap_assign_kernel, 1> {
+    // The largest value the kernel buffers, e.g. int128
+    static const size_t max_data_size = 16;
+
+    size_t data_size;
+
+    byteswap_assign_kernel(size_t data_size) : data_size(data_size) {}
+
+    ~byteswap_assign_kernel() { get_child()->destroy(); }
+
+    void single(char *dst, char *const *src)
+    {
+      alignas(max_data_size) char value[max_data_size];
+      byteswap_ck::swap(value, src[0], data_size);
+
+      char *child_src[1] = {value};
+      get_child()->single(dst, child_src);
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count)
+    {
+      kernel_prefix *child = get_child();
+
+      alignas(max_data_size) char buffer[DYND_BUFFER_CHUNK_SIZE * max_data_size];
+      char *child_src[1] = {buffer};
+      intptr_t child_src_stride[1] = {static_cast<intptr_t>(data_size)};
+      const char *src0 = src[0];
+      while (count > 0) {
+        size_t chunk_size = std::min(count, static_cast<size_t>(DYND_BUFFER_CHUNK_SIZE));
+        if (src_stride[0] == static_cast<intptr_t>(data_size)) {
+          byteswap_contiguous(buffer, src0, data_size, chunk_size);
         }
-        for (size_t j = 0; j < data_size / 2; ++j) {
-          dst[data_size / 2 + j] = src[0][data_size - j - 1];
+        else {
+          for (size_t i = 0; i != chunk_size; ++i) {
+            byteswap_ck::swap(buffer + i * data_size, src0 + i * src_stride[0], data_size);
+          }
         }
+
+        child->strided(dst, dst_stride, child_src, child_src_stride, chunk_size);
+
+        dst += chunk_size * dst_stride;
+        src0 += chunk_size * src_stride[0];
+        count -= chunk_size;
       }
     }
   };
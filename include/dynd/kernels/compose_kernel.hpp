@@ -29,7 +29,7 @@ namespace nd {
       {
         arrmeta_holder(this->buffer_tp).swap(buffer_arrmeta);
         buffer_arrmeta.arrmeta_default_construct(true);
-        buffer_shape.push_back(DYND_BUFFER_CHUNK_SIZE);
+        buffer_shape.push_back(get_buffer_chunk_size(this->buffer_tp.get_data_size()));
       }
 
       ~compose_kernel()
@@ -58,8 +58,9 @@ namespace nd {
 
       void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count)
       {
-        // Allocate a temporary buffer on the heap
-        array buffer = empty(buffer_shape[0], buffer_tp);
+        // Allocate a temporary buffer on the heap, no bigger than needed
+        size_t max_chunk_size = std::min(count, static_cast<size_t>(buffer_shape[0]));
+        array buffer = empty(max_chunk_size, buffer_tp);
         char *buffer_data = buffer.data();
         intptr_t buffer_stride = reinterpret_cast<const fixed_dim_type_arrmeta *>(buffer.get()->metadata())->stride;
 
@@ -72,7 +73,7 @@ namespace nd {
         char *src0 = src[0];
         intptr_t src0_stride = src_stride[0];
 
-        size_t chunk_size = std::min(count, static_cast<size_t>(DYND_BUFFER_CHUNK_SIZE));
+        size_t chunk_size = std::min(count, max_chunk_size);
         first_func(first, buffer_data, buffer_stride, &src0, src_stride, chunk_size);
         second_func(second, dst, dst_stride, &buffer_data, &buffer_stride, chunk_size);
         count -= chunk_size;
@@ -80,7 +81,7 @@ namespace nd {
           src0 += chunk_size * src0_stride;
           dst += chunk_size * dst_stride;
           reset_strided_buffer_array(buffer);
-          chunk_size = std::min(count, static_cast<size_t>(DYND_BUFFER_CHUNK_SIZE));
+          chunk_size = std::min(count, max_chunk_size);
           first_func(first, buffer_data, buffer_stride, &src0, src_stride, chunk_size);
           second_func(second, dst, dst_stride, &buffer_data, &buffer_stride, chunk_size);
           count -= chunk_size;
@@ -41,12 +41,14 @@ namespace nd {
       char *m_arrmeta;
       ndt::type m_type;
       intptr_t m_stride;
+      size_t m_chunk_size;
 
       void internal_allocate()
       {
         if (m_type.get_id() != uninitialized_id) {
           m_stride = m_type.get_data_size();
-          m_storage = new char[DYND_BUFFER_CHUNK_SIZE * m_stride];
+          m_chunk_size = get_buffer_chunk_size(m_stride);
+          m_storage = new char[m_chunk_size * m_stride];
           m_arrmeta = NULL;
           size_t metasize = m_type.is_builtin() ? 0 : m_type.extended()->get_arrmeta_size();
           if (metasize != 0) {
@@ -64,19 +66,23 @@ namespace nd {
       }
 
     public:
-      buffer_storage() : m_storage(NULL), m_arrmeta(NULL), m_type() {}
+      buffer_storage() : m_storage(NULL), m_arrmeta(NULL), m_type(), m_stride(0), m_chunk_size(0) {}
 
-      buffer_storage(const buffer_storage &rhs) : m_storage(NULL), m_arrmeta(NULL), m_type(rhs.m_type)
+      buffer_storage(const buffer_storage &rhs)
+          : m_storage(NULL), m_arrmeta(NULL), m_type(rhs.m_type), m_stride(0), m_chunk_size(0)
       {
         internal_allocate();
       }
 
-      buffer_storage(const ndt::type &tp) : m_storage(NULL), m_arrmeta(NULL), m_type(tp) { internal_allocate(); }
+      buffer_storage(const ndt::type &tp) : m_storage(NULL), m_arrmeta(NULL), m_type(tp), m_stride(0), m_chunk_size(0)
+      {
+        internal_allocate();
+      }
 
       ~buffer_storage()
       {
         if (m_storage && m_type.get_flags() & type_flag_destructor) {
-          m_type.extended()->data_destruct_strided(m_arrmeta, m_storage, m_stride, DYND_BUFFER_CHUNK_SIZE);
+          m_type.extended()->data_destruct_strided(m_arrmeta, m_storage, m_stride, m_chunk_size);
         }
         delete[] m_storage;
         if (m_arrmeta) {
@@ -109,6 +115,9 @@ namespace nd {
 
       intptr_t get_stride() const { return m_stride; }
 
+      /** The number of elements the buffer holds */
+      size_t get_chunk_size() const { return m_chunk_size; }
+
       const ndt::type &get_type() const { return m_type; }
 
       char *const &get_storage() const { return m_storage; }
@@ -168,10 +177,13 @@ namespace nd {
         kernel_prefix *child = get_child();
         kernel_strided_t child_fn = child->get_function<kernel_strided_t>();
 
+        // Each chunk has to fit in all the buffers
+        size_t max_chunk_size = count;
         for (intptr_t i = 0; i < narg; ++i) {
           if (!m_bufs[i].is_null()) {
             buf_src[i] = m_bufs[i].get_storage();
             buf_stride[i] = m_bufs[i].get_stride();
+            max_chunk_size = std::min(max_chunk_size, m_bufs[i].get_chunk_size());
           }
           else {
             buf_src[i] = src[i];
@@ -180,7 +192,7 @@ namespace nd {
         }
 
         while (count > 0) {
-          size_t chunk_size = std::min(count, (size_t)DYND_BUFFER_CHUNK_SIZE);
+          size_t chunk_size = std::min(count, max_chunk_size);
           for (intptr_t i = 0; i < narg; ++i) {
             if (!m_bufs[i].is_null()) {
               m_bufs[i].reset_arrmeta();
@@ -0,0 +1,219 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <dynd/kernels/base_strided_kernel.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * The accumulator of nd::describe, laid out like its return type
+   * ``{count: int64, sum: float64, mean: float64, m2: float64, min: float64,
+   * max: float64, var: float64, stddev: float64}``. The reduction only merges
+   * count, sum, mean, m2, min and max; var and stddev are derived from them
+   * once it is done.
+   */
+  struct describe_stats {
+    int64_t count;
+    double sum;
+    double mean;
+    // The sum of squared differences from the mean
+    double m2;
+    double min;
+    double max;
+    // The sample variance and standard deviation, set by finalize and NaN
+    // with fewer than two values
+    double var;
+    double stddev;
+
+    /**
+     * Merges in the statistics of another set of values with Chan's parallel
+     * algorithm, so partial results can be combined in any order.
+     */
+    void merge(int64_t other_count, double other_sum, double other_mean, double other_m2, double other_min,
+               double other_max) {
+      if (other_count == 0) {
+        return;
+      }
+
+      int64_t total = count + other_count;
+      double delta = other_mean - mean;
+      double other_fraction = static_cast<double>(other_count) / static_cast<double>(total);
+      m2 += other_m2 + delta * delta * static_cast<double>(count) * other_fraction;
+      mean += delta * other_fraction;
+      sum += other_sum;
+      count = total;
+      if (other_min < min) {
+        min = other_min;
+      }
+      if (other_max > max) {
+        max = other_max;
+      }
+    }
+
+    void finalize() {
+      var = (count > 1) ? m2 / static_cast<double>(count - 1) : std::numeric_limits<double>::quiet_NaN();
+      stddev = std::sqrt(var);
+    }
+  };
+
+  static_assert(sizeof(describe_stats) == 64, "describe_stats must match the default layout of its struct type");
+
+  /**
+   * Writes the identity of the nd::describe reduction, the statistics of no
+   * values.
+   */
+  struct describe_init_kernel : base_strided_kernel<describe_init_kernel, 1> {
+    void single(char *dst, char *const *DYND_UNUSED(src)) {
+      describe_stats *d = reinterpret_cast<describe_stats *>(dst);
+      d->count = 0;
+      d->sum = 0.0;
+      d->mean = 0.0;
+      d->m2 = 0.0;
+      d->min = std::numeric_limits<double>::infinity();
+      d->max = -std::numeric_limits<double>::infinity();
+      d->var = std::numeric_limits<double>::quiet_NaN();
+      d->stddev = std::numeric_limits<double>::quiet_NaN();
+    }
+  };
+
+  /**
+   * Accumulates values into a describe_stats. When reducing a run into a
+   * single output (zero dst stride), the values are taken in cache-sized
+   * chunks that are converted to double once, reduced with independent
+   * accumulators the compiler can vectorize, and merged with Chan's formula.
+   * The second pass for the chunk's squared differences reads the chunk from
+   * L1, so memory is only traversed once.
+   */
+  template <typename Arg0Type>
+  struct describe_kernel : base_strided_kernel<describe_kernel<Arg0Type>, 1> {
+    static const size_t chunk_size = 512;
+    static const size_t lanes = 4;
+
+    static void merge_chunk(describe_stats *d, const double *values, size_t n) {
+      double sum[lanes] = {0.0, 0.0, 0.0, 0.0};
+      double min[lanes], max[lanes];
+      for (size_t j = 0; j != lanes; ++j) {
+        min[j] = std::numeric_limits<double>::infinity();
+        max[j] = -std::numeric_limits<double>::infinity();
+      }
+
+      size_t i = 0;
+      for (; i + lanes <= n; i += lanes) {
+        for (size_t j = 0; j != lanes; ++j) {
+          double x = values[i + j];
+          sum[j] += x;
+          min[j] = (x < min[j]) ? x : min[j];
+          max[j] = (x > max[j]) ? x : max[j];
+        }
+      }
+      for (; i != n; ++i) {
+        double x = values[i];
+        sum[0] += x;
+        min[0] = (x < min[0]) ? x : min[0];
+        max[0] = (x > max[0]) ? x : max[0];
+      }
+
+      double chunk_sum = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+      double chunk_min = std::min(std::min(min[0], min[1]), std::min(min[2], min[3]));
+      double chunk_max = std::max(std::max(max[0], max[1]), std::max(max[2], max[3]));
+      double chunk_mean = chunk_sum / static_cast<double>(n);
+
+      double m2[lanes] = {0.0, 0.0, 0.0, 0.0};
+      for (i = 0; i + lanes <= n; i += lanes) {
+        for (size_t j = 0; j != lanes; ++j) {
+          double delta = values[i + j] - chunk_mean;
+          m2[j] += delta * delta;
+        }
+      }
+      for (; i != n; ++i) {
+        double delta = values[i] - chunk_mean;
+        m2[0] += delta * delta;
+      }
+
+      d->merge(static_cast<int64_t>(n), chunk_sum, chunk_mean, (m2[0] + m2[1]) + (m2[2] + m2[3]), chunk_min,
+               chunk_max);
+    }
+
+    void single(char *dst, char *const *src) {
+      double x = static_cast<double>(*reinterpret_cast<Arg0Type *>(src[0]));
+      reinterpret_cast<describe_stats *>(dst)->merge(1, x, x, 0.0, x, x);
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+      const char *src0 = src[0];
+      intptr_t src0_stride = src_stride[0];
+      if (dst_stride != 0) {
+        for (size_t i = 0; i != count; ++i, dst += dst_stride, src0 += src0_stride) {
+          double x = static_cast<double>(*reinterpret_cast<const Arg0Type *>(src0));
+          reinterpret_cast<describe_stats *>(dst)->merge(1, x, x, 0.0, x, x);
+        }
+        return;
+      }
+
+      describe_stats *d = reinterpret_cast<describe_stats *>(dst);
+      double values[chunk_size];
+      while (count > 0) {
+        size_t n = std::min(count, chunk_size);
+        if (src0_stride == static_cast<intptr_t>(sizeof(Arg0Type))) {
+          const Arg0Type *typed_src0 = reinterpret_cast<const Arg0Type *>(src0);
+          for (size_t i = 0; i != n; ++i) {
+            values[i] = static_cast<double>(typed_src0[i]);
+          }
+        } else {
+          for (size_t i = 0; i != n; ++i) {
+            values[i] = static_cast<double>(*reinterpret_cast<const Arg0Type *>(src0 + i * src0_stride));
+          }
+        }
+        merge_chunk(d, values, n);
+
+        src0 += n * src0_stride;
+        count -= n;
+      }
+    }
+  };
+
+  /**
+   * Fills in var and stddev of a describe_stats the reduction has finished.
+   */
+  struct describe_finalize_kernel : base_strided_kernel<describe_finalize_kernel, 1> {
+    void single(char *dst, char *const *src) {
+      describe_stats *d = reinterpret_cast<describe_stats *>(dst);
+      *d = *reinterpret_cast<const describe_stats *>(src[0]);
+      d->finalize();
+    }
+  };
+
+  /**
+   * Runs the nd::describe reduction into the destination, then the finalize
+   * child over the result in place.
+   */
+  struct describe_entry_kernel : base_strided_kernel<describe_entry_kernel, 1> {
+    intptr_t finalize_offset;
+
+    ~describe_entry_kernel() {
+      get_child()->destroy();
+      get_child(finalize_offset)->destroy();
+    }
+
+    void single(char *dst, char *const *src) {
+      get_child()->single(dst, src);
+      get_child(finalize_offset)->single(dst, &dst);
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+      get_child()->strided(dst, dst_stride, src, src_stride, count);
+      get_child(finalize_offset)->strided(dst, dst_stride, &dst, &dst_stride, count);
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
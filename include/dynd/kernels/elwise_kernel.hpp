@@ -7,6 +7,7 @@
 
 #include <dynd/callable.hpp>
 #include <dynd/kernels/base_kernel.hpp>
+#include <dynd/shape_tools.hpp>
 
 namespace dynd {
 namespace nd {
@@ -44,6 +45,70 @@ namespace nd {
 
         opchild(child, dst, m_dst_stride, src, m_src_stride, m_size);
       }
+
+      /**
+       * Called by the elwise kernel of the enclosing dimension. When that
+       * dimension steps exactly over this one for every operand, the two are
+       * coalesced into one child call, otherwise the dimension with the
+       * smaller strides is run innermost. Both are skipped for stateful
+       * traits, which depend on the iteration order.
+       */
+      void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+        kernel_prefix *child = this->get_child();
+        kernel_strided_t opchild = child->get_function<kernel_strided_t>();
+
+        if (std::is_empty<TraitsType>::value) {
+          bool contiguous = dst_stride == m_dst_stride * m_size;
+          for (size_t i = 0; i < N; ++i) {
+            contiguous = contiguous && src_stride[i] == m_src_stride[i] * m_size;
+          }
+          if (contiguous) {
+            opchild(child, dst, m_dst_stride, src, m_src_stride, m_size * count);
+            return;
+          }
+
+          // Reordering is not done when the results accumulate into dst, as
+          // that would change the order of accumulation
+          if (count > 1 && m_size > 1 && dst_stride != 0 && m_dst_stride != 0) {
+            intptr_t strides[N + 1][2];
+            const intptr_t *operstrides[N + 1];
+            strides[0][0] = dst_stride;
+            strides[0][1] = m_dst_stride;
+            operstrides[0] = strides[0];
+            for (size_t i = 0; i < N; ++i) {
+              strides[i + 1][0] = src_stride[i];
+              strides[i + 1][1] = m_src_stride[i];
+              operstrides[i + 1] = strides[i + 1];
+            }
+
+            int axis_perm[2];
+            multistrides_to_axis_perm(2, N + 1, operstrides, axis_perm);
+            if (axis_perm[0] == 0) {
+              char *src_loop[N];
+              memcpy(src_loop, src, sizeof(src_loop));
+              for (intptr_t j = 0; j < m_size; ++j) {
+                opchild(child, dst, dst_stride, src_loop, src_stride, count);
+                dst += m_dst_stride;
+                for (size_t i = 0; i < N; ++i) {
+                  src_loop[i] += m_src_stride[i];
+                }
+              }
+              return;
+            }
+          }
+        }
+
+        // The traits track the state index through begin()
+        char *src_loop[N];
+        memcpy(src_loop, src, sizeof(src_loop));
+        for (auto &&it = this->begin(); it != count; ++it) {
+          opchild(child, dst, m_dst_stride, src_loop, m_src_stride, m_size);
+          dst += dst_stride;
+          for (size_t i = 0; i < N; ++i) {
+            src_loop[i] += src_stride[i];
+          }
+        }
+      }
     };
 
     template <typename TraitsType>
@@ -0,0 +1,95 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/float16.hpp>
+#include <dynd/kernels/base_strided_kernel.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * Evaluates a binary float32 child on float16 operands. Chunks of the
+   * operands are widened into float32 buffers with the bulk conversions, and
+   * if ``Narrow`` is true the float32 results are narrowed back to float16.
+   */
+  template <bool Narrow>
+  struct float16_binary_kernel : base_strided_kernel<float16_binary_kernel<Narrow>, 2> {
+    static void widen(float *dst, const char *src, intptr_t src_stride, size_t count) {
+      if (src_stride == static_cast<intptr_t>(sizeof(uint16_t))) {
+        halfbits_to_floats(dst, reinterpret_cast<const uint16_t *>(src), count);
+      } else {
+        for (size_t i = 0; i != count; ++i, src += src_stride) {
+          dst[i] = halfbits_to_float(*reinterpret_cast<const uint16_t *>(src));
+        }
+      }
+    }
+
+    static void narrow(char *dst, intptr_t dst_stride, const float *src, size_t count) {
+      if (dst_stride == static_cast<intptr_t>(sizeof(uint16_t))) {
+        floats_to_halfbits(reinterpret_cast<uint16_t *>(dst), src, count);
+      } else {
+        for (size_t i = 0; i != count; ++i, dst += dst_stride) {
+          *reinterpret_cast<uint16_t *>(dst) = float_to_halfbits(src[i]);
+        }
+      }
+    }
+
+    void single(char *dst, char *const *src) {
+      float args[2] = {halfbits_to_float(*reinterpret_cast<uint16_t *>(src[0])),
+                       halfbits_to_float(*reinterpret_cast<uint16_t *>(src[1]))};
+      char *child_src[2] = {reinterpret_cast<char *>(&args[0]), reinterpret_cast<char *>(&args[1])};
+      if (Narrow) {
+        float res;
+        this->get_child()->single(reinterpret_cast<char *>(&res), child_src);
+        *reinterpret_cast<uint16_t *>(dst) = float_to_halfbits(res);
+      } else {
+        this->get_child()->single(dst, child_src);
+      }
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+      kernel_prefix *child = this->get_child();
+
+      float args[2][DYND_BUFFER_CHUNK_SIZE];
+      float res[DYND_BUFFER_CHUNK_SIZE];
+      char *child_src[2] = {reinterpret_cast<char *>(args[0]), reinterpret_cast<char *>(args[1])};
+      // Broadcast operands are widened once and keep a zero stride
+      intptr_t child_src_stride[2];
+      const char *src_copy[2] = {src[0], src[1]};
+      for (int i = 0; i < 2; ++i) {
+        if (src_stride[i] == 0) {
+          args[i][0] = halfbits_to_float(*reinterpret_cast<const uint16_t *>(src[i]));
+          child_src_stride[i] = 0;
+        } else {
+          child_src_stride[i] = sizeof(float);
+        }
+      }
+
+      while (count > 0) {
+        size_t chunk_size = std::min(count, static_cast<size_t>(DYND_BUFFER_CHUNK_SIZE));
+        for (int i = 0; i < 2; ++i) {
+          if (src_stride[i] != 0) {
+            widen(args[i], src_copy[i], src_stride[i], chunk_size);
+            src_copy[i] += chunk_size * src_stride[i];
+          }
+        }
+
+        if (Narrow) {
+          child->strided(reinterpret_cast<char *>(res), sizeof(float), child_src, child_src_stride, chunk_size);
+          narrow(dst, dst_stride, res, chunk_size);
+        } else {
+          child->strided(dst, dst_stride, child_src, child_src_stride, chunk_size);
+        }
+
+        dst += chunk_size * dst_stride;
+        count -= chunk_size;
+      }
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <dynd/bitmap.hpp>
 #include <dynd/option.hpp>
 
 namespace dynd {
@@ -14,6 +15,12 @@ namespace nd {
   struct forward_na_kernel : base_strided_kernel<forward_na_kernel<I...>, 2> {
     size_t is_na_offset[2];
     size_t assign_na_offset;
+    // If true, the child is safe to run on NA values (e.g. floating-point
+    // arithmetic, which cannot trap), so the strided kernel runs it over the
+    // whole chunk and then patches in NA where needed
+    bool compute_through;
+
+    forward_na_kernel(bool compute_through = false) : compute_through(compute_through) {}
 
     void single(char *res, char *const *args) {
       for (intptr_t i : std::array<intptr_t, sizeof...(I)>({I...})) {
@@ -30,6 +37,56 @@ namespace nd {
       // call the actual child
       this->get_child()->single(res, args);
     }
+
+    void strided(char *res, intptr_t res_stride, char *const *args, const intptr_t *args_stride, size_t count) {
+      kernel_prefix *child = this->get_child();
+      kernel_prefix *assign_na = this->get_child(assign_na_offset);
+
+      // Process in chunks using the dynd default buffer size, building a
+      // packed NA bitmap for each chunk from the is_na children
+      bool1 is_na[DYND_BUFFER_CHUNK_SIZE];
+      bitmap::word_type na_bits[bitmap::words(DYND_BUFFER_CHUNK_SIZE)];
+      char *args_copy[2] = {args[0], args[1]};
+      char *const na_args[2] = {nullptr, nullptr};
+      const intptr_t na_args_stride[2] = {0, 0};
+      while (count > 0) {
+        size_t chunk_size = std::min(count, static_cast<size_t>(DYND_BUFFER_CHUNK_SIZE));
+        memset(na_bits, 0, sizeof(na_bits));
+        for (intptr_t i : std::array<intptr_t, sizeof...(I)>({I...})) {
+          this->get_child(is_na_offset[i])
+              ->strided(reinterpret_cast<char *>(is_na), 1, args_copy + i, args_stride + i, chunk_size);
+          bitmap::pack_or(na_bits, is_na, chunk_size);
+        }
+
+        if (compute_through) {
+          child->strided(res, res_stride, args_copy, args_stride, chunk_size);
+        }
+
+        // Alternate between runs of available values, which go to the child
+        // in one strided call, and runs of missing values, which are filled
+        // with NA in one strided call
+        size_t j = 0;
+        while (j < chunk_size) {
+          size_t na_begin = bitmap::find_set(na_bits, j, chunk_size);
+          if (na_begin > j && !compute_through) {
+            char *child_args[2] = {args_copy[0] + j * args_stride[0], args_copy[1] + j * args_stride[1]};
+            child->strided(res + j * res_stride, res_stride, child_args, args_stride, na_begin - j);
+          }
+
+          size_t na_end = bitmap::find_clear(na_bits, na_begin, chunk_size);
+          if (na_end > na_begin) {
+            assign_na->strided(res + na_begin * res_stride, res_stride, na_args, na_args_stride, na_end - na_begin);
+          }
+
+          j = na_end;
+        }
+
+        res += chunk_size * res_stride;
+        args_copy[0] += chunk_size * args_stride[0];
+        args_copy[1] += chunk_size * args_stride[1];
+        count -= chunk_size;
+      }
+    }
   };
 
 } // namespace dynd::nd
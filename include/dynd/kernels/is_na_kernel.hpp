@@ -13,6 +13,32 @@
 namespace dynd {
 namespace nd {
 
+  namespace detail {
+
+    /**
+     * Writes ``pred(value)`` for ``count`` values of type ``Arg0Type``. The
+     * contiguous case is a plain indexed loop over typed pointers so that
+     * the compiler can vectorize it.
+     */
+    template <typename Arg0Type, typename PredType>
+    void is_na_strided(char *dst, intptr_t dst_stride, const char *src0, intptr_t src0_stride, size_t count,
+                       PredType pred) {
+      if (dst_stride == 1 && src0_stride == static_cast<intptr_t>(sizeof(Arg0Type))) {
+        const Arg0Type *src0_data = reinterpret_cast<const Arg0Type *>(src0);
+        for (size_t i = 0; i != count; ++i) {
+          dst[i] = pred(src0_data[i]);
+        }
+      } else {
+        for (size_t i = 0; i != count; ++i) {
+          *dst = pred(*reinterpret_cast<const Arg0Type *>(src0));
+          dst += dst_stride;
+          src0 += src0_stride;
+        }
+      }
+    }
+
+  } // namespace dynd::nd::detail
+
   template <typename Arg0Type, typename Enable = void>
   struct is_na_kernel;
 
@@ -22,13 +48,8 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
       // Available if the value is 0 or 1
-      char *src0 = src[0];
-      intptr_t src0_stride = src_stride[0];
-      for (size_t i = 0; i != count; ++i) {
-        *dst = *reinterpret_cast<unsigned char *>(src0) > 1;
-        dst += dst_stride;
-        src0 += src0_stride;
-      }
+      detail::is_na_strided<unsigned char>(dst, dst_stride, src[0], src_stride[0], count,
+                                           [](unsigned char value) { return value > 1; });
     }
   };
 
@@ -42,13 +63,9 @@ namespace nd {
     }
 
     void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
-      char *src0 = src[0];
-      intptr_t src0_stride = src_stride[0];
-      for (size_t i = 0; i != count; ++i) {
-        *dst = *reinterpret_cast<Arg0Type *>(src0) == std::numeric_limits<Arg0Type>::min();
-        dst += dst_stride;
-        src0 += src0_stride;
-      }
+      detail::is_na_strided<Arg0Type>(dst, dst_stride, src[0], src_stride[0], count, [](Arg0Type value) {
+        return value == std::numeric_limits<Arg0Type>::min();
+      });
     }
   };
 
@@ -60,13 +77,9 @@ namespace nd {
     }
 
     void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
-      char *src0 = src[0];
-      intptr_t src0_stride = src_stride[0];
-      for (size_t i = 0; i != count; ++i) {
-        *dst = *reinterpret_cast<Arg0Type *>(src0) == std::numeric_limits<Arg0Type>::max();
-        dst += dst_stride;
-        src0 += src0_stride;
-      }
+      detail::is_na_strided<Arg0Type>(dst, dst_stride, src[0], src_stride[0], count, [](Arg0Type value) {
+        return value == std::numeric_limits<Arg0Type>::max();
+      });
     }
   };
 
@@ -78,13 +91,9 @@ namespace nd {
     void single(char *dst, char *const *src) { *dst = dynd::isnan(**reinterpret_cast<float *const *>(src)) != 0; }
 
     void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
-      char *src0 = src[0];
-      intptr_t src0_stride = src_stride[0];
-      for (size_t i = 0; i != count; ++i) {
-        *dst = dynd::isnan(*reinterpret_cast<float *>(src0)) != 0;
-        dst += dst_stride;
-        src0 += src0_stride;
-      }
+      // A NaN is the only value which compares unequal to itself
+      detail::is_na_strided<float>(dst, dst_stride, src[0], src_stride[0], count,
+                                 [](float value) { return value != value; });
     }
   };
 
@@ -96,13 +105,9 @@ namespace nd {
     void single(char *dst, char *const *src) { *dst = dynd::isnan(**reinterpret_cast<double *const *>(src)) != 0; }
 
     void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
-      char *src0 = src[0];
-      intptr_t src0_stride = src_stride[0];
-      for (size_t i = 0; i != count; ++i) {
-        *dst = dynd::isnan(*reinterpret_cast<double *>(src0)) != 0;
-        dst += dst_stride;
-        src0 += src0_stride;
-      }
+      // A NaN is the only value which compares unequal to itself
+      detail::is_na_strided<double>(dst, dst_stride, src[0], src_stride[0], count,
+                                 [](double value) { return value != value; });
     }
   };
 
@@ -116,14 +121,12 @@ namespace nd {
     }
 
     void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
-      char *src0 = src[0];
-      intptr_t src0_stride = src_stride[0];
-      for (size_t i = 0; i != count; ++i) {
-        *dst = reinterpret_cast<uint32_t *>(src0)[0] == DYND_FLOAT32_NA_AS_UINT &&
-               reinterpret_cast<uint32_t *>(src0)[1] == DYND_FLOAT32_NA_AS_UINT;
-        dst += dst_stride;
-        src0 += src0_stride;
-      }
+      detail::is_na_strided<complex<float>>(dst, dst_stride, src[0], src_stride[0], count,
+                                            [](const complex<float> &value) {
+                                              const uint32_t *bits = reinterpret_cast<const uint32_t *>(&value);
+                                              return bits[0] == DYND_FLOAT32_NA_AS_UINT &&
+                                                     bits[1] == DYND_FLOAT32_NA_AS_UINT;
+                                            });
     }
   };
 
@@ -137,15 +140,12 @@ namespace nd {
     }
 
     void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
-      // Available if the value is 0 or 1
-      char *src0 = src[0];
-      intptr_t src0_stride = src_stride[0];
-      for (size_t i = 0; i != count; ++i) {
-        *dst = reinterpret_cast<uint64_t *>(src0)[0] == DYND_FLOAT64_NA_AS_UINT &&
-               reinterpret_cast<uint64_t *>(src0)[1] == DYND_FLOAT64_NA_AS_UINT;
-        dst += dst_stride;
-        src0 += src0_stride;
-      }
+      detail::is_na_strided<complex<double>>(dst, dst_stride, src[0], src_stride[0], count,
+                                             [](const complex<double> &value) {
+                                               const uint64_t *bits = reinterpret_cast<const uint64_t *>(&value);
+                                               return bits[0] == DYND_FLOAT64_NA_AS_UINT &&
+                                                      bits[1] == DYND_FLOAT64_NA_AS_UINT;
+                                             });
     }
   };
 
@@ -155,9 +155,13 @@ namespace nd {
 
     void strided(char *dst, intptr_t dst_stride, char *const *DYND_UNUSED(src), const intptr_t *DYND_UNUSED(src_stride),
                  size_t count) {
-      for (size_t i = 0; i != count; ++i) {
-        *dst = 1;
-        dst += dst_stride;
+      if (dst_stride == 1) {
+        memset(dst, 1, count);
+      } else {
+        for (size_t i = 0; i != count; ++i) {
+          *dst = 1;
+          dst += dst_stride;
+        }
       }
     }
   };
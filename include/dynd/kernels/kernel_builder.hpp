@@ -28,6 +28,13 @@ namespace nd {
   public:
     kernel_builder(call_node *call = nullptr) : m_call(call) {}
 
+    /**
+     * Starts with room for ``size_hint`` bytes of kernels, e.g. the estimate
+     * from ``call_graph::kernel_size_hint``.
+     */
+    kernel_builder(call_node *call, size_t size_hint)
+        : storagebuf<kernel_prefix, kernel_builder>(size_hint), m_call(call) {}
+
     DYND_API void destroy();
 
     ~kernel_builder() { destroy(); }
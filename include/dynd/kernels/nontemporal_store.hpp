@@ -0,0 +1,60 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include <dynd/config.hpp>
+
+#if (defined(__x86_64__) || defined(_M_X64)) && !defined(__CUDA_ARCH__)
+#define DYND_HAS_NONTEMPORAL_STORE 1
+#include <emmintrin.h>
+#endif
+
+namespace dynd {
+
+/**
+ * Whether values of type T can be written with nontemporal_store.
+ */
+template <typename T>
+struct is_nontemporal_storable
+    : std::integral_constant<bool, std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)> {
+};
+
+/**
+ * Stores ``value`` to ``dst`` bypassing the cache where the platform supports
+ * it, otherwise a regular store. A run of these must be followed by
+ * nontemporal_store_fence before the data is read by another thread.
+ */
+template <typename T>
+inline void nontemporal_store(char *dst, T value) {
+  static_assert(is_nontemporal_storable<T>::value, "nontemporal_store requires a 4 or 8 byte arithmetic type");
+#ifdef DYND_HAS_NONTEMPORAL_STORE
+  if (sizeof(T) == 4) {
+    int bits;
+    memcpy(&bits, &value, 4);
+    _mm_stream_si32(reinterpret_cast<int *>(dst), bits);
+  } else {
+    long long bits;
+    memcpy(&bits, &value, 8);
+    _mm_stream_si64(reinterpret_cast<long long *>(dst), bits);
+  }
+#else
+  memcpy(dst, &value, sizeof(T));
+#endif
+}
+
+/**
+ * Orders preceding non-temporal stores before any following stores.
+ */
+inline void nontemporal_store_fence() {
+#ifdef DYND_HAS_NONTEMPORAL_STORE
+  _mm_sfence();
+#endif
+}
+
+} // namespace dynd
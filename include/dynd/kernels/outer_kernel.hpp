@@ -15,6 +15,9 @@ namespace nd {
     size_t dst_size;
     intptr_t dst_stride;
     intptr_t src_stride[NArg];
+    // The number of elements of this dimension processed for all the rows of
+    // the enclosing dimension before moving on
+    size_t tile_size;
 
     outer_kernel(size_t i, const char *dst_metadata, const char *const *src_metadata)
         : dst_size(reinterpret_cast<const size_stride_t *>(dst_metadata)->dim_size),
@@ -26,6 +29,10 @@ namespace nd {
       for (size_t j = i + 1; j < NArg; ++j) {
         src_stride[j] = 0;
       }
+
+      size_t element_bytes = static_cast<size_t>(src_stride[i] < 0 ? -src_stride[i] : src_stride[i]);
+      tile_size = std::max(DYND_OUTER_TILE_BYTES / std::max(element_bytes, static_cast<size_t>(1)),
+                           static_cast<size_t>(1));
     }
 
     ~outer_kernel() { this->get_child()->destroy(); }
@@ -35,6 +42,46 @@ namespace nd {
 
       child->strided(dst, dst_stride, src, src_stride, dst_size);
     }
+
+    /**
+     * Called by the outer kernel of the enclosing dimension with one row per
+     * element of count. If this dimension is too large to stay in cache from
+     * one row to the next, it is split into tiles, and each tile is applied
+     * to all the rows before moving on to the next one.
+     */
+    void strided(char *dst, intptr_t row_dst_stride, char *const *src, const intptr_t *row_src_stride,
+                 size_t count) {
+      kernel_prefix *child = this->get_child();
+
+      if (count <= 1 || dst_size <= tile_size || row_dst_stride == 0 || dst_stride == 0) {
+        char *src_row[NArg];
+        memcpy(src_row, src, sizeof(src_row));
+        for (size_t r = 0; r < count; ++r) {
+          child->strided(dst, dst_stride, src_row, src_stride, dst_size);
+          dst += row_dst_stride;
+          for (size_t j = 0; j < NArg; ++j) {
+            src_row[j] += row_src_stride[j];
+          }
+        }
+        return;
+      }
+
+      for (size_t begin = 0; begin < dst_size; begin += tile_size) {
+        size_t size = std::min(tile_size, dst_size - begin);
+        char *dst_tile = dst + begin * dst_stride;
+        char *src_tile[NArg];
+        for (size_t j = 0; j < NArg; ++j) {
+          src_tile[j] = src[j] + begin * src_stride[j];
+        }
+        for (size_t r = 0; r < count; ++r) {
+          child->strided(dst_tile, dst_stride, src_tile, src_stride, size);
+          dst_tile += row_dst_stride;
+          for (size_t j = 0; j < NArg; ++j) {
+            src_tile[j] += row_src_stride[j];
+          }
+        }
+      }
+    }
   };
 
   template <>
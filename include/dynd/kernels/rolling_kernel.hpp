@@ -0,0 +1,256 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <dynd/kernels/base_strided_kernel.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * The type a rolling sum over ``T`` accumulates and returns. Integers are
+   * widened to 64 bits, so sums of small integers do not overflow.
+   */
+  template <typename T, typename Enable = void>
+  struct rolling_sum_result {
+    typedef T type;
+  };
+
+  template <typename T>
+  struct rolling_sum_result<T, std::enable_if_t<std::is_integral<T>::value && std::is_signed<T>::value>> {
+    typedef int64_t type;
+  };
+
+  template <typename T>
+  struct rolling_sum_result<T, std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value>> {
+    typedef uint64_t type;
+  };
+
+  /**
+   * Running sum over a sliding window, adding the element entering the
+   * window and subtracting the one leaving it.
+   */
+  template <typename T>
+  struct rolling_int_sum_window {
+    typedef typename rolling_sum_result<T>::type result_type;
+
+    static const bool uses_deque = false;
+
+    static void run(char *dst, intptr_t dst_stride, const char *src, intptr_t src_stride, intptr_t size,
+                    intptr_t window, intptr_t boundary_size, intptr_t *DYND_UNUSED(deque)) {
+      result_type acc = 0;
+      intptr_t i = 0;
+      // The window is still growing
+      for (; i < boundary_size; ++i) {
+        acc += *reinterpret_cast<const T *>(src + i * src_stride);
+        *reinterpret_cast<result_type *>(dst + i * dst_stride) = acc;
+      }
+      // The window is full
+      for (; i < size; ++i) {
+        acc += *reinterpret_cast<const T *>(src + i * src_stride);
+        acc -= *reinterpret_cast<const T *>(src + (i - window) * src_stride);
+        *reinterpret_cast<result_type *>(dst + i * dst_stride) = acc;
+      }
+    }
+  };
+
+  /**
+   * The floating-point running sum accumulates the finite values in double
+   * precision with Neumaier compensation, so the rounding errors of the
+   * additions and subtractions do not pile up along the row. Infinities and
+   * NaNs are counted instead of added, so the sum recovers once they leave the
+   * window. If the finite values themselves overflow, the window is summed
+   * again from scratch.
+   */
+  template <typename T>
+  struct rolling_float_sum_window {
+    typedef T result_type;
+
+    static const bool uses_deque = false;
+
+    struct state {
+      double acc = 0, compensation = 0;
+      intptr_t nan_count = 0, pos_inf_count = 0, neg_inf_count = 0;
+
+      void add(double value, intptr_t sign) {
+        if (std::isnan(value)) {
+          nan_count += sign;
+        } else if (std::isinf(value)) {
+          ((value > 0) ? pos_inf_count : neg_inf_count) += sign;
+        } else {
+          value = sign * value;
+          double t = acc + value;
+          if (std::abs(acc) >= std::abs(value)) {
+            compensation += (acc - t) + value;
+          } else {
+            compensation += (value - t) + acc;
+          }
+          acc = t;
+        }
+      }
+
+      double value() const {
+        if (nan_count > 0 || (pos_inf_count > 0 && neg_inf_count > 0)) {
+          return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (pos_inf_count > 0) {
+          return std::numeric_limits<double>::infinity();
+        }
+        if (neg_inf_count > 0) {
+          return -std::numeric_limits<double>::infinity();
+        }
+        // The finite values overflowed, so there is nothing left to compensate
+        return std::isfinite(acc) ? acc + compensation : acc;
+      }
+    };
+
+    static void run(char *dst, intptr_t dst_stride, const char *src, intptr_t src_stride, intptr_t size,
+                    intptr_t window, intptr_t boundary_size, intptr_t *DYND_UNUSED(deque)) {
+      state st;
+      intptr_t i = 0;
+      // The window is still growing
+      for (; i < boundary_size; ++i) {
+        st.add(*reinterpret_cast<const T *>(src + i * src_stride), 1);
+        *reinterpret_cast<T *>(dst + i * dst_stride) = static_cast<T>(st.value());
+      }
+      // The window is full
+      for (; i < size; ++i) {
+        st.add(*reinterpret_cast<const T *>(src + i * src_stride), 1);
+        st.add(*reinterpret_cast<const T *>(src + (i - window) * src_stride), -1);
+        if (!std::isfinite(st.acc) || !std::isfinite(st.compensation)) {
+          st.acc = st.compensation = 0;
+          for (intptr_t j = i - window + 1; j <= i; ++j) {
+            double value = *reinterpret_cast<const T *>(src + j * src_stride);
+            if (std::isfinite(value)) {
+              st.add(value, 1);
+            }
+          }
+        }
+        *reinterpret_cast<T *>(dst + i * dst_stride) = static_cast<T>(st.value());
+      }
+    }
+  };
+
+  template <typename T>
+  using rolling_sum_window =
+      std::conditional_t<std::is_floating_point<T>::value, rolling_float_sum_window<T>, rolling_int_sum_window<T>>;
+
+  /**
+   * Running extremum over a sliding window, with a monotonic deque of the
+   * indices of the candidates. ``Keep(a, b)`` is true if an earlier ``a``
+   * stays a candidate once ``b`` enters the window.
+   *
+   * A NaN propagates: it stays a candidate over every later value and drops
+   * every earlier one, so each window that contains a NaN yields NaN, as
+   * with an elementwise ``fmax`` that does not skip NaNs.
+   */
+  template <typename T, bool Max>
+  struct rolling_extremum_window {
+    typedef T result_type;
+
+    static const bool uses_deque = true;
+
+    // Only a NaN compares unequal to itself, so this is false for integers
+    static bool is_nan(T x) { return x != x; }
+
+    static bool keep(T a, T b) { return !is_nan(b) && (is_nan(a) || (Max ? (a > b) : (a < b))); }
+
+    // The deque is a ring buffer of ``window`` indices
+    static void run(char *dst, intptr_t dst_stride, const char *src, intptr_t src_stride, intptr_t size,
+                    intptr_t window, intptr_t boundary_size, intptr_t *deque) {
+      intptr_t head = 0, count = 0;
+      auto push = [&](intptr_t i) {
+        T value = *reinterpret_cast<const T *>(src + i * src_stride);
+        while (count > 0) {
+          intptr_t back = head + count - 1;
+          back = (back >= window) ? back - window : back;
+          if (keep(*reinterpret_cast<const T *>(src + deque[back] * src_stride), value)) {
+            break;
+          }
+          --count;
+        }
+        intptr_t tail = head + count;
+        deque[(tail >= window) ? tail - window : tail] = i;
+        ++count;
+        *reinterpret_cast<T *>(dst + i * dst_stride) = *reinterpret_cast<const T *>(src + deque[head] * src_stride);
+      };
+
+      intptr_t i = 0;
+      // The window is still growing
+      for (; i < boundary_size; ++i) {
+        push(i);
+      }
+      // The window is full, so the oldest candidate may leave it
+      for (; i < size; ++i) {
+        if (count > 0 && deque[head] <= i - window) {
+          head = (head + 1 == window) ? 0 : head + 1;
+          --count;
+        }
+        push(i);
+      }
+    }
+  };
+
+  template <typename T>
+  using rolling_min_window = rolling_extremum_window<T, false>;
+
+  template <typename T>
+  using rolling_max_window = rolling_extremum_window<T, true>;
+
+  /**
+   * Applies a sliding window along the last dimension of an array of fixed
+   * dimensions. Element i of the result covers the input elements
+   * (i - window, i], so the first ``window - 1`` outputs of each row cover a
+   * partial window. The extent of that boundary region is computed once here,
+   * and each row then runs with no per-element bounds checks.
+   *
+   * The vectors are owned by the kernel: the destructor installed by
+   * base_kernel runs ~rolling_kernel when the kernel is destroyed.
+   */
+  template <typename WindowType>
+  struct rolling_kernel : base_strided_kernel<rolling_kernel<WindowType>, 1> {
+    intptr_t window;
+    intptr_t boundary_size;
+    std::vector<intptr_t> shape, dst_stride, src_stride;
+    std::vector<intptr_t> deque;
+
+    rolling_kernel(intptr_t window, intptr_t ndim, const char *dst_arrmeta, const char *src_arrmeta)
+        : window(window), shape(ndim), dst_stride(ndim), src_stride(ndim) {
+      for (intptr_t i = 0; i < ndim; ++i) {
+        const size_stride_t *dst_md = reinterpret_cast<const size_stride_t *>(dst_arrmeta) + i;
+        const size_stride_t *src_md = reinterpret_cast<const size_stride_t *>(src_arrmeta) + i;
+        shape[i] = src_md->dim_size;
+        dst_stride[i] = dst_md->stride;
+        src_stride[i] = src_md->stride;
+      }
+      // No element leaves the window before index ``window``
+      boundary_size = std::min(window, shape.back());
+      if (WindowType::uses_deque) {
+        deque.resize(window);
+      }
+    }
+
+    void apply(size_t dim, char *dst, const char *src) {
+      if (dim + 1 == shape.size()) {
+        WindowType::run(dst, dst_stride[dim], src, src_stride[dim], shape[dim], window, boundary_size, deque.data());
+        return;
+      }
+
+      for (intptr_t i = 0; i < shape[dim]; ++i) {
+        apply(dim + 1, dst + i * dst_stride[dim], src + i * src_stride[dim]);
+      }
+    }
+
+    void single(char *dst, char *const *src) { apply(0, dst, src[0]); }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
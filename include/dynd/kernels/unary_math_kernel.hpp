@@ -0,0 +1,61 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <dynd/kernels/base_strided_kernel.hpp>
+
+namespace dynd {
+namespace nd {
+  namespace detail {
+
+    // Uses FuncType::contiguous if it is defined, otherwise a plain loop over f
+    template <typename FuncType, typename DstType, typename Arg0Type>
+    auto unary_math_contiguous(int DYND_UNUSED(a), DstType *dst, const Arg0Type *src, size_t count)
+        -> decltype(FuncType::contiguous(dst, src, count)) {
+      return FuncType::contiguous(dst, src, count);
+    }
+
+    template <typename FuncType, typename DstType, typename Arg0Type>
+    void unary_math_contiguous(long DYND_UNUSED(a), DstType *dst, const Arg0Type *src, size_t count) {
+      for (size_t i = 0; i < count; ++i) {
+        dst[i] = FuncType::f(src[i]);
+      }
+    }
+
+  } // namespace dynd::nd::detail
+
+  /**
+   * Applies FuncType<Arg0Type>::f elementwise. Contiguous runs go to a bulk
+   * FuncType<Arg0Type>::contiguous where there is one, otherwise to a plain
+   * loop over typed pointers.
+   */
+  template <template <typename> class FuncType, typename Arg0Type>
+  struct unary_math_kernel : base_strided_kernel<unary_math_kernel<FuncType, Arg0Type>, 1> {
+    typedef decltype(FuncType<Arg0Type>::f(std::declval<Arg0Type>())) dst_type;
+
+    void single(char *dst, char *const *src) {
+      *reinterpret_cast<dst_type *>(dst) = FuncType<Arg0Type>::f(*reinterpret_cast<Arg0Type *>(src[0]));
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+      const char *src0 = src[0];
+      intptr_t src0_stride = src_stride[0];
+      if (dst_stride == static_cast<intptr_t>(sizeof(dst_type)) &&
+          src0_stride == static_cast<intptr_t>(sizeof(Arg0Type))) {
+        detail::unary_math_contiguous<FuncType<Arg0Type>>(0, reinterpret_cast<dst_type *>(dst),
+                                                          reinterpret_cast<const Arg0Type *>(src0), count);
+      } else {
+        for (size_t i = 0; i < count; ++i) {
+          *reinterpret_cast<dst_type *>(dst) = FuncType<Arg0Type>::f(*reinterpret_cast<const Arg0Type *>(src0));
+          dst += dst_stride;
+          src0 += src0_stride;
+        }
+      }
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
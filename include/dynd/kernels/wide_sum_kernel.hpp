@@ -0,0 +1,155 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#include <dynd/kernels/base_strided_kernel.hpp>
+
+namespace dynd {
+namespace nd {
+
+  /**
+   * The 128-bit integer nd::wide_sum accumulates an integer type into, int128
+   * for the signed types and uint128 for the unsigned ones.
+   */
+  template <typename Arg0Type>
+  using wide_sum_type = typename std::conditional<std::is_signed<Arg0Type>::value, int128, uint128>::type;
+
+  /**
+   * Sums a run of integers exactly. Types narrower than 64 bits are first summed
+   * into a 64-bit integer in blocks small enough that it can't overflow, so the
+   * 128-bit addition is only done once per block.
+   */
+  template <typename Arg0Type>
+  wide_sum_type<Arg0Type> wide_sum_run(const char *src0, intptr_t src0_stride, size_t count) {
+    typedef wide_sum_type<Arg0Type> accum_type;
+    typedef typename std::conditional<std::is_signed<Arg0Type>::value, int64_t, uint64_t>::type block_type;
+
+    accum_type sum = accum_type(0);
+    if (sizeof(Arg0Type) < sizeof(block_type)) {
+      const size_t block_size = static_cast<size_t>(1) << 31;
+      while (count > 0) {
+        size_t n = std::min(count, block_size);
+        block_type block_sum = 0;
+        if (src0_stride == static_cast<intptr_t>(sizeof(Arg0Type))) {
+          const Arg0Type *typed_src0 = reinterpret_cast<const Arg0Type *>(src0);
+          for (size_t i = 0; i != n; ++i) {
+            block_sum += typed_src0[i];
+          }
+        } else {
+          for (size_t i = 0; i != n; ++i) {
+            block_sum += *reinterpret_cast<const Arg0Type *>(src0 + i * src0_stride);
+          }
+        }
+        sum += accum_type(block_sum);
+        src0 += n * src0_stride;
+        count -= n;
+      }
+    } else {
+      for (size_t i = 0; i != count; ++i, src0 += src0_stride) {
+        sum += accum_type(*reinterpret_cast<const Arg0Type *>(src0));
+      }
+    }
+
+    return sum;
+  }
+
+  /**
+   * Writes the identity of the nd::wide_sum reduction, a zero of either 128-bit
+   * integer.
+   */
+  struct wide_sum_init_kernel : base_strided_kernel<wide_sum_init_kernel, 1> {
+    void single(char *dst, char *const *DYND_UNUSED(src)) {
+      static_assert(sizeof(int128) == sizeof(uint128), "both accumulators must be zeroed the same way");
+      *reinterpret_cast<int128 *>(dst) = int128(0);
+    }
+  };
+
+  template <typename Arg0Type>
+  struct wide_sum_kernel : base_strided_kernel<wide_sum_kernel<Arg0Type>, 1> {
+    typedef wide_sum_type<Arg0Type> dst_type;
+
+    void single(char *dst, char *const *src) {
+      *reinterpret_cast<dst_type *>(dst) += dst_type(*reinterpret_cast<Arg0Type *>(src[0]));
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+      if (dst_stride == 0) {
+        *reinterpret_cast<dst_type *>(dst) += wide_sum_run<Arg0Type>(src[0], src_stride[0], count);
+        return;
+      }
+
+      char *src0 = src[0];
+      intptr_t src0_stride = src_stride[0];
+      for (size_t i = 0; i < count; ++i) {
+        *reinterpret_cast<dst_type *>(dst) += dst_type(*reinterpret_cast<Arg0Type *>(src0));
+        dst += dst_stride;
+        src0 += src0_stride;
+      }
+    }
+  };
+
+  /**
+   * The accumulator of nd::wide_mean, laid out like its return type
+   * ``{sum: int128, count: int64, mean: float64}``. The sum stays exact, and
+   * the mean divides its correctly rounded float64 value by the count.
+   */
+  struct wide_mean_stats {
+    int128 sum;
+    int64_t count;
+    double mean;
+
+    void merge(const int128 &other_sum, int64_t other_count) {
+      sum += other_sum;
+      count += other_count;
+      mean = static_cast<double>(sum) / static_cast<double>(count);
+    }
+  };
+
+  static_assert(sizeof(wide_mean_stats) == 32, "wide_mean_stats must match the default layout of its struct type");
+
+  /**
+   * Writes the identity of the nd::wide_mean reduction, the mean of no values.
+   */
+  struct wide_mean_init_kernel : base_strided_kernel<wide_mean_init_kernel, 1> {
+    void single(char *dst, char *const *DYND_UNUSED(src)) {
+      wide_mean_stats *d = reinterpret_cast<wide_mean_stats *>(dst);
+      d->sum = int128(0);
+      d->count = 0;
+      d->mean = std::numeric_limits<double>::quiet_NaN();
+    }
+  };
+
+  template <typename Arg0Type>
+  struct wide_mean_kernel : base_strided_kernel<wide_mean_kernel<Arg0Type>, 1> {
+    void single(char *dst, char *const *src) {
+      reinterpret_cast<wide_mean_stats *>(dst)->merge(int128(*reinterpret_cast<Arg0Type *>(src[0])), 1);
+    }
+
+    void strided(char *dst, intptr_t dst_stride, char *const *src, const intptr_t *src_stride, size_t count) {
+      if (dst_stride == 0) {
+        if (count != 0) {
+          reinterpret_cast<wide_mean_stats *>(dst)->merge(int128(wide_sum_run<Arg0Type>(src[0], src_stride[0], count)),
+                                                          static_cast<int64_t>(count));
+        }
+        return;
+      }
+
+      char *src0 = src[0];
+      intptr_t src0_stride = src_stride[0];
+      for (size_t i = 0; i < count; ++i) {
+        reinterpret_cast<wide_mean_stats *>(dst)->merge(int128(*reinterpret_cast<Arg0Type *>(src0)), 1);
+        dst += dst_stride;
+        src0 += src0_stride;
+      }
+    }
+  };
+
+} // namespace dynd::nd
+} // namespace dynd
@@ -366,6 +366,11 @@ namespace nd {
   extern DYND_API callable sin;
   extern DYND_API callable tan;
   extern DYND_API callable exp;
+  extern DYND_API callable expm1;
+  extern DYND_API callable log;
+  extern DYND_API callable log1p;
+  extern DYND_API callable tanh;
+  extern DYND_API callable erf;
 
   extern DYND_API callable real;
   extern DYND_API callable imag;
@@ -30,6 +30,31 @@ namespace nd {
     default_access_flags = read_access_flag | write_access_flag,
   };
 
+  /**
+   * Allocation counters for the buffer memory block pools of the calling
+   * thread. A hit reuses a freed block of the same size class, a miss
+   * allocates a new one, and large blocks bypass the pools.
+   */
+  struct buffer_pool_stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t large;
+  };
+
+  /**
+   * Allocates memory for a buffer memory block. Blocks up to 8 KiB come from
+   * per-thread free lists with power-of-two size classes. Larger ones are
+   * placed so that the array data, ``data_offset`` bytes into the block, is
+   * aligned to DYND_BUFFER_LARGE_ALIGNMENT.
+   */
+  DYNDT_API void *buffer_pool_allocate(size_t size, size_t data_offset = 0);
+
+  /** Frees memory from buffer_pool_allocate, possibly keeping it for reuse */
+  DYNDT_API void buffer_pool_free(void *ptr);
+
+  /** Returns the pool counters of the calling thread */
+  DYNDT_API buffer_pool_stats get_buffer_pool_stats();
+
   /**
    * This structure is the start of any nd::array arrmeta. The
    * arrmeta after this structure is determined by the type
@@ -109,11 +134,20 @@ namespace nd {
       o << indent << "------" << std::endl;
     }
 
-    static void *operator new(size_t size, size_t extra_size) { return ::operator new(size + extra_size); }
+    static void *operator new(size_t size, size_t extra_size) { return buffer_pool_allocate(size + extra_size); }
+
+    /** Allocates a block holding its data at ``data_offset`` */
+    static void *operator new(size_t size, size_t extra_size, size_t data_offset) {
+      return buffer_pool_allocate(size + extra_size, data_offset);
+    }
+
+    static void operator delete(void *ptr) { return buffer_pool_free(ptr); }
 
-    static void operator delete(void *ptr) { return ::operator delete(ptr); }
+    static void operator delete(void *ptr, size_t DYND_UNUSED(extra_size)) { return buffer_pool_free(ptr); }
 
-    static void operator delete(void *ptr, size_t DYND_UNUSED(extra_size)) { return ::operator delete(ptr); }
+    static void operator delete(void *ptr, size_t DYND_UNUSED(extra_size), size_t DYND_UNUSED(data_offset)) {
+      return buffer_pool_free(ptr);
+    }
 
     friend class buffer;
 
@@ -29,7 +29,7 @@ namespace nd {
       ndt::type dst_tp2 = ret_tp;
       char *args_data[2] = {reinterpret_cast<char *>(&begin), reinterpret_cast<char *>(&end)};
       nd::array ret =
-          dynamic_parse->call(dst_tp2, 0, nullptr, nullptr, args_data, 0, nullptr, std::map<std::string, ndt::type>());
+          dynamic_parse->call(dst_tp2, 0, nullptr, nullptr, args_data, 0, nullptr, ndt::typevar_map());
 
       skip_whitespace(begin, end);
       if (begin != end) {
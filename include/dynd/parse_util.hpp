@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <clocale>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <dynd/config.hpp>
 #include <dynd/string_encodings.hpp>
@@ -739,6 +741,224 @@ std::enable_if_t<is_boolean<T>::value, T> parse(const char *begin, const char *e
   return T(0);
 }
 
+namespace detail {
+
+  /**
+   * Loads eight characters as a little-endian integer, whatever the byte
+   * order of the platform.
+   */
+  inline uint64_t load_eight_chars(const char *begin) {
+    uint64_t chunk = 0;
+    for (int i = 0; i < 8; ++i) {
+      chunk |= static_cast<uint64_t>(static_cast<uint8_t>(begin[i])) << (8 * i);
+    }
+    return chunk;
+  }
+
+  /**
+   * Returns true if all eight characters loaded by load_eight_chars are
+   * decimal digits.
+   */
+  inline bool is_eight_digits(uint64_t chunk) {
+    return (((chunk + 0x4646464646464646ULL) | (chunk - 0x3030303030303030ULL)) & 0x8080808080808080ULL) == 0;
+  }
+
+  /**
+   * Converts eight decimal digits loaded by load_eight_chars into their value,
+   * combining neighbouring digits into pairs, then pairs into the two halves.
+   */
+  inline uint32_t parse_eight_digits(uint64_t chunk) {
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+             (((chunk >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)) >>
+            32;
+    return static_cast<uint32_t>(chunk);
+  }
+
+  /**
+   * Parses up to 19 leading decimal digits, the most that always fit in a
+   * uint64, eight at a time where possible. Returns the position after the
+   * last digit that was used.
+   */
+  inline const char *parse_uint64_digits(const char *begin, const char *end, uint64_t &out_value) {
+    const char *digits_end = (end - begin > 19) ? begin + 19 : end;
+    uint64_t value = 0;
+    while (digits_end - begin >= 8) {
+      uint64_t chunk = load_eight_chars(begin);
+      if (!is_eight_digits(chunk)) {
+        break;
+      }
+      value = value * 100000000u + parse_eight_digits(chunk);
+      begin += 8;
+    }
+    while (begin < digits_end && '0' <= *begin && *begin <= '9') {
+      value = value * 10u + static_cast<uint64_t>(*begin - '0');
+      ++begin;
+    }
+
+    out_value = value;
+    return begin;
+  }
+
+  /**
+   * Returns true if a value parsed by parse_uint64_digits fits in T.
+   */
+  template <typename T>
+  bool uint64_fits(uint64_t value) {
+    return value <= static_cast<uint64_t>(std::numeric_limits<T>::max());
+  }
+
+  template <>
+  inline bool uint64_fits<uint128>(uint64_t DYND_UNUSED(value)) {
+    return true;
+  }
+
+  template <typename T>
+  struct exact_float_parse;
+
+  template <>
+  struct exact_float_parse<float> {
+    // Every integer up to 2^24, and powers of ten up to 10^10, are exact
+    static const uint64_t max_significand = 1ULL << 24;
+    static const int max_exponent = 10;
+
+    static float power_of_ten(int exponent) {
+      static const float powers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+      return powers[exponent];
+    }
+  };
+
+  template <>
+  struct exact_float_parse<double> {
+    // Every integer up to 2^53, and powers of ten up to 10^22, are exact
+    static const uint64_t max_significand = 1ULL << 53;
+    static const int max_exponent = 22;
+
+    static double power_of_ten(int exponent) {
+      static const double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+      return powers[exponent];
+    }
+  };
+
+  /**
+   * Replaces the '.' of a number about to be handed to strtod with the decimal
+   * point of the current C locale, which is the one strtod reads.
+   */
+  inline void localize_decimal_point(std::string &s) {
+    const char *point = localeconv()->decimal_point;
+    if (point[0] == '.' && point[1] == '\0') {
+      return;
+    }
+    size_t pos = s.find('.');
+    if (pos != std::string::npos) {
+      s.replace(pos, 1, point);
+    }
+  }
+
+  /**
+   * Parses a decimal floating point number when both its significand and its
+   * power of ten are exact in T. A single multiplication or division of exact
+   * values is correctly rounded, so the result is the same as strtod's.
+   * Returns false, leaving the rest to strtod, for anything else, including
+   * surrounding whitespace, hexadecimal, and too many significant digits.
+   */
+  template <typename T>
+  std::enable_if_t<std::is_same<T, float>::value || std::is_same<T, double>::value, bool>
+  parse_exact_float(const char *begin, const char *end, T &out_value) {
+    bool negative = false;
+    if (begin < end && (*begin == '-' || *begin == '+')) {
+      negative = (*begin == '-');
+      ++begin;
+    }
+
+    uint64_t significand = 0;
+    int ndigits = 0, exponent = 0;
+    bool any_digits = false;
+    // Leading zeros are not significant
+    while (begin < end && *begin == '0') {
+      any_digits = true;
+      ++begin;
+    }
+    while (begin < end && '0' <= *begin && *begin <= '9') {
+      if (++ndigits > 19) {
+        return false;
+      }
+      significand = significand * 10u + static_cast<uint64_t>(*begin - '0');
+      any_digits = true;
+      ++begin;
+    }
+    if (begin < end && *begin == '.') {
+      ++begin;
+      if (ndigits == 0) {
+        while (begin < end && *begin == '0') {
+          any_digits = true;
+          --exponent;
+          ++begin;
+        }
+      }
+      while (begin < end && '0' <= *begin && *begin <= '9') {
+        if (++ndigits > 19) {
+          return false;
+        }
+        significand = significand * 10u + static_cast<uint64_t>(*begin - '0');
+        any_digits = true;
+        --exponent;
+        ++begin;
+      }
+    }
+    if (!any_digits) {
+      return false;
+    }
+    if (begin < end && (*begin == 'e' || *begin == 'E')) {
+      ++begin;
+      bool negative_exponent = false;
+      if (begin < end && (*begin == '-' || *begin == '+')) {
+        negative_exponent = (*begin == '-');
+        ++begin;
+      }
+      if (begin == end) {
+        return false;
+      }
+      int explicit_exponent = 0;
+      while (begin < end && '0' <= *begin && *begin <= '9') {
+        if (explicit_exponent < 10000) {
+          explicit_exponent = explicit_exponent * 10 + (*begin - '0');
+        }
+        ++begin;
+      }
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+    if (begin != end || significand > exact_float_parse<T>::max_significand) {
+      return false;
+    }
+
+    T value = static_cast<T>(significand);
+    if (exponent < 0) {
+      if (-exponent > exact_float_parse<T>::max_exponent) {
+        return false;
+      }
+      value /= exact_float_parse<T>::power_of_ten(-exponent);
+    } else {
+      if (exponent > exact_float_parse<T>::max_exponent) {
+        return false;
+      }
+      value *= exact_float_parse<T>::power_of_ten(exponent);
+    }
+
+    out_value = negative ? -value : value;
+    return true;
+  }
+
+  template <typename T>
+  std::enable_if_t<!std::is_same<T, float>::value && !std::is_same<T, double>::value, bool>
+  parse_exact_float(const char *DYND_UNUSED(begin), const char *DYND_UNUSED(end), T &DYND_UNUSED(out_value)) {
+    return false;
+  }
+
+} // namespace dynd::detail
+
 /**
  * Converts a string containing only an unsigned integer (no leading or
  * trailing space, etc), ignoring any problems.
@@ -746,6 +966,12 @@ std::enable_if_t<is_boolean<T>::value, T> parse(const char *begin, const char *e
 template <typename T>
 std::enable_if_t<is_unsigned<T>::value && is_integral<T>::value && !is_boolean<T>::value, T>
 parse(const char *begin, const char *end, nocheck_t DYND_UNUSED(nocheck)) {
+  // Plain digits, the common case, are converted eight at a time
+  uint64_t value;
+  if (detail::parse_uint64_digits(begin, end, value) == end) {
+    return static_cast<T>(value);
+  }
+
   T result = 0;
   while (begin < end) {
     char c = *begin;
@@ -819,6 +1045,11 @@ std::enable_if_t<is_signed<T>::value && is_integral<T>::value, T> parse(const ch
 template <typename T>
 std::enable_if_t<is_floating_point<T>::value, T> parse(const char *begin, const char *end,
                                                        nocheck_t DYND_UNUSED(nocheck)) {
+  T exact_value;
+  if (detail::parse_exact_float(begin, end, exact_value)) {
+    return exact_value;
+  }
+
   bool negative = false;
   const char *pos = begin;
   if (pos < end && *pos == '-') {
@@ -859,6 +1090,7 @@ std::enable_if_t<is_floating_point<T>::value, T> parse(const char *begin, const
   // TODO: use http://www.netlib.org/fp/dtoa.c
   char *end_ptr;
   std::string s(begin, end);
+  detail::localize_decimal_point(s);
   return strtod(s.c_str(), &end_ptr);
 }
 
@@ -928,6 +1160,20 @@ std::enable_if_t<is_unsigned<T>::value && is_integral<T>::value && !is_boolean<T
   if (begin == end) {
     raise_string_cast_error(ndt::make_type<T>(), begin, end);
   }
+
+  // Plain digits, the common case, are converted eight at a time
+  uint64_t value;
+  if (detail::parse_uint64_digits(begin, end, value) == end) {
+    if (!detail::uint64_fits<T>(value)) {
+      std::stringstream ss;
+      ss << "overflow converting string ";
+      ss.write(begin, end - begin);
+      ss << " to " << ndt::make_type<T>();
+      throw std::out_of_range(ss.str());
+    }
+    return static_cast<T>(value);
+  }
+
   while (begin < end) {
     char c = *begin;
     if ('0' <= c && c <= '9') {
@@ -1032,6 +1278,11 @@ std::enable_if_t<is_signed<T>::value && is_integral<T>::value, T> parse(const ch
 
 template <typename T>
 std::enable_if_t<is_floating_point<T>::value, T> parse(const char *begin, const char *end) {
+  T exact_value;
+  if (detail::parse_exact_float(begin, end, exact_value)) {
+    return exact_value;
+  }
+
   bool negative = false;
   const char *pos = begin;
   if (pos < end && *pos == '-') {
@@ -1070,9 +1321,12 @@ std::enable_if_t<is_floating_point<T>::value, T> parse(const char *begin, const
   }
 
   // TODO: use http://www.netlib.org/fp/dtoa.c
+  // The range is not null-terminated, so strto needs a copy of it
+  std::string s(begin, end);
+  detail::localize_decimal_point(s);
   char *end_ptr;
-  T value = strto<T>(begin, &end_ptr);
-  if (end_ptr - begin != end - begin) {
+  T value = strto<T>(s.c_str(), &end_ptr);
+  if (end_ptr != s.c_str() + s.size()) {
     std::stringstream ss;
     ss << "parse error converting string ";
     ss.write(begin, end - begin);
@@ -1099,6 +1353,12 @@ T parse(const string &s) {
  */
 DYNDT_API bool parse_na(const char *begin, const char *end);
 
+/**
+ * Returns true if the string provided matches one of ``na_values``, or one of
+ * the default missing value tokens above if ``na_values`` is empty.
+ */
+DYNDT_API bool parse_na(const char *begin, const char *end, const std::vector<std::string> &na_values);
+
 /**
  * A helper class for matching a bunch of names and getting an integer.
  * Arrays of this struct should be in alphabetical order.
@@ -1183,62 +1443,67 @@ void assign_unsigned_int_value(char *out_int, uint64_t uvalue, bool &negative, b
   }
 }
 
+/**
+ * Assigns the NA value of option[Num] for the Num with the specified builtin
+ * type id.
+ */
+inline void assign_number_na(char *out, type_id_t tid) {
+  switch (tid) {
+  case int8_id:
+    *reinterpret_cast<int8_t *>(out) = DYND_INT8_NA;
+    return;
+  case int16_id:
+    *reinterpret_cast<int16_t *>(out) = DYND_INT16_NA;
+    return;
+  case int32_id:
+    *reinterpret_cast<int32_t *>(out) = DYND_INT32_NA;
+    return;
+  case int64_id:
+    *reinterpret_cast<int64_t *>(out) = DYND_INT64_NA;
+    return;
+  case int128_id:
+    *reinterpret_cast<int128 *>(out) = DYND_INT128_NA;
+    return;
+  case float32_id:
+    *reinterpret_cast<uint32_t *>(out) = DYND_FLOAT32_NA_AS_UINT;
+    return;
+  case float64_id:
+    *reinterpret_cast<uint64_t *>(out) = DYND_FLOAT64_NA_AS_UINT;
+    return;
+  case complex_float32_id:
+    reinterpret_cast<uint32_t *>(out)[0] = DYND_FLOAT32_NA_AS_UINT;
+    reinterpret_cast<uint32_t *>(out)[1] = DYND_FLOAT32_NA_AS_UINT;
+    return;
+  case complex_float64_id:
+    reinterpret_cast<uint64_t *>(out)[0] = DYND_FLOAT64_NA_AS_UINT;
+    reinterpret_cast<uint64_t *>(out)[1] = DYND_FLOAT64_NA_AS_UINT;
+    return;
+  default:
+    break;
+  }
+  std::stringstream ss;
+  ss << "No NA value has been configured for option[" << tid << "]";
+  throw type_error(ss.str());
+}
+
 /**
  * Converts a string containing a number (no leading or trailing space)
  * into a Num with the specified builtin type id, using the specified error
- * mode to handle errors. If ``option`` is true, writes to option[Num].
+ * mode to handle errors. Unlike string_to_number, this does not check for
+ * missing value tokens.
  *
- * \param out  The address of the Num or option[Num].
+ * \param out  The address of the Num.
  * \param tid  The type id of the Num.
  * \param begin  The start of the UTF8 string buffer.
  * \param end  The end of the UTF8 string buffer.
- * \param option  If true, treat it as option[Num] instead of just Num.
  * \param errmode  The error handling mode.
  */
-inline void string_to_number(char *out, type_id_t tid, const char *begin, const char *end, assign_error_mode errmode) {
+inline void string_to_number_value(char *out, type_id_t tid, const char *begin, const char *end,
+                                   assign_error_mode errmode) {
   uint64_t uvalue;
   const char *saved_begin = begin;
   bool negative = false, overflow = false;
 
-  if (parse_na(begin, end)) {
-    switch (tid) {
-    case int8_id:
-      *reinterpret_cast<int8_t *>(out) = DYND_INT8_NA;
-      return;
-    case int16_id:
-      *reinterpret_cast<int16_t *>(out) = DYND_INT16_NA;
-      return;
-    case int32_id:
-      *reinterpret_cast<int32_t *>(out) = DYND_INT32_NA;
-      return;
-    case int64_id:
-      *reinterpret_cast<int64_t *>(out) = DYND_INT64_NA;
-      return;
-    case int128_id:
-      *reinterpret_cast<int128 *>(out) = DYND_INT128_NA;
-      return;
-    case float32_id:
-      *reinterpret_cast<uint32_t *>(out) = DYND_FLOAT32_NA_AS_UINT;
-      return;
-    case float64_id:
-      *reinterpret_cast<uint64_t *>(out) = DYND_FLOAT64_NA_AS_UINT;
-      return;
-    case complex_float32_id:
-      reinterpret_cast<uint32_t *>(out)[0] = DYND_FLOAT32_NA_AS_UINT;
-      reinterpret_cast<uint32_t *>(out)[1] = DYND_FLOAT32_NA_AS_UINT;
-      return;
-    case complex_float64_id:
-      reinterpret_cast<uint64_t *>(out)[0] = DYND_FLOAT64_NA_AS_UINT;
-      reinterpret_cast<uint64_t *>(out)[1] = DYND_FLOAT64_NA_AS_UINT;
-      return;
-    default:
-      break;
-    }
-    std::stringstream ss;
-    ss << "No NA value has been configured for option[" << tid << "]";
-    throw type_error(ss.str());
-  }
-
   if (begin < end && *begin == '-') {
     negative = true;
     ++begin;
@@ -1380,6 +1645,25 @@ inline void string_to_number(char *out, type_id_t tid, const char *begin, const
   }
 }
 
+/**
+ * Converts a string containing a number (no leading or trailing space)
+ * into a Num with the specified builtin type id, using the specified error
+ * mode to handle errors. A missing value token writes the NA of option[Num].
+ *
+ * \param out  The address of the Num or option[Num].
+ * \param tid  The type id of the Num.
+ * \param begin  The start of the UTF8 string buffer.
+ * \param end  The end of the UTF8 string buffer.
+ * \param errmode  The error handling mode.
+ */
+inline void string_to_number(char *out, type_id_t tid, const char *begin, const char *end, assign_error_mode errmode) {
+  if (parse_na(begin, end)) {
+    assign_number_na(out, tid);
+  } else {
+    string_to_number_value(out, tid, begin, end, errmode);
+  }
+}
+
 class json_parse_error : public parse_error {
   ndt::type m_type;
 
@@ -12,7 +12,9 @@ namespace nd {
 
   /**
    * Performs a binary search of the first dimension of the array, which
-   * should be sorted.
+   * should be sorted. Searching the same array for many values at once, by
+   * applying it elementwise, is done as a batch for builtin numeric types.
+   * If the value occurs more than once, any of its indices may be returned.
    *
    * \returns  The index of the found element, or -1 if not found.
    */
@@ -10,9 +10,33 @@
 namespace dynd {
 namespace nd {
 
+  /**
+   * Computes the count, sum, mean, sum of squared differences from the mean
+   * (``m2``), minimum, maximum, sample variance and standard deviation of real
+   * values in a single pass, returning them in a struct of type
+   * ``{count: int64, sum: float64, mean: float64, m2: float64, min: float64,
+   * max: float64, var: float64, stddev: float64}``. Like the other
+   * reductions it accepts the ``axes`` and ``keepdims`` keywords.
+   */
+  extern DYND_API callable describe;
+
   extern DYND_API callable max;
   extern DYND_API callable mean;
   extern DYND_API callable min;
 
+  /**
+   * Returns callables computing the sum, minimum or maximum over a sliding
+   * window of ``window_size`` elements along the last dimension. Element i of
+   * the result covers the inputs (i - window_size, i], so the start of each
+   * row covers a partial window. The window only runs along the last
+   * dimension; any leading (fixed) dimensions are independent rows.
+   *
+   * Sums of integers are returned as int64 or uint64, and sums of floats are
+   * accumulated in double precision with compensation.
+   */
+  DYND_API callable rolling_sum(intptr_t window_size);
+  DYND_API callable rolling_min(intptr_t window_size);
+  DYND_API callable rolling_max(intptr_t window_size);
+
 } // namespace dynd::nd
 } // namespace dynd
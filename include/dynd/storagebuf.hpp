@@ -6,14 +6,71 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <map>
 #include <new>
 
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <stdlib.h>
+#endif
+
 #include <dynd/visibility.hpp>
 
 namespace dynd {
 
+/**
+ * The alignment of the memory a storagebuf hands out. The data always starts
+ * at this alignment, inline or on the heap, so data at a fixed offset keeps its
+ * address modulo the alignment when the buffer grows.
+ */
+static const size_t storagebuf_alignment = 64;
+
+/**
+ * Allocates and frees memory aligned to ``storagebuf_alignment``.
+ */
+inline void *storagebuf_aligned_alloc(size_t size) {
+#if defined(_WIN32)
+  return _aligned_malloc(size, storagebuf_alignment);
+#else
+  void *ptr;
+  return (posix_memalign(&ptr, storagebuf_alignment, size) == 0) ? ptr : NULL;
+#endif
+}
+
+inline void storagebuf_aligned_free(void *ptr) {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  ::free(ptr);
+#endif
+}
+
+/**
+ * Inline state for a kernel that needs more than the 8 byte alignment
+ * kernels are placed at, such as SIMD constant or lookup tables. Kernels may
+ * be relocated with a memcpy, so the aligned address is recomputed on each
+ * access. Because the buffer is aligned to ``storagebuf_alignment`` and
+ * kernels keep their offsets, the data lands at the same place after a move.
+ */
+template <size_t Size, size_t Alignment = storagebuf_alignment>
+class aligned_kernel_storage {
+  static_assert(Alignment <= storagebuf_alignment && (Alignment & (Alignment - 1)) == 0,
+                "the alignment must be a power of two no larger than storagebuf_alignment");
+
+  char m_data[Size + Alignment - 8];
+
+public:
+  void *get() {
+    return reinterpret_cast<void *>((reinterpret_cast<uintptr_t>(m_data) + Alignment - 1) &
+                                    ~static_cast<uintptr_t>(Alignment - 1));
+  }
+
+  const void *get() const { return const_cast<aligned_kernel_storage *>(this)->get(); }
+};
+
 template <typename PrefixType, typename DerivedType>
 class storagebuf {
 protected:
@@ -24,7 +81,7 @@ protected:
 
   // When the amount of data is small, this static data is used,
   // otherwise dynamic memory is allocated when it gets too big
-  char m_static_data[16 * 8];
+  alignas(storagebuf_alignment) char m_static_data[4 * storagebuf_alignment];
 
   bool using_static_data() const { return m_data == &m_static_data[0]; }
 
@@ -33,6 +90,12 @@ public:
     set(m_static_data, 0, sizeof(m_static_data));
   }
 
+  /**
+   * Starts with at least ``size_hint`` bytes of capacity, so a buffer whose
+   * final size is known up front is allocated once.
+   */
+  explicit storagebuf(size_t size_hint) : storagebuf() { reserve_exact(static_cast<intptr_t>(size_hint)); }
+
   ~storagebuf() {
     if (!using_static_data() && m_data != NULL) {
       free(m_data);
@@ -57,8 +120,28 @@ public:
       if (requested_capacity < grown_capacity) {
         requested_capacity = grown_capacity;
       }
-      // Do a realloc
-      char *new_data = reinterpret_cast<char *>(realloc(m_data, m_capacity, requested_capacity));
+      reserve_exact(requested_capacity);
+    }
+  }
+
+  /**
+   * Like reserve, but grows to exactly the requested capacity.
+   */
+  void reserve_exact(intptr_t requested_capacity) {
+    if (m_capacity < requested_capacity) {
+      // Round up to whole cache lines
+      requested_capacity = (requested_capacity + static_cast<intptr_t>(storagebuf_alignment) - 1) &
+                           ~static_cast<intptr_t>(storagebuf_alignment - 1);
+      char *new_data;
+      if (using_static_data()) {
+        // Move off the inline buffer, which is never freed
+        new_data = reinterpret_cast<char *>(alloc(requested_capacity));
+        if (new_data != NULL) {
+          copy(new_data, m_data, m_capacity);
+        }
+      } else {
+        new_data = reinterpret_cast<char *>(realloc(m_data, m_capacity, requested_capacity));
+      }
       if (new_data == NULL) {
         reinterpret_cast<DerivedType *>(this)->destroy();
         m_data = NULL;
@@ -71,25 +154,25 @@ public:
     }
   }
 
-  void *alloc(size_t size) { return std::malloc(size); }
+  void *alloc(size_t size) { return storagebuf_aligned_alloc(size); }
 
+  /**
+   * Moves heap data into a new aligned allocation. There is no aligned realloc,
+   * so this is always an allocation and a copy. ``ptr`` must not be the inline
+   * buffer.
+   */
   void *realloc(void *ptr, size_t old_size, size_t new_size) {
-    if (using_static_data()) {
-      // If we were previously using the static data, do a malloc
-      void *new_data = alloc(new_size);
-      // If the allocation succeeded, copy the old data as the realloc would
-      if (new_data != NULL) {
-        copy(new_data, ptr, old_size);
-      }
-      return new_data;
-    } else {
-      return std::realloc(ptr, new_size);
+    void *new_data = alloc(new_size);
+    if (new_data != NULL) {
+      copy(new_data, ptr, old_size);
+      storagebuf_aligned_free(ptr);
     }
+    return new_data;
   }
 
   void free(void *ptr) {
     if (!using_static_data()) {
-      std::free(ptr);
+      storagebuf_aligned_free(ptr);
     }
   }
 
@@ -121,7 +204,8 @@ public:
   template <typename KernelType, typename... ArgTypes>
   void emplace_back(ArgTypes &&... args) {
     /* Alignment requirement of the type. */
-    static_assert(alignof(KernelType) <= 8, "kernel types require alignment to be at most 8 bytes");
+    static_assert(alignof(KernelType) <= 8, "kernel types require alignment to be at most 8 bytes, keep over-aligned "
+                                            "state in an aligned_kernel_storage member");
 
     size_t offset = m_size;
     m_size += aligned_size(sizeof(KernelType));
@@ -133,7 +217,8 @@ public:
   template <typename KernelType, typename... ArgTypes>
   void emplace_back_sep(ArgTypes &&... args) {
     /* Alignment requirement of the type. */
-    static_assert(alignof(KernelType) <= 8, "kernel types require alignment to be at most 8 bytes");
+    static_assert(alignof(KernelType) <= 8, "kernel types require alignment to be at most 8 bytes, keep over-aligned "
+                                            "state in an aligned_kernel_storage member");
 
     size_t offset = m_size;
     m_size += aligned_size(sizeof(PrefixType)) + aligned_size(sizeof(KernelType));
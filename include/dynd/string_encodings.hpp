@@ -98,6 +98,23 @@ get_next_unicode_codepoint_function(string_encoding_t encoding, assign_error_mod
 DYNDT_API append_unicode_codepoint_t
 get_append_unicode_codepoint_function(string_encoding_t encoding, assign_error_mode errmode);
 
+/**
+ * Typedef for converting a run of characters from a string of one encoding to
+ * a string of another.
+ *
+ * This function converts characters from 'src' to 'dst' until it reaches a
+ * character that is zero or that it leaves to the next_*() and append_*()
+ * functions, or until either 'src_end' or 'dst_end'. Both 'src' and 'dst' are
+ * updated in-place. Between UTF-8 and UTF-8 or UTF-16, the run is every valid
+ * character, checked in blocks with SIMD when the CPU supports it. Between
+ * other encodings, the run is the characters from 1 to 0x7f, which are a single
+ * code unit with the same value in every encoding. Invalid input is always
+ * left for next_*(), so error handling is the same as without the run.
+ */
+typedef void (*transcode_run_t)(const char *&src, const char *src_end, char *&dst, char *dst_end);
+
+DYNDT_API transcode_run_t get_transcode_run_function(string_encoding_t dst_encoding, string_encoding_t src_encoding);
+
 /**
  * Converts a string buffer provided as a range of bytes into a std::string as UTF8.
  */
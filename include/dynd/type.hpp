@@ -5,8 +5,14 @@
 
 #pragma once
 
+#include <deque>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 
 #include <dynd/exceptions.hpp>
 #include <dynd/types/base_expr_type.hpp>
@@ -240,12 +246,9 @@ namespace ndt {
      * \param candidate_tp    A type to match against this one.
      * \param tp_vars     A map of names to matched type vars.
      */
-    bool match(const ndt::type &candidate_tp, std::map<std::string, ndt::type> &tp_vars) const;
+    bool match(const ndt::type &candidate_tp, ndt::typevar_map &tp_vars) const;
 
-    bool match(const type &candidate_tp) const {
-      std::map<std::string, type> tp_vars;
-      return match(candidate_tp, tp_vars);
-    }
+    bool match(const type &candidate_tp) const;
 
     /**
      * Accesses a dynamic property of the type.
@@ -664,6 +667,172 @@ namespace ndt {
     friend DYNDT_API std::ostream &operator<<(std::ostream &o, const type &rhs);
   };
 
+  /**
+   * The types bound to the typevars of a pattern while matching it, by name.
+   *
+   * Signatures rarely have more than a few typevars, so the first few
+   * bindings are stored inline and looked up with a linear search, and
+   * matching a type against a pattern usually allocates nothing. Bindings
+   * stay at the same address once made, like in a std::map, so a reference
+   * from ``operator[]`` stays valid while matching continues. They are kept in
+   * the order they were made.
+   */
+  class typevar_map {
+  public:
+    typedef std::string key_type;
+    typedef type mapped_type;
+    typedef std::pair<std::string, type> value_type;
+
+  private:
+    static const size_t inline_capacity = 4;
+
+    typename std::aligned_storage<sizeof(value_type), alignof(value_type)>::type m_inline[inline_capacity];
+    // Bindings past the inline ones, a deque so that they never move
+    std::unique_ptr<std::deque<value_type>> m_overflow;
+    size_t m_size;
+
+    value_type &at(size_t i) {
+      return (i < inline_capacity) ? *reinterpret_cast<value_type *>(&m_inline[i])
+                                   : (*m_overflow)[i - inline_capacity];
+    }
+
+    const value_type &at(size_t i) const { return const_cast<typevar_map *>(this)->at(i); }
+
+    template <typename MapType, typename ValueType>
+    class iterator_base {
+      MapType *m_map;
+      size_t m_i;
+
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef typevar_map::value_type value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef ValueType *pointer;
+      typedef ValueType &reference;
+
+      iterator_base(MapType *map, size_t i) : m_map(map), m_i(i) {}
+
+      // Allows converting an iterator to a const_iterator
+      template <typename OtherMapType, typename OtherValueType>
+      iterator_base(const iterator_base<OtherMapType, OtherValueType> &other) : m_map(other.m_map), m_i(other.m_i) {}
+
+      reference operator*() const { return m_map->at(m_i); }
+      pointer operator->() const { return &m_map->at(m_i); }
+
+      iterator_base &operator++() {
+        ++m_i;
+        return *this;
+      }
+
+      iterator_base operator++(int) {
+        iterator_base tmp(*this);
+        ++m_i;
+        return tmp;
+      }
+
+      bool operator==(const iterator_base &rhs) const { return m_i == rhs.m_i; }
+      bool operator!=(const iterator_base &rhs) const { return m_i != rhs.m_i; }
+
+      template <typename OtherMapType, typename OtherValueType>
+      friend class iterator_base;
+    };
+
+    void emplace_back(const std::string &name, const type &tp) {
+      if (m_size < inline_capacity) {
+        new (&m_inline[m_size]) value_type(name, tp);
+      } else {
+        if (m_overflow == nullptr) {
+          m_overflow.reset(new std::deque<value_type>());
+        }
+        m_overflow->emplace_back(name, tp);
+      }
+      ++m_size;
+    }
+
+  public:
+    typedef iterator_base<typevar_map, value_type> iterator;
+    typedef iterator_base<const typevar_map, const value_type> const_iterator;
+
+    typevar_map() : m_size(0) {}
+
+    typevar_map(const typevar_map &other) : m_size(0) {
+      for (const value_type &val : other) {
+        emplace_back(val.first, val.second);
+      }
+    }
+
+    typevar_map(std::initializer_list<value_type> values) : m_size(0) {
+      for (const value_type &val : values) {
+        (*this)[val.first] = val.second;
+      }
+    }
+
+    ~typevar_map() { clear(); }
+
+    typevar_map &operator=(const typevar_map &rhs) {
+      if (this != &rhs) {
+        clear();
+        for (const value_type &val : rhs) {
+          emplace_back(val.first, val.second);
+        }
+      }
+
+      return *this;
+    }
+
+    size_t size() const { return m_size; }
+
+    bool empty() const { return m_size == 0; }
+
+    void clear() {
+      size_t ninline = (m_size < inline_capacity) ? m_size : inline_capacity;
+      for (size_t i = 0; i < ninline; ++i) {
+        reinterpret_cast<value_type *>(&m_inline[i])->~value_type();
+      }
+      m_overflow.reset();
+      m_size = 0;
+    }
+
+    iterator begin() { return iterator(this, 0); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    iterator end() { return iterator(this, m_size); }
+    const_iterator end() const { return const_iterator(this, m_size); }
+
+    iterator find(const std::string &name) {
+      for (size_t i = 0; i < m_size; ++i) {
+        if (at(i).first == name) {
+          return iterator(this, i);
+        }
+      }
+
+      return end();
+    }
+
+    const_iterator find(const std::string &name) const { return const_cast<typevar_map *>(this)->find(name); }
+
+    size_t count(const std::string &name) const { return (find(name) != end()) ? 1 : 0; }
+
+    /**
+     * The type bound to the named typevar, binding it to a null type first if
+     * it is not bound yet.
+     */
+    type &operator[](const std::string &name) {
+      iterator it = find(name);
+      if (it != end()) {
+        return it->second;
+      }
+
+      emplace_back(name, type());
+      return at(m_size - 1).second;
+    }
+  };
+
+  inline bool type::match(const type &candidate_tp) const {
+    typevar_map tp_vars;
+    return match(candidate_tp, tp_vars);
+  }
+
   template <>
   struct traits<void> {
     static const size_t ndim = 0;
@@ -17,7 +17,7 @@ namespace dynd {
  * for handling it.
  */
 typedef ndt::type (*low_level_type_args_parse_fn_t)(type_id_t id, const char *&begin, const char *end,
-                                                    std::map<std::string, ndt::type> &symtable);
+                                                    ndt::typevar_map &symtable);
 /**
  * Function prototype for a type constructor.
  *
@@ -33,7 +33,7 @@ typedef ndt::type (*type_constructor_fn_t)(type_id_t id, const nd::buffer &args,
  * arguments via `dynd::parse_type_constr_args`, then calls the type constructor for the specified type id.
  */
 DYNDT_API ndt::type default_parse_type_args(type_id_t id, const char *&begin, const char *end,
-                                            std::map<std::string, ndt::type> &symtable);
+                                            ndt::typevar_map &symtable);
 
 struct id_info {
   /** The name to use for parsing as a singleton or constructed type */
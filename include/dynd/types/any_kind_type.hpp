@@ -34,7 +34,7 @@ namespace ndt {
 
     bool operator==(const base_type &rhs) const { return this == &rhs || rhs.get_id() == any_kind_id; }
 
-    bool match(const type &DYND_UNUSED(candidate_tp), std::map<std::string, type> &DYND_UNUSED(tp_vars)) const {
+    bool match(const type &DYND_UNUSED(candidate_tp), typevar_map &DYND_UNUSED(tp_vars)) const {
       return true;
     }
   };
@@ -98,7 +98,7 @@ namespace ndt {
     virtual size_t arrmeta_copy_construct_onedim(char *dst_arrmeta, const char *src_arrmeta,
                                                  const nd::memory_block &embedded_reference) const = 0;
 
-    virtual bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    virtual bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     virtual type with_element_type(const type &element_tp) const = 0;
   };
@@ -87,7 +87,7 @@ namespace ndt {
     virtual void data_zeroinit(char *data, size_t size) const = 0;
     virtual void data_free(char *data) const = 0;
 
-    virtual bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    virtual bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     virtual std::map<std::string, std::pair<ndt::type, const char *>> get_dynamic_type_properties() const;
   };
@@ -19,6 +19,7 @@ namespace dynd {
 namespace ndt {
 
   class type;
+  class typevar_map;
 
 } // namespace dynd::ndt
 
@@ -456,7 +457,7 @@ namespace ndt {
      */
     virtual nd::buffer get_type_constructor_args() const;
 
-    virtual bool match(const ndt::type &candidate_tp, std::map<std::string, ndt::type> &tp_vars) const;
+    virtual bool match(const ndt::type &candidate_tp, ndt::typevar_map &tp_vars) const;
 
     /**
      * Call the callback on each element of the array with given data/arrmeta
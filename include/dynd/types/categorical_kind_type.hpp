@@ -40,7 +40,7 @@ namespace ndt {
     void data_destruct(const char *arrmeta, char *data) const;
     void data_destruct_strided(const char *arrmeta, char *data, intptr_t stride, size_t count) const;
 
-    bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    bool match(const type &candidate_tp, typevar_map &tp_vars) const;
   };
 
   template <>
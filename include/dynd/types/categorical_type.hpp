@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <dynd/array.hpp>
 #include <dynd/type.hpp>
 #include <dynd/types/fixed_dim_type.hpp>
@@ -31,6 +33,12 @@ namespace ndt {
     nd::array m_category_index_to_value;
     // mapping from values to category indices
     nd::array m_value_to_category_index;
+    // open-addressed hash table of category indices, keyed by category value,
+    // with -1 marking an empty slot
+    std::vector<intptr_t> m_category_hash;
+
+    void build_category_hash();
+    intptr_t find_category(const char *category_data) const;
 
   public:
     categorical_type(type_id_t new_id, const nd::array &categories, bool presorted = false);
@@ -56,6 +64,41 @@ namespace ndt {
      */
     const type &get_storage_type() const { return m_storage_type; }
 
+    /**
+     * Reads the category value held by categorical data.
+     */
+    uint32_t get_value(const char *data) const {
+      switch (m_data_size) {
+      case 1:
+        return *reinterpret_cast<const uint8_t *>(data);
+      case 2:
+        return *reinterpret_cast<const uint16_t *>(data);
+      default:
+        return *reinterpret_cast<const uint32_t *>(data);
+      }
+    }
+
+    /**
+     * Stores a category value into categorical data.
+     */
+    void set_value(char *data, uint32_t value) const {
+      switch (m_data_size) {
+      case 1:
+        *reinterpret_cast<uint8_t *>(data) = static_cast<uint8_t>(value);
+        break;
+      case 2:
+        *reinterpret_cast<uint16_t *>(data) = static_cast<uint16_t>(value);
+        break;
+      default:
+        *reinterpret_cast<uint32_t *>(data) = value;
+        break;
+      }
+    }
+
+    /**
+     * Returns the value of a category, found with a hash lookup, or throws if
+     * it is not one of the categories.
+     */
     uint32_t get_value_from_category(const char *category_arrmeta, const char *category_data) const;
     uint32_t get_value_from_category(const nd::array &category) const;
 
@@ -91,11 +134,11 @@ namespace ndt {
     friend struct assign_from_commensurate_category_type;
 
     static ndt::type parse_type_args(type_id_t id, const char *&begin, const char *end,
-                                     std::map<std::string, ndt::type> &symtable);
+                                     ndt::typevar_map &symtable);
   };
 
   template <>
-  struct id_of<categorical_type> : std::integral_constant<type_id_t, categorical_kind_id> {};
+  struct id_of<categorical_type> : std::integral_constant<type_id_t, categorical_id> {};
 
   DYND_API type factor_categorical(const nd::array &values);
 
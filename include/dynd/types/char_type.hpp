@@ -67,7 +67,7 @@ namespace ndt {
                              const std::string &DYND_UNUSED(indent)) const {}
 
     static ndt::type parse_type_args(type_id_t id, const char *&begin, const char *end,
-                                     std::map<std::string, ndt::type> &symtable);
+                                     ndt::typevar_map &symtable);
   };
 
   template <>
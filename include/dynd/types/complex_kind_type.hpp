@@ -14,7 +14,7 @@ namespace ndt {
   public:
     complex_kind_type(type_id_t id) : base_type(id, 0, 1, type_flag_symbolic, 0, 0, 0) {}
 
-    bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     void print_data(std::ostream &o, const char *arrmeta, const char *data) const;
 
@@ -27,7 +27,7 @@ namespace ndt {
     void data_free(char *data) const;
 
     static ndt::type parse_type_args(type_id_t id, const char *&begin, const char *end,
-                                     std::map<std::string, ndt::type> &symtable);
+                                     ndt::typevar_map &symtable);
   };
 
   DYNDT_API size_t get_cuda_device_data_alignment(const ndt::type &tp);
@@ -63,7 +63,7 @@ namespace datashape {
    *
    * \return Either the parsed type or ndt::type if a datashape couldn't be matched.
    */
-  ndt::type parse(const char *&begin, const char *end, std::map<std::string, ndt::type> &symtable);
+  ndt::type parse(const char *&begin, const char *end, ndt::typevar_map &symtable);
 
   /**
    * Low level parsing function for parsing the argument list passed to a datashape type constructor.
@@ -72,7 +72,7 @@ namespace datashape {
    *   "{pos: N * arg, kw: {name: arg, ...}}" otherwise.
    */
   DYNDT_API nd::buffer parse_type_constr_args(const char *&rbegin, const char *end,
-                                              std::map<std::string, ndt::type> &symtable);
+                                              ndt::typevar_map &symtable);
 
   DYNDT_API nd::buffer parse_type_constr_args(const std::string &str);
 
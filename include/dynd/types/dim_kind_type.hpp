@@ -16,7 +16,7 @@ namespace ndt {
 
     dim_kind_type(type_id_t id, const type &element_tp = make_type<any_kind_type>());
 
-    bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     void print_data(std::ostream &o, const char *arrmeta, const char *data) const;
 
@@ -62,7 +62,7 @@ namespace ndt {
                                          const nd::memory_block &embedded_reference) const;
     void arrmeta_destruct(char *arrmeta) const;
 
-    bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     std::map<std::string, std::pair<ndt::type, const char *>> get_dynamic_type_properties() const;
 
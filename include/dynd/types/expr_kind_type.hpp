@@ -14,7 +14,7 @@ namespace ndt {
   public:
     expr_kind_type(type_id_t id) : base_type(id, 0, 1, type_flag_symbolic, 0, 0, 0) {}
 
-    bool match(const type &candidate_tp, std::map<std::string, type> &DYND_UNUSED(tp_vars)) const {
+    bool match(const type &candidate_tp, typevar_map &DYND_UNUSED(tp_vars)) const {
       return candidate_tp.get_base_id() == expr_kind_id;
     }
 
@@ -17,7 +17,7 @@ namespace ndt {
 
     bool operator==(const base_type &rhs) const;
 
-    bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     void print_type(std::ostream &o) const;
   };
@@ -14,7 +14,7 @@ namespace ndt {
   public:
     string_kind_type(type_id_t id) : base_type(id, 0, 1, type_flag_symbolic, 0, 0, 0) {}
 
-    bool match(const type &candidate_tp, std::map<std::string, type> &DYND_UNUSED(tp_vars)) const {
+    bool match(const type &candidate_tp, typevar_map &DYND_UNUSED(tp_vars)) const {
       return candidate_tp.get_id() == string_id || candidate_tp.get_id() == fixed_string_id ||
              candidate_tp.get_id() == fixed_string_kind_id || candidate_tp.get_id() == string_kind_id;
     }
@@ -175,7 +175,7 @@ namespace ndt {
 
     std::map<std::string, std::pair<ndt::type, const char *>> get_dynamic_type_properties() const;
 
-    virtual bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    virtual bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     void print_data(std::ostream &o, const char *arrmeta, const char *data) const;
 
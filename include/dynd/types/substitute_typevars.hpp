@@ -13,7 +13,7 @@ namespace dynd {
 namespace ndt {
 
   namespace detail {
-    DYNDT_API ndt::type internal_substitute(const ndt::type &pattern, const std::map<std::string, ndt::type> &typevars,
+    DYNDT_API ndt::type internal_substitute(const ndt::type &pattern, const ndt::typevar_map &typevars,
                                             bool concrete);
   }
 
@@ -24,7 +24,7 @@ namespace ndt {
    * \param typevars  A map of names to type var values.
    * \param concrete  If true, requires that the result be concrete.
    */
-  inline ndt::type substitute(const ndt::type &pattern, const std::map<std::string, ndt::type> &typevars, bool concrete)
+  inline ndt::type substitute(const ndt::type &pattern, const ndt::typevar_map &typevars, bool concrete)
   {
     // This check for whether ``pattern`` is symbolic is put here in the inline function to avoid the call overhead in
     // this case. Callables are not symbolic themselves, but may contain symbolic types within them that need
@@ -189,7 +189,7 @@ namespace ndt {
 
     void arrmeta_debug_print(const char *arrmeta, std::ostream &o, const std::string &indent) const;
 
-    virtual bool match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const;
+    virtual bool match(const type &candidate_tp, typevar_map &tp_vars) const;
 
     std::map<std::string, std::pair<ndt::type, const char *>> get_dynamic_type_properties() const;
 
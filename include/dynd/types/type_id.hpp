@@ -206,6 +206,12 @@ inline bool is_builtin_type(const ndt::base_type *dt) {
   }
 }
 
+/**
+ * The builtin type ids are dense, from uninitialized_id to void_id, so tables
+ * indexed by them have this many entries.
+ */
+static const size_t builtin_id_count = void_id + 1;
+
 namespace detail {
   // Simple metaprogram taking log base 2 of 1, 2, 4, and 8
   template <int I>
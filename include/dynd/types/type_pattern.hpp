@@ -0,0 +1,52 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#pragma once
+
+#include <vector>
+
+#include <dynd/type.hpp>
+
+namespace dynd {
+namespace ndt {
+
+  /**
+   * A pattern type compiled into a flat sequence of checks over type ids and
+   * dimensions. Matching a candidate against it gives the same result as
+   * ``pattern.match(candidate)``, but the common dimension and kind patterns
+   * (``Any``, ``Scalar``, ``Int``, ``Dim``, ``Fixed``, ``3``, ``var``,
+   * ``?``) are checked inline, without virtual calls or a typevar map.
+   *
+   * What remains of the pattern after the last compiled check, for instance
+   * ``T`` in ``Fixed * Fixed * T``, is matched with ``type::match``.
+   */
+  class DYNDT_API type_pattern {
+    enum opcode { op_match, op_any, op_scalar, op_base_id, op_dim, op_fixed_dim, op_fixed_dim_kind, op_var_dim, op_option };
+
+    struct instruction {
+      opcode op;
+      // The kind id for op_base_id, or the dimension size for op_fixed_dim
+      intptr_t arg;
+      // The part of the pattern this instruction checks
+      type tp;
+
+      instruction(opcode op, intptr_t arg, const type &tp) : op(op), arg(arg), tp(tp) {}
+    };
+
+    type m_tp;
+    std::vector<instruction> m_program;
+
+  public:
+    type_pattern() = default;
+
+    type_pattern(const type &tp);
+
+    const type &get_type() const { return m_tp; }
+
+    bool match(const type &candidate_tp) const;
+  };
+
+} // namespace dynd::ndt
+} // namespace dynd
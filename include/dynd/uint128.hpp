@@ -59,7 +59,7 @@ public:
   {
     DYND_ALLOW_UNSIGNED_UNARY_MINUS
     if (this->m_lo != 0) {
-      return uint128(!this->m_hi, -this->m_lo);
+      return uint128(~this->m_hi, -this->m_lo);
     }
     else {
       return uint128(-this->m_hi, 0);
@@ -67,7 +67,7 @@ public:
     DYND_END_ALLOW_UNSIGNED_UNARY_MINUS
   }
 
-  bool operator!() const { return (m_hi != 0) && (m_lo != 0); }
+  bool operator!() const { return !m_hi && !m_lo; }
 
   uint128 operator~() const { return uint128(~m_hi, ~m_lo); }
 
@@ -111,14 +111,14 @@ public:
 
   uint128 operator-(const uint128 &rhs) const
   {
-    uint64_t lo = m_lo + ~rhs.m_lo + 1;
-    return uint128(m_hi + ~rhs.m_hi + (lo < m_lo), lo);
+    uint64_t lo = m_lo - rhs.m_lo;
+    return uint128(m_hi - rhs.m_hi - (m_lo < rhs.m_lo), lo);
   }
 
   uint128 operator-(uint64_t rhs) const
   {
-    uint64_t lo = m_lo + ~rhs + 1;
-    return uint128(m_hi + 0xffffffffffffffffULL + (lo < m_lo), lo);
+    uint64_t lo = m_lo - rhs;
+    return uint128(m_hi - (m_lo < rhs), lo);
   }
 
   uint128 operator*(uint32_t rhs) const;
@@ -126,16 +126,117 @@ public:
 
   void divrem(uint32_t rhs, uint32_t &out_rem);
 
-  uint128 &operator/=(uint128 DYND_UNUSED(rhs))
+#ifdef DYND_USE_NATIVE_INT128
+  /**
+   * Converts from and to the compiler's unsigned 128-bit integer.
+   */
+  static uint128 from_bits(unsigned __int128 bits)
   {
-    throw std::runtime_error("operator/= is not implemented for uint128");
+    return uint128(static_cast<uint64_t>(bits >> 64), static_cast<uint64_t>(bits));
   }
 
+  unsigned __int128 bits() const { return (static_cast<unsigned __int128>(m_hi) << 64) | m_lo; }
+#endif
+
+  /**
+   * Multiplies, keeping the low 128 bits of the product.
+   */
+  uint128 operator*(const uint128 &rhs) const
+  {
+#ifdef DYND_USE_NATIVE_INT128
+    return from_bits(bits() * rhs.bits());
+#else
+    return multiply(rhs);
+#endif
+  }
+
+  uint128 operator%(const uint128 &rhs) const { return remainder(rhs); }
+
+  uint128 operator&(const uint128 &rhs) const { return uint128(m_hi & rhs.m_hi, m_lo & rhs.m_lo); }
+
+  uint128 operator|(const uint128 &rhs) const { return uint128(m_hi | rhs.m_hi, m_lo | rhs.m_lo); }
+
+  uint128 operator^(const uint128 &rhs) const { return uint128(m_hi ^ rhs.m_hi, m_lo ^ rhs.m_lo); }
+
+  uint128 operator<<(int shift) const
+  {
+    shift &= 127;
+    if (shift == 0) {
+      return *this;
+    }
+    if (shift >= 64) {
+      return uint128(m_lo << (shift - 64), 0ULL);
+    }
+    return uint128((m_hi << shift) | (m_lo >> (64 - shift)), m_lo << shift);
+  }
+
+  uint128 operator>>(int shift) const
+  {
+    shift &= 127;
+    if (shift == 0) {
+      return *this;
+    }
+    if (shift >= 64) {
+      return uint128(0ULL, m_hi >> (shift - 64));
+    }
+    return uint128(m_hi >> shift, (m_lo >> shift) | (m_hi << (64 - shift)));
+  }
+
+  uint128 &operator+=(const uint128 &rhs) { return *this = *this + rhs; }
+
+  uint128 &operator-=(const uint128 &rhs) { return *this = *this - rhs; }
+
+  uint128 &operator*=(const uint128 &rhs) { return *this = *this * rhs; }
+
+  uint128 &operator/=(const uint128 &rhs) { return *this = divide(rhs); }
+
+  uint128 &operator%=(const uint128 &rhs) { return *this = remainder(rhs); }
+
+  /**
+   * Divides, throwing zero_division_error for a zero divisor.
+   */
+  uint128 divide(const uint128 &rhs) const
+  {
+#ifdef DYND_USE_NATIVE_INT128
+    if (!rhs) {
+      throw_zero_division();
+    }
+    return from_bits(bits() / rhs.bits());
+#else
+    uint128 quotient, rem;
+    divrem(rhs, quotient, rem);
+    return quotient;
+#endif
+  }
+
+  uint128 remainder(const uint128 &rhs) const
+  {
+#ifdef DYND_USE_NATIVE_INT128
+    if (!rhs) {
+      throw_zero_division();
+    }
+    return from_bits(bits() % rhs.bits());
+#else
+    uint128 quotient, rem;
+    divrem(rhs, quotient, rem);
+    return rem;
+#endif
+  }
+
+  /**
+   * The portable multiply and divide, used when the compiler has no 128-bit
+   * integer. They are built either way so they can be checked against it.
+   */
+  uint128 multiply(const uint128 &rhs) const;
+  void divrem(const uint128 &rhs, uint128 &out_quotient, uint128 &out_remainder) const;
+
+  static void throw_zero_division();
+
   explicit operator bool() const { return m_lo || m_hi; }
 
-  operator float() const { return m_lo + m_hi * 18446744073709551616.f; }
+  operator float() const { return detail::uint128_to_float<float>(m_hi, m_lo); }
 
-  operator double() const { return m_lo + m_hi * 18446744073709551616.0; }
+  operator double() const { return detail::uint128_to_float<double>(m_hi, m_lo); }
 
   operator char() const { return static_cast<char>(m_lo); }
   operator signed char() const { return static_cast<signed char>(m_lo); }
@@ -154,9 +255,35 @@ template <>
 struct is_integral<uint128> : std::true_type {
 };
 
-inline uint128 operator/(uint128 DYND_UNUSED(lhs), uint128 DYND_UNUSED(rhs))
+inline uint128 operator/(const uint128 &lhs, const uint128 &rhs) { return lhs.divide(rhs); }
+
+/**
+ * Overflow-checked arithmetic. Each stores the wrapped result in ``out``,
+ * returning true if the exact result did not fit in a uint128.
+ */
+inline bool add_overflow(const uint128 &lhs, const uint128 &rhs, uint128 &out)
 {
-  throw std::runtime_error("operator/ is not implemented for int128");
+  out = lhs + rhs;
+  return out < lhs;
+}
+
+inline bool sub_overflow(const uint128 &lhs, const uint128 &rhs, uint128 &out)
+{
+  out = lhs - rhs;
+  return lhs < rhs;
+}
+
+inline bool mul_overflow(const uint128 &lhs, const uint128 &rhs, uint128 &out)
+{
+#ifdef DYND_USE_NATIVE_INT128
+  unsigned __int128 result;
+  bool overflow = __builtin_mul_overflow(lhs.bits(), rhs.bits(), &result);
+  out = uint128::from_bits(result);
+  return overflow;
+#else
+  out = lhs * rhs;
+  return !!rhs && out.divide(rhs) != lhs;
+#endif
 }
 
 } // namespace dynd
@@ -272,13 +399,6 @@ inline bool operator<(unsigned long lhs, const uint128 &rhs) { return uint128(lh
 inline bool operator<(long long lhs, const uint128 &rhs) { return lhs < 0 || uint128(lhs) < rhs; }
 inline bool operator<(unsigned long long lhs, const uint128 &rhs) { return uint128(lhs) < rhs; }
 
-template <typename T, typename dynd::detail::enable_for<T, unsigned char, unsigned short, unsigned int, unsigned long,
-                                                        unsigned long long>::type = 0>
-inline void operator+=(uint128 DYND_UNUSED(lhs), T DYND_UNUSED(rhs))
-{
-  throw std::runtime_error("operator += is not implemented for uint128");
-}
-
 DYNDT_API std::ostream &operator<<(std::ostream &out, const uint128 &val);
 
 } // namespace dynd
@@ -24,7 +24,7 @@ public:
 
   ndt::type resolve(base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), nd::call_graph &cg,
                     const ndt::type &res_tp, size_t narg, const ndt::type *arg_tp, size_t nkwd, const nd::array *kwds,
-                    const std::map<std::string, ndt::type> &tp_vars) {
+                    const ndt::typevar_map &tp_vars) {
     static nd::callable array_field_access = nd::make_callable<nd::get_array_field_callable>();
 
     return array_field_access->resolve(this, nullptr, cg, res_tp, narg, arg_tp, nkwd, kwds, tp_vars);
@@ -326,7 +326,7 @@ bool nd::array::equals_exact(const array &rhs) const {
           ndt::type dst_tp = ndt::make_type<bool1>();
           if (not_equal
                   ->call(dst_tp, 2, tp, arrmeta, const_cast<char *const *>(src), 0, NULL,
-                         std::map<std::string, ndt::type>())
+                         ndt::typevar_map())
                   .as<bool>()) {
             return false;
           }
@@ -33,11 +33,17 @@ nd::callable make_assign() {
 
   ndt::type self_tp = ndt::make_type<ndt::callable_type>(
       ndt::make_type<ndt::any_kind_type>(), {ndt::make_type<ndt::any_kind_type>()},
-      {{ndt::make_type<ndt::option_type>(ndt::make_type<assign_error_mode>()), "error_mode"}});
+      {{ndt::make_type<ndt::option_type>(ndt::make_type<assign_error_mode>()), "error_mode"},
+       {ndt::type("?Fixed * string"), "na_values"}});
 
   auto dispatcher =
       nd::callable::make_all<_bind<assign_error_mode, nd::assign_callable>::type, numeric_types, numeric_types>(
           func_ptr);
+  dispatcher.insert(nd::make_callable<nd::assign_callable<float16, float16>>());
+  dispatcher.insert(nd::make_callable<nd::assign_callable<float, float16>>());
+  dispatcher.insert(nd::make_callable<nd::assign_callable<double, float16>>());
+  dispatcher.insert(nd::make_callable<nd::assign_callable<float16, float>>());
+  dispatcher.insert(nd::make_callable<nd::assign_callable<float16, double>>());
   dispatcher.insert(nd::make_callable<nd::assign_callable<dynd::string, dynd::string>>());
   dispatcher.insert(nd::make_callable<nd::assign_callable<dynd::bytes, dynd::bytes>>());
   dispatcher.insert(nd::make_callable<nd::assign_callable<ndt::fixed_bytes_type, ndt::fixed_bytes_type>>());
@@ -79,23 +85,18 @@ nd::callable make_assign() {
   dispatcher.insert(nd::make_callable<nd::assign_callable<ndt::option_type, ndt::float_kind_type>>());
   dispatcher.insert(nd::make_callable<nd::assign_callable<dynd::string, ndt::type>>());
   dispatcher.insert(nd::make_callable<nd::assign_callable<ndt::type, dynd::string>>());
-  dispatcher.insert(nd::make_callable<nd::assign_callable<ndt::pointer_type, ndt::pointer_type>>());
+  dispatcher.insert({nd::make_callable<nd::assign_callable<ndt::pointer_type, ndt::pointer_type>>(),
+                     nd::make_callable<nd::assign_callable<ndt::categorical_type, ndt::scalar_kind_type>>(),
+                     nd::make_callable<nd::assign_callable<ndt::scalar_kind_type, ndt::categorical_type>>(),
+                     nd::make_callable<nd::assign_callable<ndt::categorical_type, ndt::categorical_type>>()});
   dispatcher.insert(nd::make_callable<nd::int_to_string_assign_callable<int8_t>>());
   dispatcher.insert(nd::make_callable<nd::int_to_string_assign_callable<int16_t>>());
   dispatcher.insert(nd::make_callable<nd::int_to_string_assign_callable<int32_t>>());
-  dispatcher.insert(nd::make_callable<nd::int_to_string_assign_callable<int64_t>>());
-  //  dispatcher.insert({{ndt::make_type<uint8_t>(), ndt::make_type<ndt::string_type>()},
-  //  callable::make<assignment_kernel<ndt::make_type<uint8_t>(),
-  //  ndt::make_type<ndt::string_type>()>>()});
-  //  dispatcher.insert({{ndt::make_type<uint16_t>(), ndt::make_type<ndt::string_type>()},
-  //  callable::make<assignment_kernel<ndt::make_type<uint16_t>(),
-  //  ndt::make_type<ndt::string_type>()>>()});
-  // dispatcher.insert({{ndt::make_type<uint32_t>(), ndt::make_type<ndt::string_type>()},
-  // callable::make<assignment_kernel<ndt::make_type<uint32_t>(),
-  // ndt::make_type<ndt::string_type>()>>()});
-  // dispatcher.insert({{ndt::make_type<uint64_t>(), ndt::make_type<ndt::string_type>()},
-  // callable::make<assignment_kernel<ndt::make_type<uint64_t>(),
-  // ndt::make_type<ndt::string_type>()>>()});
+  dispatcher.insert({nd::make_callable<nd::int_to_string_assign_callable<int64_t>>(),
+                     nd::make_callable<nd::int_to_string_assign_callable<uint8_t>>(),
+                     nd::make_callable<nd::int_to_string_assign_callable<uint16_t>>(),
+                     nd::make_callable<nd::int_to_string_assign_callable<uint32_t>>(),
+                     nd::make_callable<nd::int_to_string_assign_callable<uint64_t>>()});
   dispatcher.insert(nd::make_callable<nd::assign_callable<float, dynd::string>>());
   dispatcher.insert(nd::make_callable<nd::assign_callable<double, dynd::string>>());
   dispatcher.insert(nd::make_callable<nd::assign_callable<ndt::tuple_type, ndt::tuple_type>>());
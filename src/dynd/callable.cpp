@@ -7,12 +7,14 @@
 #include <dynd/assignment.hpp>
 #include <dynd/comparison.hpp>
 #include <dynd/index.hpp>
+#include <dynd/instrumentation.hpp>
 #include <dynd/io.hpp>
 #include <dynd/math.hpp>
 #include <dynd/option.hpp>
 #include <dynd/pointer.hpp>
 #include <dynd/random.hpp>
 #include <dynd/range.hpp>
+#include <dynd/shortvector.hpp>
 #include <dynd/statistics.hpp>
 
 using namespace std;
@@ -33,7 +35,7 @@ public:
   ndt::type resolve(nd::base_callable *DYND_UNUSED(caller), char *DYND_UNUSED(data), nd::call_graph &cg,
                     const ndt::type &dst_tp, size_t DYND_UNUSED(nsrc), const ndt::type *src_tp,
                     size_t DYND_UNUSED(nkwd), const nd::array *DYND_UNUSED(kwds),
-                    const std::map<std::string, ndt::type> &tp_vars) {
+                    const ndt::typevar_map &tp_vars) {
     nd::array error_mode = errmode;
     return nd::assign->resolve(this, nullptr, cg, dst_tp, 1, src_tp, 1, &error_mode, tp_vars);
   }
@@ -55,7 +57,7 @@ void nd::detail::check_narg(const base_callable *self, size_t narg) {
 }
 
 void nd::detail::check_arg(const base_callable *self, intptr_t i, const ndt::type &actual_tp,
-                           const char *DYND_UNUSED(actual_arrmeta), std::map<std::string, ndt::type> &tp_vars) {
+                           const char *DYND_UNUSED(actual_arrmeta), ndt::typevar_map &tp_vars) {
   if (self->is_arg_variadic()) {
     return;
   }
@@ -73,7 +75,22 @@ void nd::detail::check_arg(const base_callable *self, intptr_t i, const ndt::typ
 
 nd::array nd::callable::call(size_t narg, const array *args, size_t nkwd,
                              const pair<const char *, array> *unordered_kwds) const {
-  std::map<std::string, ndt::type> tp_vars;
+  // Two scalars of builtin types skip straight to the computation if the
+  // callable has a direct implementation for them. Instrumented calls take
+  // the full path, so that they are recorded.
+  const builtin_binary_table *builtin_binary = m_ptr->get_builtin_binary_table();
+  if (builtin_binary != NULL && narg == 2 && nkwd == 0 && args[0].get_type().is_builtin() &&
+      args[1].get_type().is_builtin() && !is_instrumentation_enabled()) {
+    const builtin_binary_table::entry &e =
+        (*builtin_binary)(args[0].get_type().unchecked_get_builtin_id(), args[1].get_type().unchecked_get_builtin_id());
+    if (e.func != NULL) {
+      array dst = empty(ndt::type(reinterpret_cast<const ndt::base_type *>(e.ret_id), false));
+      e.func(dst.data(), args[0].cdata(), args[1].cdata());
+      return dst;
+    }
+  }
+
+  ndt::typevar_map tp_vars;
 
   if (!m_ptr->is_arg_variadic() && (narg < m_ptr->get_narg())) {
     std::stringstream ss;
@@ -81,9 +98,10 @@ nd::array nd::callable::call(size_t narg, const array *args, size_t nkwd,
     throw std::invalid_argument(ss.str());
   }
 
-  unique_ptr<ndt::type[]> args_tp(new ndt::type[narg]);
-  unique_ptr<const char *[]> args_arrmeta(new const char *[narg]);
-  unique_ptr<array[]> kwds(new array[narg + m_ptr->get_nkwd()]);
+  // Calls usually have only a few arguments, which then need no allocation
+  shortvector<ndt::type, 4> args_tp(narg);
+  shortvector<const char *, 4> args_arrmeta(narg);
+  shortvector<array, 4> kwds(narg + m_ptr->get_nkwd());
 
   size_t j = 0;
   if (m_ptr->is_arg_variadic()) {
@@ -114,7 +132,7 @@ nd::array nd::callable::call(size_t narg, const array *args, size_t nkwd,
 
   array dst;
 
-  const std::vector<std::pair<ndt::type, std::string>> kwd_tp = m_ptr->get_kwd_types();
+  const std::vector<std::pair<ndt::type, std::string>> &kwd_tp = m_ptr->get_kwd_types();
   for (; j < nkwd; ++j, ++unordered_kwds) {
     intptr_t k = m_ptr->get_kwd_index(unordered_kwds->first);
 
@@ -5,6 +5,7 @@
 
 #include <dynd/callables/base_callable.hpp>
 #include <dynd/callables/call_graph.hpp>
+#include <dynd/instrumentation.hpp>
 
 using namespace std;
 using namespace dynd;
@@ -13,66 +14,82 @@ nd::base_callable::~base_callable() {}
 
 nd::array nd::base_callable::call(ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp,
                                   const char *const *src_arrmeta, char *const *src_data, size_t nkwd, const array *kwds,
-                                  const std::map<std::string, ndt::type> &tp_vars) {
+                                  const ndt::typevar_map &tp_vars) {
+  DYND_INSTRUMENT_CALL_BEGIN(this);
   call_graph cg;
   dst_tp = resolve(nullptr, nullptr, cg, dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
+  DYND_INSTRUMENT_CALL_RESOLVED();
 
   // Allocate the destination array
   array dst = alloc(&dst_tp);
 
   // Generate and evaluate the ckernel
-  kernel_builder kb(cg.get());
+  kernel_builder kb(cg.get(), cg.kernel_size_hint());
   kb(kernel_request_single, nullptr, dst->metadata(), nsrc, src_arrmeta);
+  DYND_INSTRUMENT_CALL_BUILT(kb);
 
   kernel_single_t fn = kb.get()->get_function<kernel_single_t>();
   fn(kb.get(), dst.data(), src_data);
+  DYND_INSTRUMENT_CALL_EXECUTED(dst_tp, dst->metadata());
 
   return dst;
 }
 
 nd::array nd::base_callable::call(ndt::type &dst_tp, size_t nsrc, const ndt::type *src_tp,
                                   const char *const *src_arrmeta, const array *src_data, size_t nkwd, const array *kwds,
-                                  const std::map<std::string, ndt::type> &tp_vars) {
+                                  const ndt::typevar_map &tp_vars) {
+  DYND_INSTRUMENT_CALL_BEGIN(this);
   call_graph cg;
   dst_tp = resolve(nullptr, nullptr, cg, dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
+  DYND_INSTRUMENT_CALL_RESOLVED();
 
   // Allocate the destination array
   array dst = empty(dst_tp);
 
   // Generate and evaluate the kernel
-  kernel_builder kb(cg.get());
+  kernel_builder kb(cg.get(), cg.kernel_size_hint());
   kb(kernel_request_call, nullptr, dst->metadata(), nsrc, src_arrmeta);
+  DYND_INSTRUMENT_CALL_BUILT(kb);
 
   kernel_call_t fn = kb.get()->get_function<kernel_call_t>();
   fn(kb.get(), &dst, src_data);
+  DYND_INSTRUMENT_CALL_EXECUTED(dst.get_type(), dst->metadata());
 
   return dst;
 }
 
 void nd::base_callable::call(const ndt::type &dst_tp, const char *dst_arrmeta, char *dst_data, size_t nsrc,
                              const ndt::type *src_tp, const char *const *src_arrmeta, char *const *src_data,
-                             size_t nkwd, const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                             size_t nkwd, const array *kwds, const ndt::typevar_map &tp_vars) {
+  DYND_INSTRUMENT_CALL_BEGIN(this);
   call_graph cg;
   resolve(nullptr, nullptr, cg, dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
+  DYND_INSTRUMENT_CALL_RESOLVED();
 
   // Generate and evaluate the ckernel
-  kernel_builder kb(cg.get());
+  kernel_builder kb(cg.get(), cg.kernel_size_hint());
   kb(kernel_request_single, nullptr, dst_arrmeta, nsrc, src_arrmeta);
+  DYND_INSTRUMENT_CALL_BUILT(kb);
 
   kernel_single_t fn = kb.get()->get_function<kernel_single_t>();
   fn(kb.get(), dst_data, src_data);
+  DYND_INSTRUMENT_CALL_EXECUTED(dst_tp, dst_arrmeta);
 }
 
 void nd::base_callable::call(const ndt::type &dst_tp, const char *dst_arrmeta, array *dst, size_t nsrc,
                              const ndt::type *src_tp, const char *const *src_arrmeta, const array *src, size_t nkwd,
-                             const array *kwds, const std::map<std::string, ndt::type> &tp_vars) {
+                             const array *kwds, const ndt::typevar_map &tp_vars) {
+  DYND_INSTRUMENT_CALL_BEGIN(this);
   call_graph cg;
   resolve(nullptr, nullptr, cg, dst_tp, nsrc, src_tp, nkwd, kwds, tp_vars);
+  DYND_INSTRUMENT_CALL_RESOLVED();
 
   // Generate and evaluate the ckernel
-  kernel_builder kb(cg.get());
+  kernel_builder kb(cg.get(), cg.kernel_size_hint());
   kb(kernel_request_call, nullptr, dst_arrmeta, nsrc, src_arrmeta);
+  DYND_INSTRUMENT_CALL_BUILT(kb);
 
   kernel_call_t fn = kb.get()->get_function<kernel_call_t>();
   fn(kb.get(), dst, src);
+  DYND_INSTRUMENT_CALL_EXECUTED((*dst).get_type(), (*dst)->metadata());
 }
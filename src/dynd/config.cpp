@@ -3,11 +3,18 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <algorithm>
+#include <atomic>
 #include <regex>
+#include <stdexcept>
 #include <string>
 
 #if __linux__ || __APPLE__
 #include <dlfcn.h>
+#include <unistd.h>
+#if __APPLE__
+#include <sys/sysctl.h>
+#endif
 #elif defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
@@ -61,3 +68,86 @@ void dynd::load(const std::string &DYND_IGNORE_UNUSED(raw_path)) {
   init();
 #endif
 }
+
+namespace {
+
+// Typical sizes of the L1 data, L2 and L3 caches
+const size_t default_data_cache_size[3] = {32768, 262144, 8388608};
+
+size_t detect_data_cache_size(int level) {
+  long size = -1;
+#if defined(__linux__) && defined(_SC_LEVEL1_DCACHE_SIZE)
+  switch (level) {
+  case 1:
+    size = sysconf(_SC_LEVEL1_DCACHE_SIZE);
+    break;
+  case 2:
+    size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    break;
+  case 3:
+    size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    break;
+  }
+#elif defined(__APPLE__)
+  static const char *names[3] = {"hw.l1dcachesize", "hw.l2cachesize", "hw.l3cachesize"};
+  int64_t value = 0;
+  size_t value_size = sizeof(value);
+  if (sysctlbyname(names[level - 1], &value, &value_size, NULL, 0) == 0) {
+    size = static_cast<long>(value);
+  }
+#endif
+  // Some virtualized environments report zero
+  return (size > 0) ? static_cast<size_t>(size) : default_data_cache_size[level - 1];
+}
+
+struct data_cache_sizes {
+  size_t size[3];
+
+  data_cache_sizes() {
+    for (int level = 1; level <= 3; ++level) {
+      size[level - 1] = detect_data_cache_size(level);
+    }
+  }
+};
+
+const data_cache_sizes &get_data_cache_sizes() {
+  static const data_cache_sizes sizes;
+  return sizes;
+}
+
+std::atomic<size_t> buffer_chunk_bytes(0);
+std::atomic<size_t> nontemporal_store_threshold(0);
+
+} // anonymous namespace
+
+size_t dynd::get_data_cache_size(int level) {
+  if (level < 1 || level > 3) {
+    throw invalid_argument("data cache level must be 1, 2 or 3, got " + to_string(level));
+  }
+  return get_data_cache_sizes().size[level - 1];
+}
+
+size_t dynd::get_buffer_chunk_size(size_t element_size) {
+  size_t bytes = buffer_chunk_bytes.load(memory_order_relaxed);
+  if (bytes == 0) {
+    bytes = get_data_cache_size(1) / 2;
+  }
+  // Keep chunks long enough to amortize the per-chunk calls, and the buffers
+  // bounded for large elements
+  return min(max(bytes / max(element_size, size_t(1)), size_t(16)), size_t(65536));
+}
+
+void dynd::set_buffer_chunk_bytes(size_t bytes) { buffer_chunk_bytes.store(bytes, memory_order_relaxed); }
+
+size_t dynd::get_nontemporal_store_threshold() {
+  size_t bytes = nontemporal_store_threshold.load(memory_order_relaxed);
+  if (bytes == 0) {
+    const data_cache_sizes &sizes = get_data_cache_sizes();
+    bytes = max(sizes.size[1], sizes.size[2]);
+  }
+  return bytes;
+}
+
+void dynd::set_nontemporal_store_threshold(size_t bytes) {
+  nontemporal_store_threshold.store(bytes, memory_order_relaxed);
+}
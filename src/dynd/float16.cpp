@@ -3,11 +3,18 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
 
 #include <dynd/config.hpp>
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define DYND_USE_F16C 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 using namespace std;
 using namespace dynd;
 
@@ -372,3 +379,216 @@ dynd::float16::operator float128() const
 {
   return float128(double(*this));
 }
+
+namespace {
+
+inline uint32_t float_as_bits(float value)
+{
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline float bits_as_float(uint32_t bits)
+{
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+inline uint64_t double_as_bits(double value)
+{
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+inline double bits_as_double(uint64_t bits)
+{
+  double value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Branch-free equivalent of halfbits_to_float, so loops over it vectorize.
+// The exponent is rebiased with an add, inf/NaN get a second add to reach
+// the all-ones exponent, and subnormals are renormalized by subtracting the
+// smallest normal float16 as a float.
+inline float halfbits_to_float_branchless(uint16_t h)
+{
+  uint32_t shifted = static_cast<uint32_t>(h & 0x7fffu) << 13;
+  uint32_t exp = shifted & 0x0f800000u;
+  uint32_t bits = shifted + 0x38000000u;
+  bits += (exp == 0x0f800000u) ? 0x38000000u : 0u;
+  uint32_t subnormal_bits = float_as_bits(bits_as_float(bits + 0x00800000u) - bits_as_float(0x38800000u));
+  bits = (exp == 0) ? subnormal_bits : bits;
+  return bits_as_float(bits | (static_cast<uint32_t>(h & 0x8000u) << 16));
+}
+
+// Branch-free equivalent of halfbits_to_double
+inline double halfbits_to_double_branchless(uint16_t h)
+{
+  uint64_t shifted = static_cast<uint64_t>(h & 0x7fffu) << 42;
+  uint64_t exp = shifted & 0x01f0000000000000ULL;
+  uint64_t bits = shifted + 0x3f00000000000000ULL;
+  bits += (exp == 0x01f0000000000000ULL) ? 0x3f00000000000000ULL : 0ULL;
+  uint64_t subnormal_bits =
+      double_as_bits(bits_as_double(bits + 0x0010000000000000ULL) - bits_as_double(0x3f10000000000000ULL));
+  bits = (exp == 0) ? subnormal_bits : bits;
+  return bits_as_double(bits | (static_cast<uint64_t>(h & 0x8000u) << 48));
+}
+
+#ifdef DYND_USE_F16C
+
+bool cpu_has_f16c()
+{
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+  // F16C (bit 29), AVX (bit 28) and OSXSAVE (bit 27)
+  const unsigned int required = (1u << 29) | (1u << 28) | (1u << 27);
+  if ((ecx & required) != required) {
+    return false;
+  }
+  // The OS has to save the SSE and AVX register state
+  unsigned int xcr0_lo, xcr0_hi;
+  __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+  return (xcr0_lo & 0x6u) == 0x6u;
+}
+
+bool has_f16c()
+{
+  static const bool value = cpu_has_f16c();
+  return value;
+}
+
+// Returns a nonzero mask if any of the 8 float16 values is a signaling NaN,
+// which vcvtph2ps would quiet while the scalar conversion keeps its payload
+__attribute__((target("avx,f16c"))) inline int signaling_nan_mask(__m128i h)
+{
+  __m128i nan_exp = _mm_cmpeq_epi16(_mm_and_si128(h, _mm_set1_epi16(0x7e00)), _mm_set1_epi16(0x7c00));
+  __m128i zero_sig = _mm_cmpeq_epi16(_mm_and_si128(h, _mm_set1_epi16(0x01ff)), _mm_setzero_si128());
+  return _mm_movemask_epi8(_mm_andnot_si128(zero_sig, nan_exp));
+}
+
+__attribute__((target("avx,f16c"))) void halfbits_to_floats_f16c(float *dst, const uint16_t *src, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    if (signaling_nan_mask(h)) {
+      for (size_t j = i; j != i + 8; ++j) {
+        dst[j] = halfbits_to_float_branchless(src[j]);
+      }
+    }
+    else {
+      _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+  }
+  for (; i != count; ++i) {
+    dst[i] = halfbits_to_float_branchless(src[i]);
+  }
+}
+
+__attribute__((target("avx,f16c"))) void halfbits_to_doubles_f16c(double *dst, const uint16_t *src, size_t count)
+{
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    if (signaling_nan_mask(h)) {
+      for (size_t j = i; j != i + 8; ++j) {
+        dst[j] = halfbits_to_double_branchless(src[j]);
+      }
+    }
+    else {
+      __m256 f = _mm256_cvtph_ps(h);
+      _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm256_castps256_ps128(f)));
+      _mm256_storeu_pd(dst + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(f, 1)));
+    }
+  }
+  for (; i != count; ++i) {
+    dst[i] = halfbits_to_double_branchless(src[i]);
+  }
+}
+
+__attribute__((target("avx,f16c"))) void floats_to_halfbits_f16c(uint16_t *dst, const float *src, size_t count)
+{
+  // vcvtps2ph rounds to nearest even like float_to_halfbits. Blocks holding a
+  // value which would overflow, underflow to a subnormal, or is inf/NaN go
+  // through the scalar conversion so that errors and NaN payloads match.
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256 min_normal = _mm256_set1_ps(6.103515625e-05f); // 2^-14
+  const __m256 overflow = _mm256_set1_ps(65520.0f);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 f = _mm256_loadu_ps(src + i);
+    __m256 a = _mm256_and_ps(f, abs_mask);
+    __m256 ok = _mm256_or_ps(_mm256_and_ps(_mm256_cmp_ps(a, min_normal, _CMP_GE_OQ), _mm256_cmp_ps(a, overflow, _CMP_LT_OQ)),
+                             _mm256_cmp_ps(a, _mm256_setzero_ps(), _CMP_EQ_OQ));
+    if (_mm256_movemask_ps(ok) == 0xff) {
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm256_cvtps_ph(f, 0));
+    }
+    else {
+      for (size_t j = i; j != i + 8; ++j) {
+        dst[j] = float_to_halfbits(src[j]);
+      }
+    }
+  }
+  for (; i != count; ++i) {
+    dst[i] = float_to_halfbits(src[i]);
+  }
+}
+
+#endif // DYND_USE_F16C
+
+} // anonymous namespace
+
+void dynd::halfbits_to_floats(float *dst, const uint16_t *src, size_t count)
+{
+#ifdef DYND_USE_F16C
+  if (has_f16c()) {
+    halfbits_to_floats_f16c(dst, src, count);
+    return;
+  }
+#endif
+  for (size_t i = 0; i != count; ++i) {
+    dst[i] = halfbits_to_float_branchless(src[i]);
+  }
+}
+
+void dynd::halfbits_to_doubles(double *dst, const uint16_t *src, size_t count)
+{
+#ifdef DYND_USE_F16C
+  if (has_f16c()) {
+    halfbits_to_doubles_f16c(dst, src, count);
+    return;
+  }
+#endif
+  for (size_t i = 0; i != count; ++i) {
+    dst[i] = halfbits_to_double_branchless(src[i]);
+  }
+}
+
+void dynd::floats_to_halfbits(uint16_t *dst, const float *src, size_t count)
+{
+  // vcvtps2ph only matches the scalar conversion when it rounds ties to even
+#if defined(DYND_USE_F16C) && DYND_FLOAT16_ROUND_TIES_TO_EVEN
+  if (has_f16c()) {
+    floats_to_halfbits_f16c(dst, src, count);
+    return;
+  }
+#endif
+  for (size_t i = 0; i != count; ++i) {
+    dst[i] = float_to_halfbits(src[i]);
+  }
+}
+
+void dynd::doubles_to_halfbits(uint16_t *dst, const double *src, size_t count)
+{
+  // Narrowing through float32 would round twice, so this always uses the
+  // direct scalar conversion
+  for (size_t i = 0; i != count; ++i) {
+    dst[i] = double_to_halfbits(src[i]);
+  }
+}
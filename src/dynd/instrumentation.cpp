@@ -0,0 +1,241 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+
+#include <dynd/instrumentation.hpp>
+#include <dynd/registry.hpp>
+#include <dynd/types/fixed_dim_type.hpp>
+
+using namespace std;
+using namespace dynd;
+
+namespace {
+
+typedef chrono::steady_clock clock_type;
+
+const size_t max_trace_events = size_t(1) << 20;
+
+struct callable_record {
+  // Keeps the callable alive, so its address is not reused by another
+  nd::callable self;
+  nd::callable_stats stats;
+};
+
+struct trace_event {
+  const callable_record *record;
+  size_t thread;
+  clock_type::time_point start, resolved, built, executed;
+};
+
+struct instrumentation_state {
+  mutex lock;
+  map<const nd::base_callable *, callable_record> records;
+  vector<trace_event> events;
+  clock_type::time_point epoch;
+
+  instrumentation_state() : epoch(clock_type::now()) {}
+};
+
+atomic<bool> instrumentation_enabled(false);
+
+instrumentation_state &get_state() {
+  static instrumentation_state state;
+  return state;
+}
+
+bool find_registered_path(const registry_entry &entry, const nd::base_callable *self, std::string &path) {
+  for (const auto &pair : entry) {
+    const registry_entry &child = pair.second;
+    if (child.is_namespace()) {
+      if (find_registered_path(child, self, path)) {
+        return true;
+      }
+    } else if (child.value().get() == self) {
+      path = child.path();
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string callable_name(const nd::base_callable *self) {
+  std::string path;
+  if (find_registered_path(registered(), self, path)) {
+    return path;
+  }
+  stringstream ss;
+  ss << self->get_type();
+  return ss.str();
+}
+
+// The number of elements in the leading fixed dimensions
+uint64_t element_count(const ndt::type &tp, const char *arrmeta) {
+  uint64_t count = 1;
+  ndt::type el_tp = tp;
+  while (el_tp.get_id() == fixed_dim_id && arrmeta != NULL) {
+    const fixed_dim_type_arrmeta *md = reinterpret_cast<const fixed_dim_type_arrmeta *>(arrmeta);
+    count *= static_cast<uint64_t>(md->dim_size);
+    arrmeta += sizeof(fixed_dim_type_arrmeta);
+    el_tp = el_tp.extended<ndt::fixed_dim_type>()->get_element_type();
+  }
+  return count;
+}
+
+uint64_t nanoseconds(clock_type::duration d) {
+  return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(d).count());
+}
+
+double microseconds(clock_type::duration d) {
+  return static_cast<double>(chrono::duration_cast<chrono::nanoseconds>(d).count()) / 1000.0;
+}
+
+// A small id for the calling thread, for the trace
+size_t current_thread_index() {
+  static atomic<size_t> next_index(0);
+  thread_local size_t index = next_index++;
+  return index;
+}
+
+void print_json_string(ostream &o, const std::string &s) {
+  o << '"';
+  for (char c : s) {
+    switch (c) {
+    case '"':
+      o << "\\\"";
+      break;
+    case '\\':
+      o << "\\\\";
+      break;
+    case '\n':
+      o << "\\n";
+      break;
+    default:
+      o << c;
+      break;
+    }
+  }
+  o << '"';
+}
+
+void print_trace_event(ostream &o, const trace_event &e, const char *phase, clock_type::time_point begin,
+                       clock_type::time_point end, const clock_type::time_point &epoch) {
+  // Keep the nanoseconds, which the default stream precision would not
+  char times[64];
+  snprintf(times, sizeof(times), "\"ts\": %.3f, \"dur\": %.3f", microseconds(begin - epoch),
+           microseconds(end - begin));
+
+  o << "{\"name\": ";
+  print_json_string(o, e.record->stats.name);
+  o << ", \"cat\": \"" << phase << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": " << e.thread << ", " << times << "}";
+}
+
+} // anonymous namespace
+
+bool nd::is_instrumentation_available() {
+#ifdef DYND_INSTRUMENT
+  return true;
+#else
+  return false;
+#endif
+}
+
+void nd::set_instrumentation_enabled(bool enabled) {
+  // Creates the state, and with it the trace epoch, before any call is timed
+  get_state();
+  instrumentation_enabled.store(enabled);
+}
+
+bool nd::is_instrumentation_enabled() { return instrumentation_enabled.load(memory_order_relaxed); }
+
+void nd::detail::record_call(base_callable *self, clock_type::time_point start, clock_type::time_point resolved,
+                             clock_type::time_point built, size_t kernel_bytes, clock_type::time_point executed,
+                             const ndt::type &dst_tp, const char *dst_arrmeta) {
+  uint64_t elements = element_count(dst_tp, dst_arrmeta);
+
+  instrumentation_state &state = get_state();
+  lock_guard<mutex> guard(state.lock);
+
+  auto it = state.records.find(self);
+  if (it == state.records.end()) {
+    callable_record record{callable(self, true), callable_stats{callable_name(self), 0, 0, 0, 0, 0, 0}};
+    it = state.records.emplace(self, std::move(record)).first;
+  }
+
+  callable_stats &stats = it->second.stats;
+  ++stats.calls;
+  stats.resolve_ns += nanoseconds(resolved - start);
+  stats.build_ns += nanoseconds(built - resolved);
+  stats.kernel_bytes += kernel_bytes;
+  stats.execute_ns += nanoseconds(executed - built);
+  stats.elements += elements;
+
+  if (state.events.size() < max_trace_events) {
+    state.events.push_back(
+        trace_event{&it->second, current_thread_index(), start, resolved, built, executed});
+  }
+}
+
+vector<nd::callable_stats> nd::get_callable_stats() {
+  vector<callable_stats> result;
+  instrumentation_state &state = get_state();
+  {
+    lock_guard<mutex> guard(state.lock);
+    for (const auto &pair : state.records) {
+      result.push_back(pair.second.stats);
+    }
+  }
+
+  sort(result.begin(), result.end(), [](const callable_stats &lhs, const callable_stats &rhs) {
+    return lhs.resolve_ns + lhs.build_ns + lhs.execute_ns > rhs.resolve_ns + rhs.build_ns + rhs.execute_ns;
+  });
+  return result;
+}
+
+void nd::reset_callable_stats() {
+  instrumentation_state &state = get_state();
+  lock_guard<mutex> guard(state.lock);
+  state.events.clear();
+  state.records.clear();
+  state.epoch = clock_type::now();
+}
+
+void nd::dump_callable_stats_json(ostream &o) {
+  vector<callable_stats> stats = get_callable_stats();
+
+  o << "{\"callables\": [";
+  for (size_t i = 0; i < stats.size(); ++i) {
+    const callable_stats &s = stats[i];
+    o << (i == 0 ? "\n  " : ",\n  ") << "{\"name\": ";
+    print_json_string(o, s.name);
+    o << ", \"calls\": " << s.calls << ", \"resolve_ns\": " << s.resolve_ns << ", \"build_ns\": " << s.build_ns
+      << ", \"kernel_bytes\": " << s.kernel_bytes << ", \"execute_ns\": " << s.execute_ns
+      << ", \"elements\": " << s.elements << "}";
+  }
+  o << "\n]}\n";
+}
+
+void nd::dump_callable_trace(ostream &o) {
+  instrumentation_state &state = get_state();
+  lock_guard<mutex> guard(state.lock);
+
+  o << "{\"traceEvents\": [";
+  for (size_t i = 0; i < state.events.size(); ++i) {
+    const trace_event &e = state.events[i];
+    o << (i == 0 ? "\n  " : ",\n  ");
+    print_trace_event(o, e, "resolve", e.start, e.resolved, state.epoch);
+    o << ",\n  ";
+    print_trace_event(o, e, "build", e.resolved, e.built, state.epoch);
+    o << ",\n  ";
+    print_trace_event(o, e, "execute", e.built, e.executed, state.epoch);
+  }
+  o << "\n], \"displayTimeUnit\": \"ns\"}\n";
+}
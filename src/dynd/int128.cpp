@@ -8,6 +8,7 @@
 #include <cmath>
 
 #include <dynd/config.hpp>
+#include <dynd/exceptions.hpp>
 
 using namespace std;
 using namespace dynd;
@@ -75,20 +76,35 @@ dynd::int128::int128(const float128 &DYND_UNUSED(value))
 
 int128 dynd::int128::operator*(uint32_t rhs) const
 {
-  if ((int64_t)m_hi < 0) {
-    // TODO: fix case for minimum int, which will recurse forever
-    return -(-(*this) * rhs);
-  } else {
-    // Split the multiplication into three
-    // First product
-    uint64_t lo_partial = (m_lo & 0x00000000ffffffffULL) * rhs;
-    // Second product
-    uint64_t tmp = ((m_lo & 0xffffffff00000000ULL) >> 32) * rhs;
-    uint64_t lo = lo_partial + (tmp << 32);
-    uint64_t hi = (tmp >> 32) + (lo < lo_partial);
-    // Third product
-    hi += m_hi * rhs;
-    return int128(hi, lo);
+  // The low 128 bits of a twos complement product don't depend on the signs,
+  // so negative values need no special case
+  uint128 product = uint128(m_hi, m_lo) * rhs;
+  return int128(product.m_hi, product.m_lo);
+}
+
+void dynd::int128::throw_zero_division() { throw zero_division_error("Integer division or modulo by zero."); }
+
+int128 dynd::int128::multiply(const int128 &rhs) const
+{
+  uint128 product = uint128(m_hi, m_lo) * uint128(rhs.m_hi, rhs.m_lo);
+  return int128(product.m_hi, product.m_lo);
+}
+
+void dynd::int128::divrem(const int128 &rhs, int128 &out_quotient, int128 &out_remainder) const
+{
+  // Divide the magnitudes, then apply the signs so the quotient truncates
+  // toward zero and the remainder has the sign of the dividend
+  bool negative = is_negative(), rhs_negative = rhs.is_negative();
+  int128 lhs_abs = negative ? -*this : *this, rhs_abs = rhs_negative ? -rhs : rhs;
+  uint128 quotient, remainder;
+  uint128(lhs_abs.m_hi, lhs_abs.m_lo).divrem(uint128(rhs_abs.m_hi, rhs_abs.m_lo), quotient, remainder);
+  out_quotient = int128(quotient.m_hi, quotient.m_lo);
+  out_remainder = int128(remainder.m_hi, remainder.m_lo);
+  if (negative != rhs_negative) {
+    out_quotient = -out_quotient;
+  }
+  if (negative) {
+    out_remainder = -out_remainder;
   }
 }
 
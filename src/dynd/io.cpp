@@ -3,12 +3,484 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <cstring>
+#include <fstream>
+#include <vector>
+
 #include <dynd/callables/serialize_callable.hpp>
 #include <dynd/functional.hpp>
 #include <dynd/io.hpp>
+#include <dynd/memblock/memmap_memory_block.hpp>
+#include <dynd/types/struct_type.hpp>
+#include <dynd/types/tuple_type.hpp>
+#include <dynd/types/var_dim_type.hpp>
 
 using namespace std;
 using namespace dynd;
 
 DYND_API nd::callable nd::serialize = nd::functional::reduction(
     [] { return bytes(); }, nd::make_callable<nd::serialize_callable<ndt::scalar_kind_type>>());
+
+namespace {
+
+const char container_magic[8] = {'D', 'Y', 'N', 'D', 'B', 'I', 'N', '\0'};
+const uint32_t container_version = 1;
+const uint32_t container_byte_order = 0x01020304;
+
+// Sections of the file start at this alignment
+const size_t container_alignment = 64;
+
+struct container_header {
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint64_t datashape_offset;
+  uint64_t datashape_size;
+  uint64_t data_offset;
+  uint64_t data_size;
+  uint64_t heap_offset;
+  uint64_t heap_size;
+};
+
+static_assert(sizeof(container_header) == 64, "container_header must be 64 bytes");
+
+// A string or bytes value in the file, pointing at its bytes in the heap section
+struct container_bytes {
+  uint64_t offset;
+  uint64_t size;
+};
+
+static_assert(sizeof(container_bytes) <= sizeof(dynd::string), "container_bytes must fit in a string");
+static_assert(sizeof(container_bytes) <= sizeof(dynd::bytes), "container_bytes must fit in a bytes");
+
+inline size_t align_to(size_t offset, size_t alignment) { return (offset + alignment - 1) & ~(alignment - 1); }
+
+size_t default_data_size(const ndt::type &tp) {
+  return tp.is_builtin() ? tp.get_data_size() : tp.extended()->get_default_data_size();
+}
+
+/**
+ * The fields of a tuple or struct, which share their arrmeta layout but not a
+ * base class.
+ */
+class field_layout {
+  intptr_t m_field_count;
+  const ndt::type *m_field_tps;
+  const uintptr_t *m_arrmeta_offsets;
+
+public:
+  field_layout(const ndt::type &tp) {
+    if (tp.get_id() == struct_id) {
+      const ndt::struct_type *stp = tp.extended<ndt::struct_type>();
+      m_field_count = stp->get_field_count();
+      m_field_tps = stp->get_field_types_raw();
+      m_arrmeta_offsets = stp->get_arrmeta_offsets_raw();
+    } else {
+      const ndt::tuple_type *ttp = tp.extended<ndt::tuple_type>();
+      m_field_count = ttp->get_field_count();
+      m_field_tps = ttp->get_field_types_raw();
+      m_arrmeta_offsets = ttp->get_arrmeta_offsets_raw();
+    }
+  }
+
+  intptr_t get_field_count() const { return m_field_count; }
+  const ndt::type &get_field_type(intptr_t i) const { return m_field_tps[i]; }
+  const ndt::type *get_field_types_raw() const { return m_field_tps; }
+  uintptr_t get_arrmeta_offset(intptr_t i) const { return m_arrmeta_offsets[i]; }
+};
+
+/**
+ * Whether the type lays out in the file exactly as it does in memory, so a
+ * loaded array can point straight at the mapped pages. Strings and bytes own
+ * their memory, so they have to be copied out.
+ */
+bool is_mappable(const ndt::type &tp) {
+  switch (tp.get_id()) {
+  case string_id:
+  case bytes_id:
+    return false;
+  case fixed_dim_id:
+  case var_dim_id:
+    return is_mappable(tp.extended<ndt::base_dim_type>()->get_element_type());
+  case tuple_id:
+  case struct_id: {
+    field_layout ttp(tp);
+    for (intptr_t i = 0; i != ttp.get_field_count(); ++i) {
+      if (!is_mappable(ttp.get_field_type(i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+  default:
+    return true;
+  }
+}
+
+void check_storable(const ndt::type &tp) {
+  switch (tp.get_id()) {
+  case string_id:
+  case bytes_id:
+    return;
+  case fixed_dim_id:
+  case var_dim_id:
+    check_storable(tp.extended<ndt::base_dim_type>()->get_element_type());
+    return;
+  case tuple_id:
+  case struct_id: {
+    field_layout ttp(tp);
+    for (intptr_t i = 0; i != ttp.get_field_count(); ++i) {
+      check_storable(ttp.get_field_type(i));
+    }
+    return;
+  }
+  default:
+    if (tp.is_symbolic() || tp.is_expression() ||
+        (tp.get_flags() & (type_flag_blockref | type_flag_destructor)) != 0) {
+      stringstream ss;
+      ss << "cannot store a value of type " << tp << " in a binary container";
+      throw type_error(ss.str());
+    }
+    return;
+  }
+}
+
+/**
+ * Writes values in their default layout, with var_dim elements and string
+ * bytes appended to a separate heap. Positions are offsets rather than
+ * pointers, since appending to the heap may move it.
+ */
+class container_writer {
+  vector<char> &m_heap;
+
+  size_t heap_allocate(size_t size, size_t alignment) {
+    size_t offset = align_to(m_heap.size(), alignment);
+    m_heap.resize(offset + size);
+    return offset;
+  }
+
+public:
+  container_writer(vector<char> &heap) : m_heap(heap) {}
+
+  void write(const ndt::type &tp, const char *arrmeta, const char *src, vector<char> &dst, size_t dst_offset) {
+    switch (tp.get_id()) {
+    case fixed_dim_id: {
+      const fixed_dim_type_arrmeta *md = reinterpret_cast<const fixed_dim_type_arrmeta *>(arrmeta);
+      const ndt::type &el_tp = tp.extended<ndt::base_dim_type>()->get_element_type();
+      size_t el_size = default_data_size(el_tp);
+      if (el_tp.is_builtin() && md->stride == static_cast<intptr_t>(el_size)) {
+        memcpy(dst.data() + dst_offset, src, md->dim_size * el_size);
+        return;
+      }
+      for (intptr_t i = 0; i != md->dim_size; ++i) {
+        write(el_tp, arrmeta + sizeof(fixed_dim_type_arrmeta), src + i * md->stride, dst, dst_offset + i * el_size);
+      }
+      return;
+    }
+    case var_dim_id: {
+      const ndt::var_dim_type::metadata_type *md = reinterpret_cast<const ndt::var_dim_type::metadata_type *>(arrmeta);
+      const ndt::var_dim_type::data_type *d = reinterpret_cast<const ndt::var_dim_type::data_type *>(src);
+      const ndt::type &el_tp = tp.extended<ndt::base_dim_type>()->get_element_type();
+      size_t el_size = default_data_size(el_tp);
+      size_t offset = heap_allocate(d->size * el_size, el_tp.get_data_alignment());
+      const char *el_src = d->begin + md->offset;
+      for (size_t i = 0; i != d->size; ++i) {
+        write(el_tp, arrmeta + sizeof(ndt::var_dim_type::metadata_type), el_src + i * md->stride, m_heap,
+              offset + i * el_size);
+      }
+      // The begin pointer is stored relative to the heap section
+      ndt::var_dim_type::data_type out = {reinterpret_cast<char *>(offset), d->size};
+      memcpy(dst.data() + dst_offset, &out, sizeof(out));
+      return;
+    }
+    case tuple_id:
+    case struct_id: {
+      field_layout ttp(tp);
+      intptr_t field_count = ttp.get_field_count();
+      const uintptr_t *src_offsets = reinterpret_cast<const uintptr_t *>(arrmeta);
+      vector<uintptr_t> dst_offsets(field_count);
+      ndt::tuple_type::fill_default_data_offsets(field_count, ttp.get_field_types_raw(), dst_offsets.data());
+      for (intptr_t i = 0; i != field_count; ++i) {
+        write(ttp.get_field_type(i), arrmeta + ttp.get_arrmeta_offset(i), src + src_offsets[i], dst,
+              dst_offset + dst_offsets[i]);
+      }
+      return;
+    }
+    case string_id:
+    case bytes_id: {
+      // string and bytes share the sso_bytestring layout
+      const bytes *s = reinterpret_cast<const bytes *>(src);
+      size_t offset = heap_allocate(s->size(), 1);
+      if (s->size() > 0) {
+        memcpy(m_heap.data() + offset, s->data(), s->size());
+      }
+      container_bytes out = {offset, s->size()};
+      memcpy(dst.data() + dst_offset, &out, sizeof(out));
+      return;
+    }
+    default:
+      memcpy(dst.data() + dst_offset, src, tp.get_data_size());
+      return;
+    }
+  }
+};
+
+/**
+ * Points the var_dim arrmeta of a mapped array at the mapped heap section.
+ * The stored begin pointers are heap offsets, so the heap address goes in the
+ * arrmeta offset that var_dim already adds to every begin pointer.
+ */
+void map_arrmeta(const ndt::type &tp, char *arrmeta, const nd::memory_block &blockref, char *heap) {
+  switch (tp.get_id()) {
+  case fixed_dim_id:
+    map_arrmeta(tp.extended<ndt::base_dim_type>()->get_element_type(), arrmeta + sizeof(fixed_dim_type_arrmeta),
+                blockref, heap);
+    return;
+  case var_dim_id: {
+    ndt::var_dim_type::metadata_type *md = reinterpret_cast<ndt::var_dim_type::metadata_type *>(arrmeta);
+    md->blockref = blockref;
+    md->offset = reinterpret_cast<intptr_t>(heap);
+    map_arrmeta(tp.extended<ndt::base_dim_type>()->get_element_type(),
+                arrmeta + sizeof(ndt::var_dim_type::metadata_type), blockref, heap);
+    return;
+  }
+  case tuple_id:
+  case struct_id: {
+    field_layout ttp(tp);
+    for (intptr_t i = 0; i != ttp.get_field_count(); ++i) {
+      map_arrmeta(ttp.get_field_type(i), arrmeta + ttp.get_arrmeta_offset(i), blockref, heap);
+    }
+    return;
+  }
+  default:
+    return;
+  }
+}
+
+/**
+ * Checks that every var_dim of a value in the mapped file stays inside the
+ * heap section, as read_value does for values it copies. Mapped arrays
+ * point straight into the file, so this has to be done before handing one
+ * out.
+ */
+void check_mapped_value(const ndt::type &tp, const char *src, const char *heap, size_t heap_size) {
+  if ((tp.get_flags() & type_flag_blockref) == 0) {
+    // No var_dim inside, so the value is all in the data section
+    return;
+  }
+
+  switch (tp.get_id()) {
+  case fixed_dim_id: {
+    const ndt::type &el_tp = tp.extended<ndt::base_dim_type>()->get_element_type();
+    size_t el_size = default_data_size(el_tp);
+    intptr_t dim_size = tp.extended<ndt::fixed_dim_type>()->get_fixed_dim_size();
+    for (intptr_t i = 0; i != dim_size; ++i) {
+      check_mapped_value(el_tp, src + i * el_size, heap, heap_size);
+    }
+    return;
+  }
+  case var_dim_id: {
+    ndt::var_dim_type::data_type d;
+    memcpy(&d, src, sizeof(d));
+    const ndt::type &el_tp = tp.extended<ndt::base_dim_type>()->get_element_type();
+    size_t el_size = default_data_size(el_tp);
+    size_t offset = reinterpret_cast<size_t>(d.begin);
+    if (offset > heap_size || d.size > (heap_size - offset) / max<size_t>(el_size, 1) ||
+        offset % el_tp.get_data_alignment() != 0) {
+      throw runtime_error("binary container has a var_dim outside of its heap section");
+    }
+    for (size_t i = 0; i != d.size; ++i) {
+      check_mapped_value(el_tp, heap + offset + i * el_size, heap, heap_size);
+    }
+    return;
+  }
+  case tuple_id:
+  case struct_id: {
+    field_layout ttp(tp);
+    intptr_t field_count = ttp.get_field_count();
+    vector<uintptr_t> src_offsets(field_count);
+    ndt::tuple_type::fill_default_data_offsets(field_count, ttp.get_field_types_raw(), src_offsets.data());
+    for (intptr_t i = 0; i != field_count; ++i) {
+      check_mapped_value(ttp.get_field_type(i), src + src_offsets[i], heap, heap_size);
+    }
+    return;
+  }
+  default:
+    return;
+  }
+}
+
+/**
+ * Copies values out of the mapped file into default-constructed arrmeta and
+ * data, the inverse of container_writer::write.
+ */
+void read_value(const ndt::type &tp, const char *arrmeta, char *dst, const char *src, const char *heap,
+                size_t heap_size) {
+  switch (tp.get_id()) {
+  case fixed_dim_id: {
+    const fixed_dim_type_arrmeta *md = reinterpret_cast<const fixed_dim_type_arrmeta *>(arrmeta);
+    const ndt::type &el_tp = tp.extended<ndt::base_dim_type>()->get_element_type();
+    size_t el_size = default_data_size(el_tp);
+    for (intptr_t i = 0; i != md->dim_size; ++i) {
+      read_value(el_tp, arrmeta + sizeof(fixed_dim_type_arrmeta), dst + i * md->stride, src + i * el_size, heap,
+                 heap_size);
+    }
+    return;
+  }
+  case var_dim_id: {
+    const ndt::var_dim_type::metadata_type *md = reinterpret_cast<const ndt::var_dim_type::metadata_type *>(arrmeta);
+    ndt::var_dim_type::data_type d;
+    memcpy(&d, src, sizeof(d));
+    const ndt::type &el_tp = tp.extended<ndt::base_dim_type>()->get_element_type();
+    size_t el_size = default_data_size(el_tp);
+    size_t offset = reinterpret_cast<size_t>(d.begin);
+    if (offset > heap_size || d.size > (heap_size - offset) / max<size_t>(el_size, 1)) {
+      throw runtime_error("binary container has a var_dim outside of its heap section");
+    }
+    ndt::var_dim_type::data_type *dst_d = reinterpret_cast<ndt::var_dim_type::data_type *>(dst);
+    dst_d->begin = md->blockref->alloc(d.size);
+    dst_d->size = d.size;
+    for (size_t i = 0; i != d.size; ++i) {
+      read_value(el_tp, arrmeta + sizeof(ndt::var_dim_type::metadata_type), dst_d->begin + i * md->stride,
+                 heap + offset + i * el_size, heap, heap_size);
+    }
+    return;
+  }
+  case tuple_id:
+  case struct_id: {
+    field_layout ttp(tp);
+    intptr_t field_count = ttp.get_field_count();
+    const uintptr_t *dst_offsets = reinterpret_cast<const uintptr_t *>(arrmeta);
+    vector<uintptr_t> src_offsets(field_count);
+    ndt::tuple_type::fill_default_data_offsets(field_count, ttp.get_field_types_raw(), src_offsets.data());
+    for (intptr_t i = 0; i != field_count; ++i) {
+      read_value(ttp.get_field_type(i), arrmeta + ttp.get_arrmeta_offset(i), dst + dst_offsets[i],
+                 src + src_offsets[i], heap, heap_size);
+    }
+    return;
+  }
+  case string_id:
+  case bytes_id: {
+    container_bytes s;
+    memcpy(&s, src, sizeof(s));
+    if (s.offset > heap_size || s.size > heap_size - s.offset) {
+      throw runtime_error("binary container has a string outside of its heap section");
+    }
+    reinterpret_cast<bytes *>(dst)->assign(heap + s.offset, s.size);
+    return;
+  }
+  default:
+    memcpy(dst, src, tp.get_data_size());
+    return;
+  }
+}
+
+} // anonymous namespace
+
+void nd::save_binary(const std::string &filename, const array &a) {
+  const ndt::type &tp = a.get_type();
+  check_storable(tp);
+
+  std::string datashape = tp.str();
+
+  container_header header;
+  memcpy(header.magic, container_magic, sizeof(container_magic));
+  header.version = container_version;
+  header.byte_order = container_byte_order;
+  header.datashape_offset = sizeof(container_header);
+  header.datashape_size = datashape.size();
+  header.data_offset = align_to(header.datashape_offset + header.datashape_size, container_alignment);
+  header.data_size = default_data_size(tp);
+
+  vector<char> heap;
+  vector<char> data;
+  // Values that are already laid out by default are written straight from the array
+  bool direct = (tp.get_flags() & (type_flag_blockref | type_flag_destructor)) == 0 &&
+                tp.get_dtype().get_arrmeta_size() == 0 &&
+                (tp.get_ndim() == 0 || tp.is_c_contiguous(a.get()->metadata()));
+  if (!direct) {
+    data.resize(header.data_size);
+    container_writer(heap).write(tp, a.get()->metadata(), a.cdata(), data, 0);
+  }
+
+  header.heap_offset = align_to(header.data_offset + header.data_size, container_alignment);
+  header.heap_size = heap.size();
+
+  ofstream f(filename.c_str(), ios::binary | ios::trunc);
+  if (!f) {
+    stringstream ss;
+    ss << "failed to open file \"" << filename << "\" for writing";
+    throw runtime_error(ss.str());
+  }
+
+  const char padding[container_alignment] = {0};
+  f.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  f.write(datashape.data(), datashape.size());
+  f.write(padding, header.data_offset - (header.datashape_offset + header.datashape_size));
+  f.write(direct ? a.cdata() : data.data(), header.data_size);
+  f.write(padding, header.heap_offset - (header.data_offset + header.data_size));
+  f.write(heap.data(), heap.size());
+  if (!f) {
+    stringstream ss;
+    ss << "failed to write binary container \"" << filename << "\"";
+    throw runtime_error(ss.str());
+  }
+}
+
+nd::array nd::load_binary(const std::string &filename) {
+  char *begin = NULL;
+  intptr_t size = 0;
+  memory_block mm = make_memory_block<memmap_memory_block>(filename, read_access_flag, &begin, &size);
+
+  container_header header;
+  if (static_cast<size_t>(size) < sizeof(header)) {
+    stringstream ss;
+    ss << "file \"" << filename << "\" is too small to be a binary container";
+    throw runtime_error(ss.str());
+  }
+  memcpy(&header, begin, sizeof(header));
+  if (memcmp(header.magic, container_magic, sizeof(container_magic)) != 0) {
+    stringstream ss;
+    ss << "file \"" << filename << "\" is not a binary container";
+    throw runtime_error(ss.str());
+  }
+  if (header.version != container_version || header.byte_order != container_byte_order) {
+    stringstream ss;
+    ss << "binary container \"" << filename << "\" has an unsupported version or byte order";
+    throw runtime_error(ss.str());
+  }
+  uint64_t file_size = static_cast<uint64_t>(size);
+  if (header.datashape_offset > file_size || header.datashape_size > file_size - header.datashape_offset ||
+      header.data_offset > file_size || header.data_size > file_size - header.data_offset ||
+      header.heap_offset > file_size || header.heap_size > file_size - header.heap_offset ||
+      header.data_offset % container_alignment != 0 || header.heap_offset % container_alignment != 0) {
+    stringstream ss;
+    ss << "binary container \"" << filename << "\" is truncated or corrupt";
+    throw runtime_error(ss.str());
+  }
+
+  ndt::type tp(std::string(begin + header.datashape_offset, header.datashape_size));
+  check_storable(tp);
+  if (default_data_size(tp) != header.data_size) {
+    stringstream ss;
+    ss << "binary container \"" << filename << "\" has a data section that does not match its type " << tp;
+    throw runtime_error(ss.str());
+  }
+
+  char *data = begin + header.data_offset;
+  char *heap = begin + header.heap_offset;
+  if (is_mappable(tp)) {
+    check_mapped_value(tp, data, heap, header.heap_size);
+    // The mapping is read-only, and it keeps the file mapped while the array is alive
+    array result = make_array(tp, data, mm, read_access_flag | immutable_access_flag);
+    if (tp.get_arrmeta_size() > 0) {
+      tp.extended()->arrmeta_default_construct(result.get()->metadata(), false);
+      map_arrmeta(tp, result.get()->metadata(), mm, heap);
+    }
+    return result;
+  }
+
+  array result = empty(tp);
+  read_value(tp, result.get()->metadata(), result.data(), data, heap, header.heap_size);
+  return result;
+}
@@ -3,7 +3,18 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <algorithm>
+#include <clocale>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <ostream>
+
 #include <dynd/json_formatter.hpp>
+#include <dynd/bitmap.hpp>
 #include <dynd/callable.hpp>
 #include <dynd/option.hpp>
 #include <dynd/types/string_type.hpp>
@@ -12,15 +23,33 @@
 #include <dynd/types/var_dim_type.hpp>
 #include <dynd/types/option_type.hpp>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define DYND_JSON_SSE2
+#endif
+
 using namespace std;
 using namespace dynd;
 
+// When streaming, the buffered output is flushed to the sink once it is this large
+static const intptr_t json_sink_flush_size = 64 * 1024;
+
 struct output_data {
   dynd::string out_string;
   char *out_begin, *out_end, *out_capacity_end;
   bool struct_as_list;
+  // If not NULL, output is streamed here instead of accumulating in out_string
+  std::ostream *sink;
+
+  void flush() {
+    sink->write(out_begin, out_end - out_begin);
+    out_end = out_begin;
+  }
 
   void ensure_capacity(intptr_t added_capacity) {
+    if (sink != NULL && out_capacity_end - out_end < added_capacity) {
+      flush();
+    }
     // If there's not enough space, double the capacity
     if (out_capacity_end - out_end < added_capacity) {
       intptr_t current_size = out_end - out_begin;
@@ -81,10 +110,508 @@ static void format_json_bool(output_data &out, const ndt::type &dt, const char *
   }
 }
 
+static const char json_digit_pairs[] = "00010203040506070809"
+                                       "10111213141516171819"
+                                       "20212223242526272829"
+                                       "30313233343536373839"
+                                       "40414243444546474849"
+                                       "50515253545556575859"
+                                       "60616263646566676869"
+                                       "70717273747576777879"
+                                       "80818283848586878889"
+                                       "90919293949596979899";
+
+/**
+ * Writes the decimal digits of ``value`` backwards, ending just before
+ * ``end``, two digits at a time. Returns the position of the first digit.
+ */
+static char *format_decimal_backwards(char *end, uint64_t value) {
+  while (value >= 100) {
+    end -= 2;
+    memcpy(end, json_digit_pairs + 2 * (value % 100), 2);
+    value /= 100;
+  }
+  if (value >= 10) {
+    end -= 2;
+    memcpy(end, json_digit_pairs + 2 * value, 2);
+  } else {
+    *--end = static_cast<char>('0' + value);
+  }
+  return end;
+}
+
+template <typename T>
+static void format_json_integer(output_data &out, const char *data) {
+  T value = *reinterpret_cast<const T *>(data);
+  // Enough for the digits and sign of a 64-bit integer
+  char buf[24];
+  char *end = buf + sizeof(buf);
+  char *begin;
+  if (value < 0) {
+    begin = format_decimal_backwards(end, 0 - static_cast<uint64_t>(value));
+    *--begin = '-';
+  } else {
+    begin = format_decimal_backwards(end, static_cast<uint64_t>(value));
+  }
+  out.write(begin, end);
+}
+
+static inline bool json_float_roundtrips(const char *str, float value) { return strtof(str, NULL) == value; }
+
+static inline bool json_float_roundtrips(const char *str, double value) { return strtod(str, NULL) == value; }
+
+/**
+ * Replaces the decimal point of the current C locale, which snprintf writes,
+ * with the '.' JSON requires. Returns the new length of ``str``.
+ */
+static int json_float_fix_decimal_point(char *str, int len) {
+  const char *point = localeconv()->decimal_point;
+  size_t point_len = strlen(point);
+  if (point_len == 0 || (point_len == 1 && point[0] == '.')) {
+    return len;
+  }
+
+  char *pos = strstr(str, point);
+  if (pos != NULL) {
+    *pos = '.';
+    memmove(pos + 1, pos + point_len, str + len + 1 - (pos + point_len));
+    len -= static_cast<int>(point_len - 1);
+  }
+  return len;
+}
+
+/**
+ * Shortest round-trip digits for float32 and float64, with Grisu3 (Loitsch,
+ * "Printing Floating-Point Numbers Quickly and Accurately with Integers").
+ * Grisu3 finds the shortest digits with 64-bit integer arithmetic, and
+ * reports the rare values (about 0.5%) it cannot prove shortest, which then
+ * go through snprintf.
+ */
+
+// A floating point number f * 2^e with a 64-bit significand
+struct diy_fp {
+  uint64_t f;
+  int e;
+
+  diy_fp() = default;
+  diy_fp(uint64_t f, int e) : f(f), e(e) {}
+
+  diy_fp normalized() const {
+    diy_fp res = *this;
+    while ((res.f & (static_cast<uint64_t>(1) << 63)) == 0) {
+      res.f <<= 1;
+      --res.e;
+    }
+    return res;
+  }
+
+  // The product, rounded to the upper 64 bits
+  diy_fp operator*(const diy_fp &rhs) const {
+    const uint64_t mask = 0xffffffffu;
+    uint64_t a = f >> 32, b = f & mask, c = rhs.f >> 32, d = rhs.f & mask;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t tmp = (bd >> 32) + (ad & mask) + (bc & mask) + (static_cast<uint64_t>(1) << 31);
+    return diy_fp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + rhs.e + 64);
+  }
+};
+
+// The normalized powers 10^k = f * 2^e for k = -348, -340, ..., 340
+struct cached_power {
+  uint64_t f;
+  int e;
+  int k;
+};
+
+static const cached_power grisu_cached_powers[] = {
+    {0xfa8fd5a0081c0288ULL, -1220, -348},
+    {0xbaaee17fa23ebf76ULL, -1193, -340},
+    {0x8b16fb203055ac76ULL, -1166, -332},
+    {0xcf42894a5dce35eaULL, -1140, -324},
+    {0x9a6bb0aa55653b2dULL, -1113, -316},
+    {0xe61acf033d1a45dfULL, -1087, -308},
+    {0xab70fe17c79ac6caULL, -1060, -300},
+    {0xff77b1fcbebcdc4fULL, -1034, -292},
+    {0xbe5691ef416bd60cULL, -1007, -284},
+    {0x8dd01fad907ffc3cULL, -980, -276},
+    {0xd3515c2831559a83ULL, -954, -268},
+    {0x9d71ac8fada6c9b5ULL, -927, -260},
+    {0xea9c227723ee8bcbULL, -901, -252},
+    {0xaecc49914078536dULL, -874, -244},
+    {0x823c12795db6ce57ULL, -847, -236},
+    {0xc21094364dfb5637ULL, -821, -228},
+    {0x9096ea6f3848984fULL, -794, -220},
+    {0xd77485cb25823ac7ULL, -768, -212},
+    {0xa086cfcd97bf97f4ULL, -741, -204},
+    {0xef340a98172aace5ULL, -715, -196},
+    {0xb23867fb2a35b28eULL, -688, -188},
+    {0x84c8d4dfd2c63f3bULL, -661, -180},
+    {0xc5dd44271ad3cdbaULL, -635, -172},
+    {0x936b9fcebb25c996ULL, -608, -164},
+    {0xdbac6c247d62a584ULL, -582, -156},
+    {0xa3ab66580d5fdaf6ULL, -555, -148},
+    {0xf3e2f893dec3f126ULL, -529, -140},
+    {0xb5b5ada8aaff80b8ULL, -502, -132},
+    {0x87625f056c7c4a8bULL, -475, -124},
+    {0xc9bcff6034c13053ULL, -449, -116},
+    {0x964e858c91ba2655ULL, -422, -108},
+    {0xdff9772470297ebdULL, -396, -100},
+    {0xa6dfbd9fb8e5b88fULL, -369, -92},
+    {0xf8a95fcf88747d94ULL, -343, -84},
+    {0xb94470938fa89bcfULL, -316, -76},
+    {0x8a08f0f8bf0f156bULL, -289, -68},
+    {0xcdb02555653131b6ULL, -263, -60},
+    {0x993fe2c6d07b7facULL, -236, -52},
+    {0xe45c10c42a2b3b06ULL, -210, -44},
+    {0xaa242499697392d3ULL, -183, -36},
+    {0xfd87b5f28300ca0eULL, -157, -28},
+    {0xbce5086492111aebULL, -130, -20},
+    {0x8cbccc096f5088ccULL, -103, -12},
+    {0xd1b71758e219652cULL, -77, -4},
+    {0x9c40000000000000ULL, -50, 4},
+    {0xe8d4a51000000000ULL, -24, 12},
+    {0xad78ebc5ac620000ULL, 3, 20},
+    {0x813f3978f8940984ULL, 30, 28},
+    {0xc097ce7bc90715b3ULL, 56, 36},
+    {0x8f7e32ce7bea5c70ULL, 83, 44},
+    {0xd5d238a4abe98068ULL, 109, 52},
+    {0x9f4f2726179a2245ULL, 136, 60},
+    {0xed63a231d4c4fb27ULL, 162, 68},
+    {0xb0de65388cc8ada8ULL, 189, 76},
+    {0x83c7088e1aab65dbULL, 216, 84},
+    {0xc45d1df942711d9aULL, 242, 92},
+    {0x924d692ca61be758ULL, 269, 100},
+    {0xda01ee641a708deaULL, 295, 108},
+    {0xa26da3999aef774aULL, 322, 116},
+    {0xf209787bb47d6b85ULL, 348, 124},
+    {0xb454e4a179dd1877ULL, 375, 132},
+    {0x865b86925b9bc5c2ULL, 402, 140},
+    {0xc83553c5c8965d3dULL, 428, 148},
+    {0x952ab45cfa97a0b3ULL, 455, 156},
+    {0xde469fbd99a05fe3ULL, 481, 164},
+    {0xa59bc234db398c25ULL, 508, 172},
+    {0xf6c69a72a3989f5cULL, 534, 180},
+    {0xb7dcbf5354e9beceULL, 561, 188},
+    {0x88fcf317f22241e2ULL, 588, 196},
+    {0xcc20ce9bd35c78a5ULL, 614, 204},
+    {0x98165af37b2153dfULL, 641, 212},
+    {0xe2a0b5dc971f303aULL, 667, 220},
+    {0xa8d9d1535ce3b396ULL, 694, 228},
+    {0xfb9b7cd9a4a7443cULL, 720, 236},
+    {0xbb764c4ca7a44410ULL, 747, 244},
+    {0x8bab8eefb6409c1aULL, 774, 252},
+    {0xd01fef10a657842cULL, 800, 260},
+    {0x9b10a4e5e9913129ULL, 827, 268},
+    {0xe7109bfba19c0c9dULL, 853, 276},
+    {0xac2820d9623bf429ULL, 880, 284},
+    {0x80444b5e7aa7cf85ULL, 907, 292},
+    {0xbf21e44003acdd2dULL, 933, 300},
+    {0x8e679c2f5e44ff8fULL, 960, 308},
+    {0xd433179d9c8cb841ULL, 986, 316},
+    {0x9e19db92b4e31ba9ULL, 1013, 324},
+    {0xeb96bf6ebadf77d9ULL, 1039, 332},
+    {0xaf87023b9bf0ee6bULL, 1066, 340},
+};
+
+template <typename T>
+struct grisu_traits;
+
+template <>
+struct grisu_traits<float> {
+  typedef uint32_t bits_type;
+  static const int significand_bits = 23;
+  static const int exponent_bias = 127 + 23;
+};
+
+template <>
+struct grisu_traits<double> {
+  typedef uint64_t bits_type;
+  static const int significand_bits = 52;
+  static const int exponent_bias = 1023 + 52;
+};
+
+static bool grisu_round_weed(char *buffer, int length, uint64_t distance_too_high_w, uint64_t unsafe_interval,
+                             uint64_t rest, uint64_t ten_kappa, uint64_t unit) {
+  uint64_t small_distance = distance_too_high_w - unit;
+  uint64_t big_distance = distance_too_high_w + unit;
+  // Moves the last digit down while that brings it closer to the value
+  while (rest < small_distance && unsafe_interval - rest >= ten_kappa &&
+         (rest + ten_kappa < small_distance || small_distance - rest >= rest + ten_kappa - small_distance)) {
+    --buffer[length - 1];
+    rest += ten_kappa;
+  }
+  // If another candidate may be as close, the digits cannot be trusted
+  if (rest < big_distance && unsafe_interval - rest >= ten_kappa &&
+      (rest + ten_kappa < big_distance || big_distance - rest > rest + ten_kappa - big_distance)) {
+    return false;
+  }
+  return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+static bool grisu_digit_gen(const diy_fp &low, const diy_fp &w, const diy_fp &high, char *buffer, int &length,
+                            int &kappa) {
+  uint64_t unit = 1;
+  diy_fp too_low(low.f - unit, low.e), too_high(high.f + unit, high.e);
+  uint64_t unsafe_interval = too_high.f - too_low.f;
+  const int shift = -w.e;
+  const uint64_t one = static_cast<uint64_t>(1) << shift;
+  uint32_t integrals = static_cast<uint32_t>(too_high.f >> shift);
+  uint64_t fractionals = too_high.f & (one - 1);
+
+  uint32_t divisor = 1;
+  kappa = 0;
+  if (integrals != 0) {
+    kappa = 1;
+    while (integrals / divisor >= 10) {
+      divisor *= 10;
+      ++kappa;
+    }
+  }
+
+  length = 0;
+  while (kappa > 0) {
+    buffer[length++] = static_cast<char>('0' + integrals / divisor);
+    integrals %= divisor;
+    --kappa;
+    uint64_t rest = (static_cast<uint64_t>(integrals) << shift) + fractionals;
+    if (rest < unsafe_interval) {
+      return grisu_round_weed(buffer, length, too_high.f - w.f, unsafe_interval, rest,
+                              static_cast<uint64_t>(divisor) << shift, unit);
+    }
+    divisor /= 10;
+  }
+  for (;;) {
+    fractionals *= 10;
+    unit *= 10;
+    unsafe_interval *= 10;
+    buffer[length++] = static_cast<char>('0' + (fractionals >> shift));
+    fractionals &= one - 1;
+    --kappa;
+    if (fractionals < unsafe_interval) {
+      return grisu_round_weed(buffer, length, (too_high.f - w.f) * unit, unsafe_interval, fractionals, one, unit);
+    }
+  }
+}
+
+/**
+ * Writes the shortest digits of a positive finite ``value`` to ``buffer``,
+ * so that ``value`` is the nearest T to digits * 10^decimal_exponent.
+ * Returns false if Grisu3 cannot guarantee the result.
+ */
+template <typename T>
+static bool grisu3(T value, char *buffer, int &length, int &decimal_exponent) {
+  typedef grisu_traits<T> traits;
+  typename traits::bits_type bits;
+  memcpy(&bits, &value, sizeof(T));
+
+  const uint64_t hidden_bit = static_cast<uint64_t>(1) << traits::significand_bits;
+  uint64_t f = bits & (hidden_bit - 1);
+  int biased_e = static_cast<int>(bits >> traits::significand_bits);
+  int e;
+  if (biased_e == 0) {
+    e = 1 - traits::exponent_bias;
+  } else {
+    f += hidden_bit;
+    e = biased_e - traits::exponent_bias;
+  }
+
+  // The boundaries halfway to the neighbouring values, which are closer
+  // below a power of two
+  diy_fp w = diy_fp(f, e).normalized();
+  diy_fp plus = diy_fp((f << 1) + 1, e - 1).normalized();
+  diy_fp minus = (f == hidden_bit && biased_e > 1) ? diy_fp((f << 2) - 1, e - 2) : diy_fp((f << 1) - 1, e - 1);
+  minus.f <<= minus.e - plus.e;
+  minus.e = plus.e;
+
+  // Scales by a cached 10^-k so that the exponent is in [-60, -32]
+  const int min_e = -60 - (w.e + 64), max_e = -32 - (w.e + 64);
+  const int npowers = static_cast<int>(sizeof(grisu_cached_powers) / sizeof(grisu_cached_powers[0]));
+  int index = (static_cast<int>(std::ceil((min_e + 63) * 0.30102999566398114)) + 348 - 1) / 8 + 1;
+  index = std::min(std::max(index, 0), npowers - 1);
+  while (index > 0 && grisu_cached_powers[index].e > min_e) {
+    --index;
+  }
+  while (index + 1 < npowers && grisu_cached_powers[index].e < min_e) {
+    ++index;
+  }
+  const cached_power &c = grisu_cached_powers[index];
+  if (c.e > max_e) {
+    return false;
+  }
+  diy_fp ten_mk(c.f, c.e);
+
+  int kappa;
+  if (!grisu_digit_gen(minus * ten_mk, w * ten_mk, plus * ten_mk, buffer, length, kappa)) {
+    return false;
+  }
+  decimal_exponent = kappa - c.k;
+  return true;
+}
+
+/**
+ * Writes ``digits`` * 10^decimal_exponent the way printf's %g would with the
+ * given precision, and with a '.' decimal point. Returns the length written.
+ */
+static int format_float_digits(char *out, bool negative, const char *digits, int length, int decimal_exponent,
+                               int precision) {
+  char *p = out;
+  if (negative) {
+    *p++ = '-';
+  }
+
+  int exponent = decimal_exponent + length - 1;
+  if (exponent < -4 || exponent >= precision) {
+    *p++ = digits[0];
+    if (length > 1) {
+      *p++ = '.';
+      memcpy(p, digits + 1, length - 1);
+      p += length - 1;
+    }
+    *p++ = 'e';
+    *p++ = (exponent < 0) ? '-' : '+';
+    int abs_exponent = (exponent < 0) ? -exponent : exponent;
+    if (abs_exponent >= 100) {
+      *p++ = static_cast<char>('0' + abs_exponent / 100);
+    }
+    *p++ = static_cast<char>('0' + abs_exponent / 10 % 10);
+    *p++ = static_cast<char>('0' + abs_exponent % 10);
+  } else if (exponent < 0) {
+    *p++ = '0';
+    *p++ = '.';
+    memset(p, '0', -exponent - 1);
+    p += -exponent - 1;
+    memcpy(p, digits, length);
+    p += length;
+  } else if (exponent >= length - 1) {
+    memcpy(p, digits, length);
+    p += length;
+    memset(p, '0', exponent - (length - 1));
+    p += exponent - (length - 1);
+  } else {
+    memcpy(p, digits, exponent + 1);
+    p += exponent + 1;
+    *p++ = '.';
+    memcpy(p, digits + exponent + 1, length - (exponent + 1));
+    p += length - (exponent + 1);
+  }
+  return static_cast<int>(p - out);
+}
+
+/**
+ * Writes the shortest decimal which parses back to exactly ``value``, in the
+ * format of printf's %g and with the '.' decimal point JSON requires.
+ *
+ * Grisu3 produces the digits without touching the C library. The values it
+ * rejects take the slow path: every decimal with at most digits10 significant
+ * digits survives the trip through T, so the first of the digits10 up to
+ * max_digits10 precisions whose snprintf output parses back is the shortest.
+ * That round trip is checked in the locale snprintf used, and only then is
+ * the decimal point made '.'.
+ */
+template <typename T>
+static void format_json_float(output_data &out, const char *data) {
+  T value = *reinterpret_cast<const T *>(data);
+  const int buf_size = 32;
+  out.ensure_capacity(buf_size);
+
+  int len;
+  char digits[24];
+  int length, decimal_exponent;
+  if (value != value || value == numeric_limits<T>::infinity() || value == -numeric_limits<T>::infinity()) {
+    len = snprintf(out.out_end, buf_size, "%g", static_cast<double>(value));
+  } else if (value != 0 && grisu3(std::abs(value), digits, length, decimal_exponent)) {
+    while (length > 1 && digits[length - 1] == '0') {
+      --length;
+      ++decimal_exponent;
+    }
+    len = format_float_digits(out.out_end, value < 0, digits, length, decimal_exponent,
+                              std::max(length, numeric_limits<T>::digits10));
+  } else {
+    for (int precision = numeric_limits<T>::digits10;; ++precision) {
+      len = snprintf(out.out_end, buf_size, "%.*g", precision, static_cast<double>(value));
+      if (precision == numeric_limits<T>::max_digits10 || json_float_roundtrips(out.out_end, value)) {
+        break;
+      }
+    }
+    len = json_float_fix_decimal_point(out.out_end, len);
+  }
+  out.out_end += len;
+}
+
 static void format_json_number(output_data &out, const ndt::type &dt, const char *arrmeta, const char *data) {
-  stringstream ss;
-  dt.print_data(ss, arrmeta, data);
-  out.write(ss.str());
+  switch (dt.get_id()) {
+  case int8_id:
+    format_json_integer<int8_t>(out, data);
+    break;
+  case int16_id:
+    format_json_integer<int16_t>(out, data);
+    break;
+  case int32_id:
+    format_json_integer<int32_t>(out, data);
+    break;
+  case int64_id:
+    format_json_integer<int64_t>(out, data);
+    break;
+  case uint8_id:
+    format_json_integer<uint8_t>(out, data);
+    break;
+  case uint16_id:
+    format_json_integer<uint16_t>(out, data);
+    break;
+  case uint32_id:
+    format_json_integer<uint32_t>(out, data);
+    break;
+  case uint64_id:
+    format_json_integer<uint64_t>(out, data);
+    break;
+  case float32_id:
+    format_json_float<float>(out, data);
+    break;
+  case float64_id:
+    format_json_float<double>(out, data);
+    break;
+  default: {
+    stringstream ss;
+    dt.print_data(ss, arrmeta, data);
+    out.write(ss.str());
+    break;
+  }
+  }
+}
+
+/**
+ * Returns the first character in [begin, end) which is not printable ASCII
+ * that can be copied to the output verbatim, i.e. that is a control
+ * character, non-ASCII, or needs a backslash escape.
+ */
+static const char *find_json_escape(const char *begin, const char *end) {
+#ifdef DYND_JSON_SSE2
+  // A signed comparison against 0x20 catches both the control characters and
+  // the bytes >= 0x80
+  const __m128i space = _mm_set1_epi8(0x20);
+  const __m128i quote = _mm_set1_epi8('\"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i slash = _mm_set1_epi8('/');
+  const __m128i del = _mm_set1_epi8(0x7f);
+  while (end - begin >= 16) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+    __m128i escape = _mm_or_si128(_mm_cmplt_epi8(chars, space), _mm_cmpeq_epi8(chars, quote));
+    escape = _mm_or_si128(escape, _mm_cmpeq_epi8(chars, backslash));
+    escape = _mm_or_si128(escape, _mm_cmpeq_epi8(chars, slash));
+    escape = _mm_or_si128(escape, _mm_cmpeq_epi8(chars, del));
+    int mask = _mm_movemask_epi8(escape);
+    if (mask != 0) {
+      return begin + bitmap::count_trailing_zeros(static_cast<bitmap::word_type>(mask));
+    }
+    begin += 16;
+  }
+#endif
+  for (; begin < end; ++begin) {
+    unsigned char c = static_cast<unsigned char>(*begin);
+    if (c < 0x20 || c >= 0x7f || c == '\"' || c == '\\' || c == '/') {
+      break;
+    }
+  }
+  return begin;
 }
 
 static void print_escaped_unicode_codepoint(output_data &out, uint32_t cp, append_unicode_codepoint_t append_fn) {
@@ -152,8 +679,18 @@ static void format_json_encoded_string(output_data &out, const char *begin, cons
   append_unicode_codepoint_t append_fn;
   next_fn = get_next_unicode_codepoint_function(encoding, assign_error_nocheck);
   append_fn = get_append_unicode_codepoint_function(string_encoding_utf_8, assign_error_nocheck);
+  // Runs of plain ASCII are copied directly in ASCII-compatible encodings
+  bool ascii_runs = encoding == string_encoding_ascii || encoding == string_encoding_utf_8;
   out.write('\"');
   while (begin < end) {
+    if (ascii_runs) {
+      const char *run_end = find_json_escape(begin, end);
+      out.write(begin, run_end);
+      begin = run_end;
+      if (begin == end) {
+        break;
+      }
+    }
     cp = next_fn(begin, end);
     print_escaped_unicode_codepoint(out, cp, append_fn);
   }
@@ -314,13 +851,9 @@ static void format_json(output_data &out, const ndt::type &dt, const char *arrme
   }
 }
 
-nd::array dynd::format_json(const nd::array &n, bool struct_as_list) {
-  // Create a UTF-8 string
-  nd::array result = nd::empty(ndt::make_type<ndt::string_type>());
-
+static void format_json(output_data &out, const nd::array &n, bool struct_as_list, intptr_t initial_capacity) {
   // Initialize the output with some memory
-  output_data out;
-  out.out_string.resize(1024);
+  out.out_string.resize(initial_capacity);
   out.out_begin = out.out_string.begin();
   out.out_capacity_end = out.out_string.end();
   out.out_end = out.out_begin;
@@ -332,6 +865,22 @@ nd::array dynd::format_json(const nd::array &n, bool struct_as_list) {
     nd::array tmp = n.eval();
     ::format_json(out, tmp.get_type(), tmp.get()->metadata(), tmp.cdata());
   }
+}
+
+void dynd::format_json(std::ostream &o, const nd::array &n, bool struct_as_list) {
+  output_data out;
+  out.sink = &o;
+  ::format_json(out, n, struct_as_list, json_sink_flush_size);
+  out.flush();
+}
+
+nd::array dynd::format_json(const nd::array &n, bool struct_as_list) {
+  // Create a UTF-8 string
+  nd::array result = nd::empty(ndt::make_type<ndt::string_type>());
+
+  output_data out;
+  out.sink = NULL;
+  ::format_json(out, n, struct_as_list, 1024);
 
   // Shrink the memory to fit, and set the pointers in the output
   string *d = reinterpret_cast<string *>(result.data());
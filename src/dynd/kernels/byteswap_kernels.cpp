@@ -3,10 +3,172 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <cstring>
+
 #include <dynd/callables/byteswap_callable.hpp>
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define DYND_USE_PSHUFB 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 using namespace std;
 using namespace dynd;
 
+namespace {
+
+template <typename T>
+void byteswap_values(char *dst, const char *src, size_t count)
+{
+  for (size_t i = 0; i != count; ++i, dst += sizeof(T), src += sizeof(T)) {
+    T value;
+    memcpy(&value, src, sizeof(T));
+    value = byteswap_value(value);
+    memcpy(dst, &value, sizeof(T));
+  }
+}
+
+void byteswap_scalar(char *dst, const char *src, size_t data_size, size_t count)
+{
+  switch (data_size) {
+  case 1:
+    if (dst != src) {
+      memcpy(dst, src, count);
+    }
+    break;
+  case 2:
+    byteswap_values<uint16_t>(dst, src, count);
+    break;
+  case 4:
+    byteswap_values<uint32_t>(dst, src, count);
+    break;
+  case 8:
+    byteswap_values<uint64_t>(dst, src, count);
+    break;
+  case 16:
+    for (size_t i = 0; i != count; ++i, dst += 16, src += 16) {
+      uint64_t lo, hi;
+      memcpy(&lo, src, 8);
+      memcpy(&hi, src + 8, 8);
+      lo = byteswap_value(lo);
+      hi = byteswap_value(hi);
+      memcpy(dst, &hi, 8);
+      memcpy(dst + 8, &lo, 8);
+    }
+    break;
+  default:
+    for (size_t i = 0; i != count; ++i, dst += data_size, src += data_size) {
+      nd::byteswap_ck::swap(dst, src, data_size);
+    }
+    break;
+  }
+}
+
+#ifdef DYND_USE_PSHUFB
+
+struct cpu_features {
+  bool ssse3;
+  bool avx2;
+};
+
+cpu_features detect_cpu_features()
+{
+  cpu_features features = {false, false};
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return features;
+  }
+  // SSSE3 (bit 9)
+  features.ssse3 = (ecx & (1u << 9)) != 0;
+
+  // AVX2 needs OSXSAVE (bit 27), and the OS has to save the SSE and AVX
+  // register state
+  if ((ecx & (1u << 27)) == 0 || __get_cpuid_max(0, NULL) < 7) {
+    return features;
+  }
+  unsigned int xcr0_lo, xcr0_hi;
+  __asm__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+  if ((xcr0_lo & 0x6u) != 0x6u) {
+    return features;
+  }
+  __cpuid_count(7, 0, eax, ebx, ecx, edx);
+  // AVX2 (bit 5)
+  features.avx2 = (ebx & (1u << 5)) != 0;
+  return features;
+}
+
+const cpu_features &get_cpu_features()
+{
+  static const cpu_features features = detect_cpu_features();
+  return features;
+}
+
+// The pshufb control that reverses each group of data_size bytes in a 16-byte lane
+void make_reverse_control(char *control, size_t data_size)
+{
+  for (size_t i = 0; i != 16; ++i) {
+    control[i] = static_cast<char>((i / data_size) * data_size + (data_size - 1 - i % data_size));
+  }
+}
+
+__attribute__((target("ssse3"))) void byteswap_ssse3(char *dst, const char *src, size_t data_size, size_t count)
+{
+  char control_bytes[16];
+  make_reverse_control(control_bytes, data_size);
+  const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i *>(control_bytes));
+
+  size_t size = data_size * count, i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_shuffle_epi8(v, control));
+  }
+  byteswap_scalar(dst + i, src + i, data_size, (size - i) / data_size);
+}
+
+__attribute__((target("avx2"))) void byteswap_avx2(char *dst, const char *src, size_t data_size, size_t count)
+{
+  char control_bytes[16];
+  make_reverse_control(control_bytes, data_size);
+  // vpshufb shuffles within each 128-bit lane, so both lanes use the same control
+  const __m256i control =
+      _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(control_bytes)));
+
+  size_t size = data_size * count, i = 0;
+  for (; i + 64 <= size; i += 64) {
+    __m256i v0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    __m256i v1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i + 32));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(v0, control));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i + 32), _mm256_shuffle_epi8(v1, control));
+  }
+  for (; i + 32 <= size; i += 32) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(v, control));
+  }
+  byteswap_scalar(dst + i, src + i, data_size, (size - i) / data_size);
+}
+
+#endif // DYND_USE_PSHUFB
+
+} // anonymous namespace
+
+void dynd::byteswap_contiguous(char *dst, const char *src, size_t data_size, size_t count)
+{
+#ifdef DYND_USE_PSHUFB
+  if (data_size == 2 || data_size == 4 || data_size == 8 || data_size == 16) {
+    const cpu_features &features = get_cpu_features();
+    if (features.avx2) {
+      byteswap_avx2(dst, src, data_size, count);
+      return;
+    }
+    if (features.ssse3) {
+      byteswap_ssse3(dst, src, data_size, count);
+      return;
+    }
+  }
+#endif
+  byteswap_scalar(dst, src, data_size, count);
+}
+
 DYND_API nd::callable nd::byteswap = nd::make_callable<nd::byteswap_callable>();
 DYND_API nd::callable nd::pairwise_byteswap = nd::make_callable<nd::pairwise_byteswap_callable>();
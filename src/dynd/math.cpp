@@ -7,26 +7,157 @@
 #include <dynd/callables/imag_callable.hpp>
 #include <dynd/callables/multidispatch_callable.hpp>
 #include <dynd/callables/real_callable.hpp>
+#include <dynd/callables/unary_math_callable.hpp>
 #include <dynd/functional.hpp>
 #include <dynd/math.hpp>
+#include <dynd/unary_arithmetic.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define DYND_MATH_SSE2
+#endif
 
 using namespace std;
 using namespace dynd;
 
+#ifdef DYND_MATH_SSE2
+namespace {
+
+// Selects a where mask is set, otherwise b
+inline __m128 select_ps(__m128 mask, __m128 a, __m128 b) {
+  return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// These follow exp_float32 and log_float32 operation for operation
+
+inline __m128 exp_float32_sse2(__m128 x) {
+  __m128 xc = _mm_max_ps(x, _mm_set1_ps(-104.0f));
+  xc = _mm_min_ps(xc, _mm_set1_ps(89.0f));
+
+  const __m128 round = _mm_set1_ps(12582912.0f);
+  __m128 n = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(xc, _mm_set1_ps(1.44269504088896341f)), round), round);
+  __m128 r = _mm_sub_ps(xc, _mm_mul_ps(n, _mm_set1_ps(0.693359375f)));
+  r = _mm_add_ps(r, _mm_mul_ps(n, _mm_set1_ps(2.12194440e-4f)));
+
+  __m128 p = _mm_set1_ps(1.9875691500e-4f);
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.3981999507e-3f));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(8.3334519073e-3f));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(4.1665795894e-2f));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.6666665459e-1f));
+  p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.0000001201e-1f));
+  __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, r), r), r), _mm_set1_ps(1.0f));
+
+  __m128i ni = _mm_cvttps_epi32(n);
+  __m128i n1 = _mm_srai_epi32(ni, 1);
+  __m128i n2 = _mm_sub_epi32(ni, n1);
+  const __m128i bias = _mm_set1_epi32(127);
+  y = _mm_mul_ps(y, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, bias), 23)));
+  y = _mm_mul_ps(y, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, bias), 23)));
+
+  return select_ps(_mm_cmpord_ps(x, x), y, x);
+}
+
+inline __m128 log_float32_sse2(__m128 x) {
+  __m128 subnormal = _mm_cmplt_ps(x, _mm_set1_ps(1.17549435e-38f));
+  __m128 xs = select_ps(subnormal, _mm_mul_ps(x, _mm_set1_ps(8388608.0f)), x);
+  __m128i bits = _mm_castps_si128(xs);
+
+  __m128i e = _mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xff)), _mm_set1_epi32(126));
+  e = _mm_sub_epi32(e, _mm_and_si128(_mm_castps_si128(subnormal), _mm_set1_epi32(23)));
+  __m128 m = _mm_castsi128_ps(
+      _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+  __m128 small = _mm_cmplt_ps(m, _mm_set1_ps(0.707106781186547524f));
+  // The mask is -1 where set
+  e = _mm_add_epi32(e, _mm_castps_si128(small));
+  m = _mm_sub_ps(select_ps(small, _mm_add_ps(m, m), m), _mm_set1_ps(1.0f));
+
+  __m128 z = _mm_mul_ps(m, m);
+  __m128 p = _mm_set1_ps(7.0376836292e-2f);
+  p = _mm_sub_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.1514610310e-1f));
+  p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.1676998740e-1f));
+  p = _mm_sub_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.2420140846e-1f));
+  p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.4249322787e-1f));
+  p = _mm_sub_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.6668057665e-1f));
+  p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.0000714765e-1f));
+  p = _mm_sub_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.4999993993e-1f));
+  p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(3.3333331174e-1f));
+  __m128 fe = _mm_cvtepi32_ps(e);
+  __m128 y = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(p, m), z), _mm_mul_ps(_mm_set1_ps(2.12194440e-4f), fe));
+  y = _mm_sub_ps(y, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+  y = _mm_add_ps(_mm_add_ps(m, y), _mm_mul_ps(_mm_set1_ps(0.693359375f), fe));
+
+  const __m128 inf = _mm_set1_ps(numeric_limits<float>::infinity());
+  y = select_ps(_mm_cmpeq_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_setzero_ps(), inf), y);
+  y = select_ps(_mm_cmpeq_ps(x, inf), x, y);
+  return select_ps(_mm_cmpge_ps(x, _mm_setzero_ps()), y, _mm_set1_ps(numeric_limits<float>::quiet_NaN()));
+}
+
+} // anonymous namespace
+#endif
+
+void dynd::detail::exp_float32(float *dst, const float *src, size_t count) {
+  size_t i = 0;
+#ifdef DYND_MATH_SSE2
+  for (; i + 4 <= count; i += 4) {
+    _mm_storeu_ps(dst + i, exp_float32_sse2(_mm_loadu_ps(src + i)));
+  }
+#endif
+  for (; i < count; ++i) {
+    dst[i] = exp_float32(src[i]);
+  }
+}
+
+void dynd::detail::log_float32(float *dst, const float *src, size_t count) {
+  size_t i = 0;
+#ifdef DYND_MATH_SSE2
+  for (; i + 4 <= count; i += 4) {
+    _mm_storeu_ps(dst + i, log_float32_sse2(_mm_loadu_ps(src + i)));
+  }
+#endif
+  for (; i < count; ++i) {
+    dst[i] = log_float32(src[i]);
+  }
+}
+
 namespace {
-// CUDA and MSVC 2015 WORKAROUND: Using these functions directly in the apply
-//                                template does not compile.
-double mycos(double x) { return cos(x); }
-double mysin(double x) { return sin(x); }
-double mytan(double x) { return tan(x); }
-double myexp(double x) { return exp(x); }
+
+template <template <typename> class FuncType>
+struct unary_math {
+  template <typename Arg0Type>
+  using callable_type = nd::unary_math_callable<FuncType, Arg0Type>;
+};
+
+template <typename>
+using isdef_math = std::true_type;
+
+// Integers are computed in float64, float32 stays in float32
+typedef type_sequence<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t, float, double>
+    real_math_types;
+
+typedef type_sequence<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t, float, double,
+                      dynd::complex<float>, dynd::complex<double>>
+    complex_math_types;
 
 } // anonymous namespace
 
-DYND_API nd::callable nd::cos = nd::functional::elwise(nd::functional::apply<double (*)(double), &mycos>());
-DYND_API nd::callable nd::sin = nd::functional::elwise(nd::functional::apply<double (*)(double), &mysin>());
-DYND_API nd::callable nd::tan = nd::functional::elwise(nd::functional::apply<double (*)(double), &mytan>());
-DYND_API nd::callable nd::exp = nd::functional::elwise(nd::functional::apply<double (*)(double), &myexp>());
+DYND_API nd::callable nd::cos =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_cos>::callable_type, isdef_math, complex_math_types>();
+DYND_API nd::callable nd::sin =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_sin>::callable_type, isdef_math, complex_math_types>();
+DYND_API nd::callable nd::tan =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_tan>::callable_type, isdef_math, real_math_types>();
+DYND_API nd::callable nd::exp =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_exp>::callable_type, isdef_math, complex_math_types>();
+DYND_API nd::callable nd::expm1 =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_expm1>::callable_type, isdef_math, real_math_types>();
+DYND_API nd::callable nd::log =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_log>::callable_type, isdef_math, complex_math_types>();
+DYND_API nd::callable nd::log1p =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_log1p>::callable_type, isdef_math, real_math_types>();
+DYND_API nd::callable nd::tanh =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_tanh>::callable_type, isdef_math, real_math_types>();
+DYND_API nd::callable nd::erf =
+    make_unary_arithmetic<unary_math<dynd::detail::inline_erf>::callable_type, isdef_math, real_math_types>();
 
 DYND_API nd::callable nd::real = nd::functional::elwise(nd::make_callable<nd::multidispatch_callable<1>>(
     ndt::make_type<ndt::callable_type>(ndt::make_type<ndt::scalar_kind_type>(),
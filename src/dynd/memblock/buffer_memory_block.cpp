@@ -0,0 +1,176 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <dynd/memblock/buffer_memory_block.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+using namespace std;
+using namespace dynd;
+
+namespace {
+
+// Size classes are the powers of two from 64 bytes to 8 KiB, including the header
+const size_t min_class_shift = 6;
+const size_t num_classes = 8;
+const size_t max_small_size = size_t(1) << (min_class_shift + num_classes - 1);
+
+// How many freed blocks each thread keeps per size class
+const size_t max_cached_blocks = 32;
+
+const uint32_t large_class = num_classes;
+
+#if DYND_BUFFER_HUGE_PAGE_THRESHOLD != 0
+const size_t huge_page_size = size_t(1) << 21;
+#endif
+
+/**
+ * Every allocation carries this header immediately before the memory block,
+ * recording how to free it.
+ */
+struct block_header {
+  void *raw;
+  uint32_t size_class;
+  uint32_t reserved;
+};
+
+// Keeps pooled memory blocks 16-byte aligned
+static_assert(sizeof(block_header) == 16, "block_header must be 16 bytes");
+
+struct free_node {
+  free_node *next;
+};
+
+enum thread_cache_state { cache_unused = 0, cache_alive, cache_destroyed };
+
+// Trivially destructible, so it can still be read after thread_cache has been
+// destroyed at thread exit
+thread_local int tls_cache_state = cache_unused;
+
+struct thread_cache {
+  free_node *free_list[num_classes];
+  size_t count[num_classes];
+  nd::buffer_pool_stats stats;
+
+  thread_cache() : free_list(), count(), stats() { tls_cache_state = cache_alive; }
+
+  ~thread_cache() {
+    for (size_t c = 0; c != num_classes; ++c) {
+      while (free_list[c] != NULL) {
+        free_node *node = free_list[c];
+        free_list[c] = node->next;
+        ::operator delete(node);
+      }
+    }
+    tls_cache_state = cache_destroyed;
+  }
+};
+
+thread_local thread_cache tls_cache;
+
+/**
+ * Returns the calling thread's cache, or NULL while the thread is exiting and
+ * it has already been destroyed (e.g. arrays held by other thread_locals).
+ */
+inline thread_cache *get_thread_cache() { return (tls_cache_state == cache_destroyed) ? NULL : &tls_cache; }
+
+inline uint32_t size_class_of(size_t total) {
+  uint32_t c = 0;
+  while ((size_t(1) << (c + min_class_shift)) < total) {
+    ++c;
+  }
+  return c;
+}
+
+inline char *align_up(char *ptr, size_t alignment) {
+  return reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(ptr) + alignment - 1) & ~(uintptr_t(alignment) - 1));
+}
+
+} // anonymous namespace
+
+void *nd::buffer_pool_allocate(size_t size, size_t data_offset) {
+  size_t total = sizeof(block_header) + size;
+  char *raw, *block;
+  uint32_t size_class;
+
+  if (total <= max_small_size) {
+    size_class = size_class_of(total);
+    thread_cache *cache = get_thread_cache();
+    if (cache != NULL && cache->free_list[size_class] != NULL) {
+      free_node *node = cache->free_list[size_class];
+      cache->free_list[size_class] = node->next;
+      --cache->count[size_class];
+      ++cache->stats.hits;
+      raw = reinterpret_cast<char *>(node);
+    } else {
+      if (cache != NULL) {
+        ++cache->stats.misses;
+      }
+      raw = static_cast<char *>(::operator new(size_t(1) << (size_class + min_class_shift)));
+    }
+    block = raw + sizeof(block_header);
+  } else {
+    size_class = large_class;
+    size_t alignment = DYND_BUFFER_LARGE_ALIGNMENT;
+#if DYND_BUFFER_HUGE_PAGE_THRESHOLD != 0
+    if (total >= DYND_BUFFER_HUGE_PAGE_THRESHOLD) {
+      alignment = huge_page_size;
+    }
+#endif
+    raw = static_cast<char *>(::operator new(total + alignment));
+    // Place the block so that its data, data_offset bytes in, is aligned
+    char *data = align_up(raw + sizeof(block_header) + data_offset, alignment);
+    block = data - data_offset;
+#if DYND_BUFFER_HUGE_PAGE_THRESHOLD != 0 && defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (alignment == huge_page_size && size > data_offset) {
+      // Advise whole huge pages of the data only, it starts at a huge page boundary
+      madvise(data, (size - data_offset) & ~(huge_page_size - 1), MADV_HUGEPAGE);
+    }
+#endif
+    thread_cache *cache = get_thread_cache();
+    if (cache != NULL) {
+      ++cache->stats.large;
+    }
+  }
+
+  block_header *header = reinterpret_cast<block_header *>(block) - 1;
+  header->raw = raw;
+  header->size_class = size_class;
+  return block;
+}
+
+void nd::buffer_pool_free(void *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+
+  block_header *header = static_cast<block_header *>(ptr) - 1;
+  void *raw = header->raw;
+  uint32_t size_class = header->size_class;
+
+  if (size_class != large_class) {
+    thread_cache *cache = get_thread_cache();
+    if (cache != NULL && cache->count[size_class] < max_cached_blocks) {
+      free_node *node = static_cast<free_node *>(raw);
+      node->next = cache->free_list[size_class];
+      cache->free_list[size_class] = node;
+      ++cache->count[size_class];
+      return;
+    }
+  }
+
+  ::operator delete(raw);
+}
+
+nd::buffer_pool_stats nd::get_buffer_pool_stats() {
+  thread_cache *cache = get_thread_cache();
+  if (cache == NULL) {
+    nd::buffer_pool_stats stats = {0, 0, 0};
+    return stats;
+  }
+  return cache->stats;
+}
@@ -68,7 +68,7 @@ void nd::old_assign_na(const ndt::type &option_tp, const char *arrmeta, char *da
     assign_na_builtin(value_tp.get_id(), data);
   } else {
     assign_na->call(option_tp, arrmeta, data, 0, nullptr, nullptr, nullptr, 0, nullptr,
-                    std::map<std::string, ndt::type>());
+                    ndt::typevar_map());
   }
 }
 
@@ -81,7 +81,7 @@ bool nd::old_is_avail(const ndt::type &option_tp, const char *arrmeta, const cha
     ndt::type src_tp[1] = {option_tp};
     char result;
     is_na->call(ndt::make_type<bool1>(), nullptr, &result, 1, src_tp, &arrmeta, const_cast<char **>(&data), 0, nullptr,
-                std::map<std::string, ndt::type>());
+                ndt::typevar_map());
     return result == 0;
   }
 }
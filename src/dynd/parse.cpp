@@ -36,6 +36,8 @@ nd::callable make_dynamic_parse() {
   dispatcher.insert(nd::make_callable<nd::json::parse_callable<uint16_t>>());
   dispatcher.insert(nd::make_callable<nd::json::parse_callable<uint32_t>>());
   dispatcher.insert(nd::make_callable<nd::json::parse_callable<uint64_t>>());
+  dispatcher.insert(nd::make_callable<nd::json::parse_callable<float>>());
+  dispatcher.insert(nd::make_callable<nd::json::parse_callable<double>>());
   dispatcher.insert(nd::make_callable<nd::json::parse_callable<dynd::string>>());
   dispatcher.insert(nd::make_callable<nd::json::parse_callable<ndt::struct_type>>());
   dispatcher.insert(nd::make_callable<nd::json::parse_callable<ndt::option_type>>());
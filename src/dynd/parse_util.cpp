@@ -3,6 +3,7 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <cstring>
 #include <stdexcept>
 #include <string>
 #include <string>
@@ -377,6 +378,21 @@ bool dynd::parse_na(const char *begin, const char *end) {
   return false;
 }
 
+bool dynd::parse_na(const char *begin, const char *end, const std::vector<std::string> &na_values) {
+  if (na_values.empty()) {
+    return parse_na(begin, end);
+  }
+
+  size_t size = end - begin;
+  for (const std::string &na_value : na_values) {
+    if (na_value.size() == size && memcmp(na_value.data(), begin, size) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
 bool json::parse_bool(const char *&begin, const char *&end) {
   bool escaped;
   const char *nbegin;
@@ -33,9 +33,12 @@ registry_entry &dynd::registered() {
                                                 {"conj", nd::conj},
                                                 {"cos", nd::cos},
                                                 {"dereference", nd::dereference},
+                                                {"describe", nd::describe},
                                                 {"divide", nd::divide},
                                                 {"equal", nd::equal},
+                                                {"erf", nd::erf},
                                                 {"exp", nd::exp},
+                                                {"expm1", nd::expm1},
                                                 {"greater", nd::greater},
                                                 {"greater_equal", nd::greater_equal},
                                                 {"imag", nd::imag},
@@ -43,6 +46,8 @@ registry_entry &dynd::registered() {
                                                 {"left_shift", nd::left_shift},
                                                 {"less", nd::less},
                                                 {"less_equal", nd::less_equal},
+                                                {"log", nd::log},
+                                                {"log1p", nd::log1p},
                                                 {"logical_and", nd::logical_and},
                                                 {"logical_not", nd::logical_not},
                                                 {"logical_or", nd::logical_or},
@@ -65,7 +70,10 @@ registry_entry &dynd::registered() {
                                                 {"sum", nd::sum},
                                                 {"take", nd::take},
                                                 {"tan", nd::tan},
+                                                {"tanh", nd::tanh},
                                                 {"total_order", nd::total_order},
+                                                {"wide_mean", nd::wide_mean},
+                                                {"wide_sum", nd::wide_sum},
                                                 {"random", {{"uniform", nd::random::uniform}}}}}}}};
 
   return entry;
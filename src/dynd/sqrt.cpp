@@ -4,9 +4,12 @@
 //
 
 #include <dynd/callables/sqrt_callable.hpp>
+#include <dynd/math.hpp>
 #include <dynd/unary_arithmetic.hpp>
 
 template <typename>
 using isdef_sqrt = std::true_type;
 
-DYND_API nd::callable nd::sqrt = make_unary_arithmetic<nd::sqrt_callable, isdef_sqrt, type_sequence<float, double>>();
+DYND_API nd::callable nd::sqrt =
+    make_unary_arithmetic<nd::sqrt_callable, isdef_sqrt,
+                          type_sequence<float, double, dynd::complex<float>, dynd::complex<double>>>();
@@ -3,10 +3,12 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <dynd/callables/describe_callable.hpp>
 #include <dynd/callables/max_callable.hpp>
 #include <dynd/callables/mean_callable.hpp>
 #include <dynd/callables/min_callable.hpp>
 #include <dynd/callables/multidispatch_callable.hpp>
+#include <dynd/callables/rolling_callable.hpp>
 #include <dynd/functional.hpp>
 #include <dynd/limits.hpp>
 #include <dynd/statistics.hpp>
@@ -24,6 +26,17 @@ static std::vector<ndt::type> func_ptr(const ndt::type &DYND_UNUSED(dst_tp), siz
 
 } // unnnamed namespace
 
+DYND_API nd::callable nd::describe = nd::make_callable<nd::describe_entry_callable>(
+    nd::functional::reduction(
+        nd::make_callable<nd::describe_init_callable>(),
+        nd::make_callable<nd::multidispatch_callable<1>>(
+            ndt::make_type<ndt::callable_type>(ndt::make_type<ndt::scalar_kind_type>(),
+                                               {ndt::make_type<ndt::scalar_kind_type>()}),
+            nd::callable::make_all<nd::describe_callable, type_sequence<int8_t, int16_t, int32_t, int64_t, uint8_t,
+                                                                        uint16_t, uint32_t, uint64_t, float, double>>(
+                func_ptr))),
+    nd::functional::elwise(nd::make_callable<nd::describe_finalize_callable>()));
+
 DYND_API nd::callable nd::max = nd::functional::reduction(
     nd::limits::min, nd::make_callable<nd::multidispatch_callable<1>>(
                          ndt::make_type<ndt::callable_type>(ndt::make_type<ndt::scalar_kind_type>(),
@@ -37,3 +50,15 @@ DYND_API nd::callable nd::min = nd::functional::reduction(
                          ndt::make_type<ndt::callable_type>(ndt::make_type<ndt::scalar_kind_type>(),
                                                             {ndt::make_type<ndt::scalar_kind_type>()}),
                          nd::callable::make_all<nd::min_callable, arithmetic_types>(func_ptr)));
+
+nd::callable nd::rolling_sum(intptr_t window_size) {
+  return nd::make_callable<nd::rolling_callable<nd::rolling_sum_window>>(window_size);
+}
+
+nd::callable nd::rolling_min(intptr_t window_size) {
+  return nd::make_callable<nd::rolling_callable<nd::rolling_min_window>>(window_size);
+}
+
+nd::callable nd::rolling_max(intptr_t window_size) {
+  return nd::make_callable<nd::rolling_callable<nd::rolling_max_window>>(window_size);
+}
@@ -3,6 +3,7 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <cstring>
 #include <sstream>
 
 #include <dynd/string_encodings.hpp>
@@ -12,6 +13,12 @@
 
 #include <utf8.h>
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define DYND_USE_SIMD_TRANSCODE 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
 using namespace std;
 using namespace dynd;
 
@@ -323,6 +330,428 @@ void noerror_append_utf32(uint32_t cp, char *&it_raw, char *DYND_UNUSED(end_raw)
   *it = cp;
   ++it;
 }
+
+// A code unit u is a nonzero ASCII character exactly when u - 1 < 0x7f in
+// unsigned arithmetic, so a block of them can be checked without branching
+template <typename UnitType>
+inline bool is_nonzero_ascii(UnitType u) {
+  return static_cast<UnitType>(u - 1) < 0x7f;
+}
+
+template <typename DstUnitType, typename SrcUnitType>
+void transcode_ascii_run(const char *&src_raw, const char *src_end_raw, char *&dst_raw, char *dst_end_raw) {
+  const SrcUnitType *src = reinterpret_cast<const SrcUnitType *>(src_raw);
+  DstUnitType *dst = reinterpret_cast<DstUnitType *>(dst_raw);
+  intptr_t size = min((src_end_raw - src_raw) / static_cast<intptr_t>(sizeof(SrcUnitType)),
+                      (dst_end_raw - dst_raw) / static_cast<intptr_t>(sizeof(DstUnitType)));
+
+  // Whole blocks first, which the compiler turns into vector compares and
+  // widening or narrowing copies
+  const intptr_t block_size = 16;
+  intptr_t i = 0;
+  for (; i + block_size <= size; i += block_size) {
+    int ascii = 1;
+    for (intptr_t j = 0; j < block_size; ++j) {
+      ascii &= is_nonzero_ascii(src[i + j]);
+    }
+    if (!ascii) {
+      break;
+    }
+    for (intptr_t j = 0; j < block_size; ++j) {
+      dst[i + j] = static_cast<DstUnitType>(src[i + j]);
+    }
+  }
+  for (; i < size && is_nonzero_ascii(src[i]); ++i) {
+    dst[i] = static_cast<DstUnitType>(src[i]);
+  }
+
+  src_raw += i * sizeof(SrcUnitType);
+  dst_raw += i * sizeof(DstUnitType);
+}
+
+// Decodes one UTF-8 sequence into 'cp', returning its length, or 0 when it is
+// a NUL, invalid, or runs past 'end'. Overlong sequences, surrogates and code
+// points past 0x10ffff are invalid, as in utf8::internal::validate_next.
+inline intptr_t decode_utf8_sequence(const uint8_t *src, const uint8_t *end, uint32_t &cp) {
+  uint32_t b0 = src[0];
+  if (b0 < 0x80) {
+    cp = b0;
+    return b0 != 0;
+  }
+  if (b0 < 0xc2 || b0 > 0xf4) {
+    return 0;
+  }
+  intptr_t length = (b0 < 0xe0) ? 2 : ((b0 < 0xf0) ? 3 : 4);
+  if (end - src < length) {
+    return 0;
+  }
+  cp = b0 & (0x7f >> length);
+  for (intptr_t i = 1; i < length; ++i) {
+    if ((src[i] & 0xc0) != 0x80) {
+      return 0;
+    }
+    cp = (cp << 6) | (src[i] & 0x3f);
+  }
+  if ((length == 3 && (cp < 0x800 || (cp >= 0xd800 && cp <= 0xdfff))) ||
+      (length == 4 && (cp < 0x10000 || cp > 0x10ffff))) {
+    return 0;
+  }
+  return length;
+}
+
+// Encodes 'cp' as UTF-8, returning false if it doesn't fit before 'end'
+inline bool encode_utf8(uint32_t cp, uint8_t *&dst, uint8_t *end) {
+  if (cp < 0x80) {
+    if (dst == end) {
+      return false;
+    }
+    *dst++ = static_cast<uint8_t>(cp);
+  } else if (cp < 0x800) {
+    if (end - dst < 2) {
+      return false;
+    }
+    *dst++ = static_cast<uint8_t>(0xc0 | (cp >> 6));
+    *dst++ = static_cast<uint8_t>(0x80 | (cp & 0x3f));
+  } else if (cp < 0x10000) {
+    if (end - dst < 3) {
+      return false;
+    }
+    *dst++ = static_cast<uint8_t>(0xe0 | (cp >> 12));
+    *dst++ = static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3f));
+    *dst++ = static_cast<uint8_t>(0x80 | (cp & 0x3f));
+  } else {
+    if (end - dst < 4) {
+      return false;
+    }
+    *dst++ = static_cast<uint8_t>(0xf0 | (cp >> 18));
+    *dst++ = static_cast<uint8_t>(0x80 | ((cp >> 12) & 0x3f));
+    *dst++ = static_cast<uint8_t>(0x80 | ((cp >> 6) & 0x3f));
+    *dst++ = static_cast<uint8_t>(0x80 | (cp & 0x3f));
+  }
+  return true;
+}
+
+// Decodes one UTF-16 code point, returning its number of code units, or 0
+// when it is a NUL, an unpaired surrogate, or runs past 'end'
+inline intptr_t decode_utf16_sequence(const uint16_t *src, const uint16_t *end, uint32_t &cp) {
+  uint32_t u = src[0];
+  if (u < 0xd800 || u > 0xdfff) {
+    cp = u;
+    return u != 0;
+  }
+  if (u >= 0xdc00 || end - src < 2 || src[1] < 0xdc00 || src[1] > 0xdfff) {
+    return 0;
+  }
+  cp = 0x10000 + ((u - 0xd800) << 10) + (src[1] - 0xdc00);
+  return 2;
+}
+
+// Encodes 'cp' as UTF-16, returning false if it doesn't fit before 'end'
+inline bool encode_utf16(uint32_t cp, uint16_t *&dst, uint16_t *end) {
+  if (cp < 0x10000) {
+    if (dst == end) {
+      return false;
+    }
+    *dst++ = static_cast<uint16_t>(cp);
+  } else {
+    if (end - dst < 2) {
+      return false;
+    }
+    *dst++ = static_cast<uint16_t>(0xd800 + ((cp - 0x10000) >> 10));
+    *dst++ = static_cast<uint16_t>(0xdc00 + ((cp - 0x10000) & 0x3ff));
+  }
+  return true;
+}
+
+// The length of the longest start of 'src' made of whole, valid UTF-8
+// sequences without a NUL
+size_t utf8_valid_prefix_scalar(const uint8_t *src, size_t size) {
+  const uint8_t *it = src, *end = src + size;
+  uint32_t cp;
+  while (it < end) {
+    intptr_t length = decode_utf8_sequence(it, end, cp);
+    if (length == 0) {
+      break;
+    }
+    it += length;
+  }
+  return it - src;
+}
+
+// Converts code points one at a time, without going through the next_*() and
+// append_*() function pointers, up to 'src_stop'. Returns false when it stops
+// early at a code point it leaves to them.
+inline bool transcode_utf8_to_utf16_scalar(const uint8_t *&src, const uint8_t *src_stop, const uint8_t *src_end,
+                                           uint16_t *&dst, uint16_t *dst_end) {
+  uint32_t cp;
+  while (src < src_stop) {
+    intptr_t length = decode_utf8_sequence(src, src_end, cp);
+    if (length == 0 || !encode_utf16(cp, dst, dst_end)) {
+      return false;
+    }
+    src += length;
+  }
+  return true;
+}
+
+inline bool transcode_utf16_to_utf8_scalar(const uint16_t *&src, const uint16_t *src_stop, const uint16_t *src_end,
+                                           uint8_t *&dst, uint8_t *dst_end) {
+  uint32_t cp;
+  while (src < src_stop) {
+    intptr_t length = decode_utf16_sequence(src, src_end, cp);
+    if (length == 0 || !encode_utf8(cp, dst, dst_end)) {
+      return false;
+    }
+    src += length;
+  }
+  return true;
+}
+
+void transcode_utf8_run_scalar(const char *&src_raw, const char *src_end_raw, char *&dst_raw, char *dst_end_raw) {
+  size_t size = min(src_end_raw - src_raw, dst_end_raw - dst_raw);
+  size_t valid_size = utf8_valid_prefix_scalar(reinterpret_cast<const uint8_t *>(src_raw), size);
+  memcpy(dst_raw, src_raw, valid_size);
+  src_raw += valid_size;
+  dst_raw += valid_size;
+}
+
+void transcode_utf8_to_utf16_run_scalar(const char *&src_raw, const char *src_end_raw, char *&dst_raw,
+                                        char *dst_end_raw) {
+  const uint8_t *src = reinterpret_cast<const uint8_t *>(src_raw);
+  const uint8_t *src_end = reinterpret_cast<const uint8_t *>(src_end_raw);
+  uint16_t *dst = reinterpret_cast<uint16_t *>(dst_raw);
+  transcode_utf8_to_utf16_scalar(src, src_end, src_end, dst, reinterpret_cast<uint16_t *>(dst_end_raw));
+  src_raw = reinterpret_cast<const char *>(src);
+  dst_raw = reinterpret_cast<char *>(dst);
+}
+
+void transcode_utf16_to_utf8_run_scalar(const char *&src_raw, const char *src_end_raw, char *&dst_raw,
+                                        char *dst_end_raw) {
+  const uint16_t *src = reinterpret_cast<const uint16_t *>(src_raw);
+  const uint16_t *src_end = reinterpret_cast<const uint16_t *>(src_end_raw);
+  uint8_t *dst = reinterpret_cast<uint8_t *>(dst_raw);
+  transcode_utf16_to_utf8_scalar(src, src_end, src_end, dst, reinterpret_cast<uint8_t *>(dst_end_raw));
+  src_raw = reinterpret_cast<const char *>(src);
+  dst_raw = reinterpret_cast<char *>(dst);
+}
+
+#ifdef DYND_USE_SIMD_TRANSCODE
+
+struct cpu_features {
+  bool sse2;
+  bool ssse3;
+};
+
+cpu_features detect_cpu_features() {
+  cpu_features features = {false, false};
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return features;
+  }
+  // SSE2 (edx bit 26) and SSSE3 (ecx bit 9)
+  features.sse2 = (edx & (1u << 26)) != 0;
+  features.ssse3 = (ecx & (1u << 9)) != 0;
+  return features;
+}
+
+const cpu_features &get_cpu_features() {
+  static const cpu_features features = detect_cpu_features();
+  return features;
+}
+
+/**
+ * Validates UTF-8 16 bytes at a time, with the lookup tables of Keiser and
+ * Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte". Each byte
+ * is classified by the high nibble of the byte before it, the low nibble of
+ * the byte before it and its own high nibble. The three lookups are anded
+ * together, and are nonzero exactly where the pair of bytes is an error, or
+ * where a continuation byte is the third or fourth of its sequence.
+ */
+__attribute__((target("ssse3"))) size_t utf8_valid_prefix_ssse3(const uint8_t *src, size_t size) {
+  const char too_short = 1 << 0, too_long = 1 << 1, overlong_3 = 1 << 2, too_large = 1 << 3, surrogate = 1 << 4,
+             overlong_2 = 1 << 5, too_large_1000 = 1 << 6, overlong_4 = 1 << 6, two_conts = static_cast<char>(1 << 7);
+  const char carry = too_short | too_long | two_conts;
+
+  const __m128i byte_1_high_table =
+      _mm_setr_epi8(too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long, two_conts,
+                    two_conts, two_conts, two_conts, too_short | overlong_2, too_short,
+                    too_short | overlong_3 | surrogate, too_short | too_large | too_large_1000 | overlong_4);
+  const __m128i byte_1_low_table = _mm_setr_epi8(
+      carry | overlong_3 | overlong_2 | overlong_4, carry | overlong_2, carry, carry, carry | too_large,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000 | surrogate, carry | too_large | too_large_1000,
+      carry | too_large | too_large_1000);
+  const __m128i byte_2_high_table = _mm_setr_epi8(
+      too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+      too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+      too_long | overlong_2 | two_conts | overlong_3 | too_large,
+      too_long | overlong_2 | two_conts | surrogate | too_large,
+      too_long | overlong_2 | two_conts | surrogate | too_large, too_short, too_short, too_short, too_short);
+
+  const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+  const __m128i zero = _mm_setzero_si128();
+  // Bytes before the string count as ASCII
+  __m128i prev = zero;
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    __m128i byte_1_high =
+        _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask));
+    __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble_mask));
+    __m128i byte_2_high =
+        _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask));
+    __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    // Continuation bytes which are the third or fourth of their sequence
+    __m128i is_third_byte =
+        _mm_subs_epu8(_mm_alignr_epi8(input, prev, 14), _mm_set1_epi8(static_cast<char>(0xe0 - 1)));
+    __m128i is_fourth_byte =
+        _mm_subs_epu8(_mm_alignr_epi8(input, prev, 13), _mm_set1_epi8(static_cast<char>(0xf0 - 1)));
+    __m128i must_be_2_3_continuation = _mm_and_si128(
+        _mm_cmpgt_epi8(_mm_or_si128(is_third_byte, is_fourth_byte), zero), _mm_set1_epi8(static_cast<char>(0x80)));
+
+    __m128i error = _mm_xor_si128(must_be_2_3_continuation, special_cases);
+    // A NUL ends the run too
+    error = _mm_or_si128(error, _mm_cmpeq_epi8(input, zero));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xffff) {
+      break;
+    }
+    prev = input;
+  }
+
+  // Everything before i is checked, except that the last sequence may be
+  // missing bytes, so back up to where it starts and finish one sequence at a
+  // time
+  for (int k = 0; k < 3 && i > 0 && (src[i - 1] & 0xc0) == 0x80; ++k) {
+    --i;
+  }
+  if (i > 0 && src[i - 1] >= 0xc0) {
+    --i;
+  }
+  return i + utf8_valid_prefix_scalar(src + i, size - i);
+}
+
+__attribute__((target("ssse3"))) void transcode_utf8_run_ssse3(const char *&src_raw, const char *src_end_raw,
+                                                                 char *&dst_raw, char *dst_end_raw) {
+  size_t size = min(src_end_raw - src_raw, dst_end_raw - dst_raw);
+  size_t valid_size = utf8_valid_prefix_ssse3(reinterpret_cast<const uint8_t *>(src_raw), size);
+  memcpy(dst_raw, src_raw, valid_size);
+  src_raw += valid_size;
+  dst_raw += valid_size;
+}
+
+/**
+ * Converts UTF-8 to UTF-16 16 bytes at a time when they are all ASCII, or are
+ * eight two-byte sequences, and one code point at a time otherwise.
+ */
+__attribute__((target("sse2"))) void transcode_utf8_to_utf16_run_sse2(const char *&src_raw, const char *src_end_raw,
+                                                                        char *&dst_raw, char *dst_end_raw) {
+  const uint8_t *src = reinterpret_cast<const uint8_t *>(src_raw);
+  const uint8_t *src_end = reinterpret_cast<const uint8_t *>(src_end_raw);
+  uint16_t *dst = reinterpret_cast<uint16_t *>(dst_raw);
+  uint16_t *dst_end = reinterpret_cast<uint16_t *>(dst_end_raw);
+  const __m128i zero = _mm_setzero_si128();
+
+  while (src < src_end) {
+    if (src_end - src >= 16 && dst_end - dst >= 16) {
+      __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+      if ((_mm_movemask_epi8(input) | _mm_movemask_epi8(_mm_cmpeq_epi8(input, zero))) == 0) {
+        // Widen 16 ASCII characters
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi8(input, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 8), _mm_unpackhi_epi8(input, zero));
+        src += 16;
+        dst += 16;
+        continue;
+      }
+      // Eight two-byte sequences, each a 110xxxxx lead of at least 0xc2 and a
+      // 10xxxxxx continuation, which as a little-endian 16-bit lane is
+      // 10xxxxxx110xxxxx
+      __m128i is_pair = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xc0e0))),
+                                        _mm_set1_epi16(static_cast<short>(0x80c0)));
+      __m128i is_overlong = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(0x001e)), zero);
+      if (_mm_movemask_epi8(_mm_andnot_si128(is_overlong, is_pair)) == 0xffff) {
+        __m128i high = _mm_slli_epi16(_mm_and_si128(input, _mm_set1_epi16(0x001f)), 6);
+        __m128i low = _mm_and_si128(_mm_srli_epi16(input, 8), _mm_set1_epi16(0x003f));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_or_si128(high, low));
+        src += 16;
+        dst += 8;
+        continue;
+      }
+    }
+    // Finish the block one code point at a time
+    const uint8_t *src_stop = src + min<intptr_t>(src_end - src, 16);
+    if (!transcode_utf8_to_utf16_scalar(src, src_stop, src_end, dst, dst_end)) {
+      break;
+    }
+  }
+
+  src_raw = reinterpret_cast<const char *>(src);
+  dst_raw = reinterpret_cast<char *>(dst);
+}
+
+/**
+ * Converts UTF-16 to UTF-8 eight code units at a time when they are all ASCII,
+ * or all from 0x80 to 0x7ff, and one code point at a time otherwise.
+ */
+__attribute__((target("sse2"))) void transcode_utf16_to_utf8_run_sse2(const char *&src_raw, const char *src_end_raw,
+                                                                        char *&dst_raw, char *dst_end_raw) {
+  const uint16_t *src = reinterpret_cast<const uint16_t *>(src_raw);
+  const uint16_t *src_end = reinterpret_cast<const uint16_t *>(src_end_raw);
+  uint8_t *dst = reinterpret_cast<uint8_t *>(dst_raw);
+  uint8_t *dst_end = reinterpret_cast<uint8_t *>(dst_end_raw);
+  const __m128i zero = _mm_setzero_si128();
+
+  while (src < src_end) {
+    if (src_end - src >= 8 && dst_end - dst >= 16) {
+      __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+      __m128i below_0x80 = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xff80))), zero);
+      if (_mm_movemask_epi8(_mm_andnot_si128(_mm_cmpeq_epi16(input, zero), below_0x80)) == 0xffff) {
+        // Narrow eight nonzero ASCII characters
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_packus_epi16(input, input));
+        src += 8;
+        dst += 8;
+        continue;
+      }
+      __m128i below_0x800 = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xf800))), zero);
+      if (_mm_movemask_epi8(_mm_andnot_si128(below_0x80, below_0x800)) == 0xffff) {
+        // Each code unit becomes a 110xxxxx lead and a 10xxxxxx continuation,
+        // which in a little-endian 16-bit lane are its low and high bytes
+        __m128i lead = _mm_or_si128(_mm_srli_epi16(input, 6), _mm_set1_epi16(0x00c0));
+        __m128i continuation = _mm_or_si128(_mm_and_si128(input, _mm_set1_epi16(0x003f)), _mm_set1_epi16(0x0080));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_or_si128(lead, _mm_slli_epi16(continuation, 8)));
+        src += 8;
+        dst += 16;
+        continue;
+      }
+    }
+    const uint16_t *src_stop = src + min<intptr_t>(src_end - src, 8);
+    if (!transcode_utf16_to_utf8_scalar(src, src_stop, src_end, dst, dst_end)) {
+      break;
+    }
+  }
+
+  src_raw = reinterpret_cast<const char *>(src);
+  dst_raw = reinterpret_cast<char *>(dst);
+}
+
+#endif // DYND_USE_SIMD_TRANSCODE
+
+template <typename DstUnitType>
+transcode_run_t get_transcode_ascii_run_function_from(string_encoding_t src_encoding) {
+  switch (string_encoding_char_size_table[src_encoding]) {
+  case 1:
+    return transcode_ascii_run<DstUnitType, uint8_t>;
+  case 2:
+    return transcode_ascii_run<DstUnitType, uint16_t>;
+  case 4:
+    return transcode_ascii_run<DstUnitType, uint32_t>;
+  default:
+    throw runtime_error("get_transcode_run_function: Unrecognized string encoding");
+  }
+}
 } // anonymous namespace
 
 next_unicode_codepoint_t dynd::get_next_unicode_codepoint_function(string_encoding_t encoding,
@@ -361,6 +790,43 @@ append_unicode_codepoint_t dynd::get_append_unicode_codepoint_function(string_en
   }
 }
 
+transcode_run_t dynd::get_transcode_run_function(string_encoding_t dst_encoding, string_encoding_t src_encoding) {
+  if (src_encoding == string_encoding_utf_8 &&
+      (dst_encoding == string_encoding_utf_8 || dst_encoding == string_encoding_utf_16)) {
+#ifdef DYND_USE_SIMD_TRANSCODE
+    const cpu_features &features = get_cpu_features();
+    if (dst_encoding == string_encoding_utf_8 && features.ssse3) {
+      return transcode_utf8_run_ssse3;
+    }
+    if (dst_encoding == string_encoding_utf_16 && features.sse2) {
+      return transcode_utf8_to_utf16_run_sse2;
+    }
+#endif
+    return (dst_encoding == string_encoding_utf_8) ? transcode_utf8_run_scalar : transcode_utf8_to_utf16_run_scalar;
+  }
+  if (src_encoding == string_encoding_utf_16 && dst_encoding == string_encoding_utf_8) {
+#ifdef DYND_USE_SIMD_TRANSCODE
+    if (get_cpu_features().sse2) {
+      return transcode_utf16_to_utf8_run_sse2;
+    }
+#endif
+    return transcode_utf16_to_utf8_run_scalar;
+  }
+
+  // Otherwise, every encoding stores ASCII as a single code unit, so only the
+  // sizes of the code units matter
+  switch (string_encoding_char_size_table[dst_encoding]) {
+  case 1:
+    return get_transcode_ascii_run_function_from<uint8_t>(src_encoding);
+  case 2:
+    return get_transcode_ascii_run_function_from<uint16_t>(src_encoding);
+  case 4:
+    return get_transcode_ascii_run_function_from<uint32_t>(src_encoding);
+  default:
+    throw runtime_error("get_transcode_run_function: Unrecognized string encoding");
+  }
+}
+
 template <next_unicode_codepoint_t next_fn>
 std::string string_range_as_utf8_string_templ(const char *begin, const char *end) {
   std::string result;
@@ -7,6 +7,7 @@
 #include <dynd/callable.hpp>
 #include <dynd/callables/multidispatch_callable.hpp>
 #include <dynd/callables/sum_callable.hpp>
+#include <dynd/callables/wide_sum_callable.hpp>
 #include <dynd/functional.hpp>
 #include <dynd/types/scalar_kind_type.hpp>
 
@@ -30,3 +31,19 @@ DYND_API nd::callable nd::sum = nd::functional::reduction(
                                type_sequence<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t,
                                              float16, float, double, dynd::complex<float>, dynd::complex<double>>>(
             func_ptr)));
+
+DYND_API nd::callable nd::wide_sum = nd::functional::reduction(
+    nd::make_callable<nd::wide_sum_init_callable>(),
+    nd::make_callable<nd::multidispatch_callable<1>>(
+        ndt::make_type<ndt::callable_type>(ndt::make_type<ndt::scalar_kind_type>(),
+                                           {ndt::make_type<ndt::scalar_kind_type>()}),
+        nd::callable::make_all<nd::wide_sum_callable, type_sequence<int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t,
+                                                                    uint32_t, uint64_t>>(func_ptr)));
+
+DYND_API nd::callable nd::wide_mean = nd::functional::reduction(
+    nd::make_callable<nd::wide_mean_init_callable>(),
+    nd::make_callable<nd::multidispatch_callable<1>>(
+        ndt::make_type<ndt::callable_type>(ndt::make_type<ndt::scalar_kind_type>(),
+                                           {ndt::make_type<ndt::scalar_kind_type>()}),
+        nd::callable::make_all<nd::wide_mean_callable, type_sequence<int8_t, int16_t, int32_t, int64_t, uint8_t,
+                                                                     uint16_t, uint32_t, uint64_t>>(func_ptr)));
@@ -32,7 +32,9 @@
 #include <functional>
 #include <iomanip>
 #include <iterator>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 using namespace std;
@@ -59,9 +61,70 @@ char *dynd::iterdata_broadcasting_terminator_reset(iterdata_common *iterdata, ch
   return data;
 }
 
-ndt::type::type(const std::string &rep) { type_from_datashape(rep).swap(*this); }
+namespace {
+
+/**
+ * Cache of types parsed from datashape strings. Types are immutable, so
+ * every construction from the same string can share one base_type. Parsed
+ * types are also interned by their printed form, so that different
+ * spellings of the same type share it too, and equality between them is
+ * a pointer comparison.
+ */
+class datashape_cache {
+  // Past this many entries new strings are parsed but not cached
+  static const size_t max_size = 4096;
+
+  std::mutex m_mutex;
+  std::unordered_map<std::string, ndt::type> m_parsed;
+  std::unordered_map<std::string, ndt::type> m_interned;
+
+public:
+  ndt::type get(const char *rep_begin, const char *rep_end) {
+    std::string rep(rep_begin, rep_end);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_parsed.find(rep);
+      if (it != m_parsed.end()) {
+        return it->second;
+      }
+    }
+
+    // Parse outside the lock, the parser may construct types from strings
+    ndt::type tp = type_from_datashape(rep_begin, rep_end);
+    std::string canonical = tp.is_builtin() ? std::string() : tp.str();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_parsed.size() >= max_size) {
+      return tp;
+    }
+    if (!tp.is_builtin()) {
+      auto it = m_interned.find(canonical);
+      if (it == m_interned.end()) {
+        m_interned.emplace(std::move(canonical), tp);
+      } else if (it->second == tp) {
+        tp = it->second;
+      }
+    }
+    m_parsed.emplace(std::move(rep), tp);
+    return tp;
+  }
 
-ndt::type::type(const char *rep_begin, const char *rep_end) { type_from_datashape(rep_begin, rep_end).swap(*this); }
+  static datashape_cache &instance() {
+    // Intentionally leaked, so cached types outlive other static objects
+    static datashape_cache *cache = new datashape_cache;
+    return *cache;
+  }
+};
+
+} // anonymous namespace
+
+ndt::type::type(const std::string &rep) {
+  datashape_cache::instance().get(rep.data(), rep.data() + rep.size()).swap(*this);
+}
+
+ndt::type::type(const char *rep_begin, const char *rep_end) {
+  datashape_cache::instance().get(rep_begin, rep_end).swap(*this);
+}
 
 size_t ndt::type::get_data_alignment() const {
   switch (reinterpret_cast<uintptr_t>(m_ptr)) {
@@ -210,7 +273,7 @@ ndt::type ndt::type::at_array(int nindices, const irange *indices) const {
   }
 }
 
-bool ndt::type::match(const type &other, std::map<std::string, type> &tp_vars) const {
+bool ndt::type::match(const type &other, typevar_map &tp_vars) const {
   return m_ptr == other.m_ptr || (!is_builtin() && m_ptr->match(other, tp_vars));
 }
 
@@ -34,147 +34,156 @@ specified kind");
 }
 */
 
-ndt::type dynd::promote_types_arithmetic(const ndt::type &tp0, const ndt::type &tp1) {
-  // Use the value types
-  const ndt::type &tp0_val = tp0.value_type();
-  const ndt::type &tp1_val = tp1.value_type();
+namespace {
 
-  // cout << "Doing type promotion with value types " << tp0_val << " and " <<
-  // tp1_val << endl;
+constexpr type_id_t builtin_base_id(type_id_t id) {
+  return (id == bool_id) ? bool_kind_id
+                         : (id >= int8_id && id <= int128_id)
+                               ? int_kind_id
+                               : (id >= uint8_id && id <= uint128_id)
+                                     ? uint_kind_id
+                                     : (id >= float16_id && id <= float128_id)
+                                           ? float_kind_id
+                                           : (id == complex_float32_id || id == complex_float64_id) ? complex_kind_id
+                                                                                                    : uninitialized_id;
+}
 
-  if (tp0_val.is_builtin() && tp1_val.is_builtin()) {
-    const size_t int_size = sizeof(int);
-    if (tp0_val.get_id() == void_id) {
-      return tp1_val;
+constexpr size_t builtin_data_size(type_id_t id) {
+  return (id == bool_id || id == int8_id || id == uint8_id)
+             ? 1
+             : (id == int16_id || id == uint16_id || id == float16_id)
+                   ? 2
+                   : (id == int32_id || id == uint32_id || id == float32_id)
+                         ? 4
+                         : (id == int64_id || id == uint64_id || id == float64_id || id == complex_float32_id) ? 8
+                                                                                                                 : 16;
+}
+
+// Marks a pair of builtin types without an arithmetic promotion
+const int no_promotion = -1;
+
+/**
+ * The builtin type arithmetic on two builtin types is done in, following the
+ * rules for C/C++, or no_promotion if there is none.
+ */
+constexpr int promote_builtin_ids(type_id_t id0, type_id_t id1) {
+  const size_t int_size = sizeof(int);
+  const type_id_t int_id = int32_id;
+  static_assert(sizeof(int) == 4, "int is expected to be int32");
+
+  if (id0 == void_id) {
+    return id1;
+  }
+  if (id1 == void_id) {
+    return (builtin_base_id(id0) != uninitialized_id) ? id0 : no_promotion;
+  }
+
+  const size_t size0 = builtin_data_size(id0), size1 = builtin_data_size(id1);
+  switch (builtin_base_id(id0)) {
+  case bool_kind_id:
+    switch (builtin_base_id(id1)) {
+    case bool_kind_id:
+      return int_id;
+    case int_kind_id:
+    case uint_kind_id:
+      return (size1 >= int_size) ? id1 : int_id;
+    case float_kind_id:
+      // The bool type doesn't affect float type sizes, except
+      // require at least float32
+      return (id1 != float16_id) ? id1 : float32_id;
+    default:
+      return id1;
     }
-    switch (tp0_val.get_base_id()) {
+  case int_kind_id:
+  case uint_kind_id:
+    switch (builtin_base_id(id1)) {
     case bool_kind_id:
-      if (tp1_val.get_id() == void_id) {
-        return tp0_val;
-      }
-      switch (tp1_val.get_base_id()) {
-      case bool_kind_id:
-        return ndt::make_type<int>();
-      case int_kind_id:
-      case uint_kind_id:
-        return (tp1_val.get_data_size() >= int_size) ? tp1_val : ndt::make_type<int>();
-      case float_kind_id:
-        // The bool type doesn't affect float type sizes, except
-        // require at least float32
-        return tp1_val.unchecked_get_builtin_id() != float16_id ? tp1_val : ndt::make_type<float>();
-      default:
-        return tp1_val;
-      }
+      return (size0 >= int_size) ? id0 : int_id;
     case int_kind_id:
-      if (tp1_val.get_id() == void_id) {
-        return tp0_val;
-      }
-      switch (tp1_val.get_base_id()) {
-      case bool_kind_id:
-        return (tp0_val.get_data_size() >= int_size) ? tp0_val : ndt::make_type<int>();
-      case int_kind_id:
-        if (tp0_val.get_data_size() < int_size && tp1_val.get_data_size() < int_size) {
-          return ndt::make_type<int>();
-        } else {
-          return (tp0_val.get_data_size() >= tp1_val.get_data_size()) ? tp0_val : tp1_val;
-        }
-      case uint_kind_id:
-        if (tp0_val.get_data_size() < int_size && tp1_val.get_data_size() < int_size) {
-          return ndt::make_type<int>();
-        } else {
-          // When the element_sizes are equal, the uint kind wins
-          return (tp0_val.get_data_size() > tp1_val.get_data_size()) ? tp0_val : tp1_val;
-        }
-      case float_kind_id:
-        // Integer type sizes don't affect float type sizes, except
-        // require at least float32
-        return tp1_val.unchecked_get_builtin_id() != float16_id ? tp1_val : ndt::make_type<float>();
-      case complex_kind_id:
-        // Integer type sizes don't affect complex type sizes
-        return tp1_val;
-      default:
-        break;
-      }
-      break;
     case uint_kind_id:
-      if (tp1_val.get_id() == void_id) {
-        return tp0_val;
+      if (size0 < int_size && size1 < int_size) {
+        return int_id;
       }
-      switch (tp1_val.get_base_id()) {
-      case bool_kind_id:
-        return (tp0_val.get_data_size() >= int_size) ? tp0_val : ndt::make_type<int>();
-      case int_kind_id:
-        if (tp0_val.get_data_size() < int_size && tp1_val.get_data_size() < int_size) {
-          return ndt::make_type<int>();
-        } else {
-          // When the element_sizes are equal, the uint kind wins
-          return (tp0_val.get_data_size() >= tp1_val.get_data_size()) ? tp0_val : tp1_val;
-        }
-      case uint_kind_id:
-        if (tp0_val.get_data_size() < int_size && tp1_val.get_data_size() < int_size) {
-          return ndt::make_type<int>();
-        } else {
-          return (tp0_val.get_data_size() >= tp1_val.get_data_size()) ? tp0_val : tp1_val;
-        }
-      case float_kind_id:
-        // Integer type sizes don't affect float type sizes, except
-        // require at least float32
-        return tp1_val.unchecked_get_builtin_id() != float16_id ? tp1_val : ndt::make_type<float>();
-      case complex_kind_id:
-        // Integer type sizes don't affect complex type sizes
-        return tp1_val;
-      default:
-        break;
+      // When the element sizes are equal, the uint kind wins
+      if (builtin_base_id(id0) == int_kind_id && builtin_base_id(id1) == uint_kind_id) {
+        return (size0 > size1) ? id0 : id1;
       }
-      break;
+      return (size0 >= size1) ? id0 : id1;
     case float_kind_id:
-      if (tp1_val.get_id() == void_id) {
-        return tp0_val;
-      }
-      switch (tp1_val.get_base_id()) {
-      // Integer type sizes don't affect float type sizes
-      case bool_kind_id:
-      case int_kind_id:
-      case uint_kind_id:
-        return tp0_val;
-      case float_kind_id:
-        return ndt::type(reinterpret_cast<ndt::base_type *>(max(
-                             max(tp0_val.unchecked_get_builtin_id(), tp1_val.unchecked_get_builtin_id()), float32_id)),
-                         false);
-      case complex_kind_id:
-        if (tp0_val.get_id() == float64_id && tp1_val.get_id() == complex_float32_id) {
-          return ndt::make_type<complex<double>>();
-        } else {
-          return tp1_val;
-        }
-      default:
-        break;
-      }
-      break;
+      // Integer type sizes don't affect float type sizes, except
+      // require at least float32
+      return (id1 != float16_id) ? id1 : float32_id;
     case complex_kind_id:
-      if (tp1_val.get_id() == void_id) {
-        return tp0_val;
-      }
-      switch (tp1_val.get_base_id()) {
-      // Integer and float type sizes don't affect complex type sizes
-      case bool_kind_id:
-      case int_kind_id:
-      case uint_kind_id:
-      case float_kind_id:
-        if (tp0_val.unchecked_get_builtin_id() == complex_float32_id &&
-            tp1_val.unchecked_get_builtin_id() == float64_id) {
-          return ndt::make_type<complex<double>>();
-        } else {
-          return tp0_val;
-        }
-      case complex_kind_id:
-        return (tp0_val.get_data_size() >= tp1_val.get_data_size()) ? tp0_val : tp1_val;
-      default:
-        break;
-      }
-      break;
+      // Integer type sizes don't affect complex type sizes
+      return id1;
+    default:
+      return no_promotion;
+    }
+  case float_kind_id:
+    switch (builtin_base_id(id1)) {
+    // Integer type sizes don't affect float type sizes
+    case bool_kind_id:
+    case int_kind_id:
+    case uint_kind_id:
+      return id0;
+    case float_kind_id:
+      return (id0 > id1) ? ((id0 > float32_id) ? id0 : float32_id) : ((id1 > float32_id) ? id1 : float32_id);
+    case complex_kind_id:
+      return (id0 == float64_id && id1 == complex_float32_id) ? complex_float64_id : id1;
     default:
-      break;
+      return no_promotion;
+    }
+  case complex_kind_id:
+    switch (builtin_base_id(id1)) {
+    // Integer and float type sizes don't affect complex type sizes
+    case bool_kind_id:
+    case int_kind_id:
+    case uint_kind_id:
+    case float_kind_id:
+      return (id0 == complex_float32_id && id1 == float64_id) ? complex_float64_id : id0;
+    case complex_kind_id:
+      return (size0 >= size1) ? id0 : id1;
+    default:
+      return no_promotion;
+    }
+  default:
+    return no_promotion;
+  }
+}
+
+/**
+ * The promotions of every pair of builtin types, generated at compile time.
+ */
+struct builtin_promotion_table {
+  signed char ids[builtin_id_count][builtin_id_count];
+
+  constexpr builtin_promotion_table() : ids() {
+    for (size_t i = 0; i < builtin_id_count; ++i) {
+      for (size_t j = 0; j < builtin_id_count; ++j) {
+        ids[i][j] = static_cast<signed char>(promote_builtin_ids(static_cast<type_id_t>(i), static_cast<type_id_t>(j)));
+      }
+    }
+  }
+};
+
+constexpr builtin_promotion_table builtin_promotions;
+
+static_assert(builtin_promotions.ids[int8_id][uint8_id] == int32_id, "small integers promote to int");
+static_assert(builtin_promotions.ids[int32_id][uint32_id] == uint32_id, "the uint kind wins for equal sizes");
+static_assert(builtin_promotions.ids[float64_id][complex_float32_id] == complex_float64_id,
+              "complex promotion keeps float64 precision");
+
+} // anonymous namespace
+
+ndt::type dynd::promote_types_arithmetic(const ndt::type &tp0, const ndt::type &tp1) {
+  // Use the value types
+  const ndt::type &tp0_val = tp0.value_type();
+  const ndt::type &tp1_val = tp1.value_type();
+
+  if (tp0_val.is_builtin() && tp1_val.is_builtin()) {
+    int id = builtin_promotions.ids[tp0_val.unchecked_get_builtin_id()][tp1_val.unchecked_get_builtin_id()];
+    if (id != no_promotion) {
+      return ndt::type(reinterpret_cast<ndt::base_type *>(static_cast<intptr_t>(id)), false);
     }
 
     stringstream ss;
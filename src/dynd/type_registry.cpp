@@ -99,7 +99,7 @@ DYNDT_API vector<id_info> &detail::infos() {
 }
 
 ndt::type dynd::default_parse_type_args(type_id_t id, const char *&begin, const char *end,
-                                        std::map<std::string, ndt::type> &symtable) {
+                                        ndt::typevar_map &symtable) {
   ndt::type result, element_type;
   const char *saved_begin = begin;
   nd::buffer args = datashape::parse_type_constr_args(begin, end, symtable);
@@ -18,7 +18,7 @@ void ndt::base_dim_type::get_element_types(std::size_t ndim, const type **elemen
   }
 }
 
-bool ndt::base_dim_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const
+bool ndt::base_dim_type::match(const type &candidate_tp, typevar_map &tp_vars) const
 {
   if (get_id() != candidate_tp.get_id()) {
     return false;
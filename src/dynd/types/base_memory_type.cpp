@@ -108,7 +108,7 @@ void ndt::base_memory_type::arrmeta_destruct(char *arrmeta) const {
   }
 }
 
-bool ndt::base_memory_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::base_memory_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.get_base_id() != memory_id) {
     return false;
   }
@@ -194,7 +194,7 @@ nd::buffer ndt::base_type::get_type_constructor_args() const {
   throw std::runtime_error(ss.str());
 }
 
-bool ndt::base_type::match(const type &candidate_tp, std::map<std::string, type> &DYND_UNUSED(tp_vars)) const {
+bool ndt::base_type::match(const type &candidate_tp, typevar_map &DYND_UNUSED(tp_vars)) const {
   // The default match implementation is equality, pattern types
   // must override this virtual function.
   if (candidate_tp.is_builtin()) {
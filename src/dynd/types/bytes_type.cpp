@@ -112,7 +112,7 @@ std::map<std::string, std::pair<ndt::type, const char *>> ndt::bytes_type::get_d
 
 // bytes_type : bytes[align=<alignment>]
 ndt::type ndt::bytes_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin, const char *end,
-                                           std::map<std::string, ndt::type> &DYND_UNUSED(symtable)) {
+                                           ndt::typevar_map &DYND_UNUSED(symtable)) {
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
     if (datashape::parse_token(begin, end, "align")) {
@@ -184,7 +184,7 @@ void ndt::callable_type::data_destruct_strided(const char *DYND_UNUSED(arrmeta),
   */
 }
 
-bool ndt::callable_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::callable_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.get_id() != callable_id) {
     return false;
   }
@@ -84,6 +84,6 @@ void ndt::categorical_kind_type::data_destruct_strided(const char *DYND_UNUSED(a
 }
 
 bool ndt::categorical_kind_type::match(const type &candidate_tp,
-                                       std::map<std::string, type> &DYND_UNUSED(tp_vars)) const {
+                                       typevar_map &DYND_UNUSED(tp_vars)) const {
   return candidate_tp.get_id() == categorical_id || candidate_tp.get_id() == categorical_kind_id;
 }
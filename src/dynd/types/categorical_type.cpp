@@ -4,14 +4,15 @@
 //
 
 #include <cstring>
+#include <algorithm>
+#include <limits>
 #include <map>
-#include <set>
+#include <vector>
 
 #include <dynd/array_range.hpp>
 #include <dynd/assignment.hpp>
 #include <dynd/callable.hpp>
 #include <dynd/parse_util.hpp>
-#include <dynd/search.hpp>
 #include <dynd/types/categorical_type.hpp>
 #include <dynd/types/datashape_parser.hpp>
 #include <dynd/types/fixed_dim_type.hpp>
@@ -21,41 +22,279 @@ using namespace std;
 
 namespace {
 
-class sorter {
-  char *m_originptr;
-  intptr_t m_stride;
-  const kernel_single_t m_less;
-  nd::kernel_prefix *m_less_self;
+bool is_indexable_category_type(const ndt::type &tp) {
+  switch (tp.get_id()) {
+  case bool_id:
+  case int8_id:
+  case int16_id:
+  case int32_id:
+  case int64_id:
+  case int128_id:
+  case uint8_id:
+  case uint16_id:
+  case uint32_id:
+  case uint64_id:
+  case uint128_id:
+  case float16_id:
+  case float32_id:
+  case float64_id:
+  case complex_float32_id:
+  case complex_float64_id:
+  case fixed_string_id:
+  case string_id:
+    return true;
+  default:
+    return false;
+  }
+}
 
-public:
-  sorter(const char *originptr, intptr_t stride, const kernel_single_t less, nd::kernel_prefix *less_self)
-      : m_originptr(const_cast<char *>(originptr)), m_stride(stride), m_less(less), m_less_self(less_self) {}
+void check_indexable_category_type(const ndt::type &tp) {
+  if (!is_indexable_category_type(tp)) {
+    throw dynd::type_error("categorical_type only supports builtin and string categories, not " + tp.str());
+  }
+}
 
-  bool operator()(intptr_t i, intptr_t j) const {
-    int dst;
-    char *s[2] = {m_originptr + i * m_stride, m_originptr + j * m_stride};
-    m_less(m_less_self, reinterpret_cast<char *>(&dst), s);
+/**
+ * The bytes a category value is hashed and compared by. Floating-point zeros
+ * are made positive and NaNs are replaced by the default quiet NaN, because
+ * +0.0 and -0.0 are the same category, as are all the NaNs.
+ */
+struct category_key {
+  const char *data;
+  size_t size;
+  char buffer[16];
+};
 
-    return dst != 0;
+template <typename T>
+void canonicalize_floats(char *data, size_t data_size) {
+  for (size_t i = 0; i < data_size; i += sizeof(T)) {
+    T value;
+    memcpy(&value, data + i, sizeof(T));
+    if (value == 0) {
+      value = 0;
+      memcpy(data + i, &value, sizeof(T));
+    } else if (value != value) {
+      value = std::numeric_limits<T>::quiet_NaN();
+      memcpy(data + i, &value, sizeof(T));
+    }
+  }
+}
+
+/**
+ * Describes a strided array of category values of one of the indexable types.
+ */
+struct category_layout {
+  type_id_t id;
+  size_t data_size;
+  const char *origin;
+  intptr_t stride;
+
+  category_layout(const ndt::type &tp, const char *origin, intptr_t stride)
+      : id(tp.get_id()), data_size(tp.get_data_size()), origin(origin), stride(stride) {}
+
+  const char *at(intptr_t i) const { return origin + i * stride; }
+
+  void get_key(const char *data, category_key &key) const {
+    key.data = data;
+    key.size = data_size;
+    switch (id) {
+    case string_id: {
+      const dynd::string *str = reinterpret_cast<const dynd::string *>(data);
+      key.data = str->data();
+      key.size = str->size();
+      break;
+    }
+    case float16_id: {
+      uint16_t bits;
+      memcpy(&bits, data, sizeof(bits));
+      if ((bits & 0x7fffu) == 0) {
+        bits = 0;
+      } else if ((bits & 0x7fffu) > 0x7c00u) {
+        bits = 0x7e00u;
+      }
+      memcpy(key.buffer, &bits, sizeof(bits));
+      key.data = key.buffer;
+      break;
+    }
+    case float32_id:
+    case complex_float32_id:
+      memcpy(key.buffer, data, data_size);
+      canonicalize_floats<float>(key.buffer, data_size);
+      key.data = key.buffer;
+      break;
+    case float64_id:
+    case complex_float64_id:
+      memcpy(key.buffer, data, data_size);
+      canonicalize_floats<double>(key.buffer, data_size);
+      key.data = key.buffer;
+      break;
+    default:
+      break;
+    }
+  }
+
+  static uint64_t hash(const category_key &key) {
+    const uint64_t mul = 0x9e3779b97f4a7c15ULL;
+    uint64_t h = key.size * mul;
+    const char *data = key.data;
+    size_t size = key.size;
+    for (; size >= 8; data += 8, size -= 8) {
+      uint64_t word;
+      memcpy(&word, data, 8);
+      h = (h ^ word) * mul;
+      h ^= h >> 32;
+    }
+    if (size > 0) {
+      uint64_t word = 0;
+      memcpy(&word, data, size);
+      h = (h ^ word) * mul;
+    }
+    h ^= h >> 29;
+    return h;
+  }
+
+  template <typename T>
+  static int compare_as(const char *a, const char *b) {
+    T x, y;
+    memcpy(&x, a, sizeof(T));
+    memcpy(&y, b, sizeof(T));
+    return (x < y) ? -1 : ((y < x) ? 1 : 0);
+  }
+
+  /**
+   * A total order on floating-point values, which sorts the NaNs after
+   * everything else and treats them as equal to each other, matching the
+   * canonical keys.
+   */
+  template <typename T>
+  static int compare_float(T x, T y) {
+    bool x_nan = (x != x), y_nan = (y != y);
+    if (x_nan || y_nan) {
+      return static_cast<int>(x_nan) - static_cast<int>(y_nan);
+    }
+    return (x < y) ? -1 : ((y < x) ? 1 : 0);
   }
-};
 
-class cmp {
-  const kernel_single_t m_less;
-  nd::kernel_prefix *m_less_self;
+  template <typename T>
+  static int compare_float(const char *a, const char *b) {
+    T x, y;
+    memcpy(&x, a, sizeof(T));
+    memcpy(&y, b, sizeof(T));
+    return compare_float(x, y);
+  }
 
-public:
-  cmp(const kernel_single_t less, nd::kernel_prefix *less_self) : m_less(less), m_less_self(less_self) {}
+  template <typename T>
+  static int compare_complex(const char *a, const char *b) {
+    int c = compare_float<T>(a, b);
+    return (c != 0) ? c : compare_float<T>(a + sizeof(T), b + sizeof(T));
+  }
 
-  bool operator()(const char *a, const char *b) const {
-    int dst;
-    char *s[2] = {const_cast<char *>(a), const_cast<char *>(b)};
+  static int compare_bytes(const char *a, size_t a_size, const char *b, size_t b_size) {
+    int c = memcmp(a, b, std::min(a_size, b_size));
+    return (c != 0) ? c : ((a_size < b_size) ? -1 : ((b_size < a_size) ? 1 : 0));
+  }
 
-    m_less(m_less_self, reinterpret_cast<char *>(&dst), s);
-    return dst != 0;
+  int compare(const char *a, const char *b) const {
+    switch (id) {
+    case bool_id:
+    case uint8_id:
+      return compare_as<uint8_t>(a, b);
+    case int8_id:
+      return compare_as<int8_t>(a, b);
+    case int16_id:
+      return compare_as<int16_t>(a, b);
+    case int32_id:
+      return compare_as<int32_t>(a, b);
+    case int64_id:
+      return compare_as<int64_t>(a, b);
+    case int128_id:
+      return compare_as<int128>(a, b);
+    case uint16_id:
+      return compare_as<uint16_t>(a, b);
+    case uint32_id:
+      return compare_as<uint32_t>(a, b);
+    case uint64_id:
+      return compare_as<uint64_t>(a, b);
+    case uint128_id:
+      return compare_as<uint128>(a, b);
+    case float16_id:
+      return compare_float(halfbits_to_float(*reinterpret_cast<const uint16_t *>(a)),
+                           halfbits_to_float(*reinterpret_cast<const uint16_t *>(b)));
+    case float32_id:
+      return compare_float<float>(a, b);
+    case float64_id:
+      return compare_float<double>(a, b);
+    case complex_float32_id:
+      return compare_complex<float>(a, b);
+    case complex_float64_id:
+      return compare_complex<double>(a, b);
+    case string_id: {
+      const dynd::string *x = reinterpret_cast<const dynd::string *>(a);
+      const dynd::string *y = reinterpret_cast<const dynd::string *>(b);
+      return compare_bytes(x->data(), x->size(), y->data(), y->size());
+    }
+    default:
+      return memcmp(a, b, data_size);
+    }
   }
+
+  void copy(char *dst, const char *src) const {
+    if (id == string_id) {
+      *reinterpret_cast<dynd::string *>(dst) = *reinterpret_cast<const dynd::string *>(src);
+    } else {
+      memcpy(dst, src, data_size);
+    }
+  }
+
+  /**
+   * Returns the slot of the table that either holds the index of a value
+   * equal to ``key``, or is empty (-1) and is where that value belongs.
+   */
+  size_t find_slot(const std::vector<intptr_t> &slots, const category_key &key) const {
+    size_t mask = slots.size() - 1;
+    for (size_t pos = hash(key) & mask;; pos = (pos + 1) & mask) {
+      intptr_t i = slots[pos];
+      if (i < 0) {
+        return pos;
+      }
+      category_key slot_key;
+      get_key(at(i), slot_key);
+      if (slot_key.size == key.size && memcmp(slot_key.data, key.data, key.size) == 0) {
+        return pos;
+      }
+    }
+  }
+
+  /**
+   * Inserts the indices into a table of the given capacity, which must be a
+   * power of two larger than the number of indices. The values at the
+   * indices must be unique.
+   */
+  void fill_slots(std::vector<intptr_t> &slots, size_t capacity, const intptr_t *indices, size_t count) const {
+    slots.assign(capacity, -1);
+    for (size_t j = 0; j != count; ++j) {
+      category_key key;
+      get_key(at(indices[j]), key);
+      slots[find_slot(slots, key)] = indices[j];
+    }
+  }
+
+  struct less {
+    const category_layout &layout;
+
+    bool operator()(intptr_t i, intptr_t j) const { return layout.compare(layout.at(i), layout.at(j)) < 0; }
+  };
 };
 
+// Keeps the hash tables at most half full
+size_t category_hash_capacity(size_t count) {
+  size_t capacity = 16;
+  while (capacity < 2 * count) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
 // struct assign_from_commensurate_category {
 //     static void general_kernel(char *dst, intptr_t dst_stride, const char
 //     *src, intptr_t src_stride,
@@ -106,24 +345,17 @@ public:
 
 } // anoymous namespace
 
-/** This function converts the set of char* pointers into a strided immutable
- * nd::array of the categories */
-static nd::array make_sorted_categories(const set<const char *, cmp> &uniques, const ndt::type &element_tp,
-                                        const char *DYND_UNUSED(arrmeta)) {
-  nd::array categories = nd::empty(uniques.size(), element_tp);
-  nd::kernel_builder k;
-  //  make_assignment_kernel(&k, element_tp, categories.get()->metadata() + sizeof(fixed_dim_type_arrmeta), element_tp,
-  //                       arrmeta, kernel_request_single, &eval::default_eval_context);
-  kernel_single_t fn = k.get()->get_function<kernel_single_t>();
+/** Copies the values at the indices into a new array of the categories */
+static nd::array make_sorted_categories(const category_layout &layout, const std::vector<intptr_t> &indices,
+                                        const ndt::type &element_tp) {
+  nd::array categories = nd::empty(indices.size(), element_tp);
 
   intptr_t stride = reinterpret_cast<const fixed_dim_type_arrmeta *>(categories.get()->metadata())->stride;
   char *dst_ptr = categories.data();
-  for (set<const char *, cmp>::const_iterator it = uniques.begin(); it != uniques.end(); ++it) {
-    char *src = const_cast<char *>(*it);
-    fn(k.get(), dst_ptr, &src);
+  for (intptr_t i : indices) {
+    layout.copy(dst_ptr, layout.at(i));
     dst_ptr += stride;
   }
-  categories.get_type().extended()->arrmeta_finalize_buffers(categories.get()->metadata());
 
   return categories;
 }
@@ -155,41 +387,33 @@ ndt::categorical_type::categorical_type(type_id_t id, const nd::array &categorie
                              "a 1-dimensional strided array of categories");
     }
 
+    check_indexable_category_type(m_category_tp);
+
     category_count = categories.get_dim_size();
     intptr_t categories_stride = reinterpret_cast<const fixed_dim_type_arrmeta *>(categories.get()->metadata())->stride;
-
-    const char *categories_element_arrmeta = categories.get()->metadata() + sizeof(fixed_dim_type_arrmeta);
-    nd::kernel_builder k;
-    kernel_single_t fn = k.get()->get_function<kernel_single_t>();
-
-    cmp less(fn, k.get());
-    set<const char *, cmp> uniques(less);
+    category_layout layout(m_category_tp, categories.cdata(), categories_stride);
 
     m_value_to_category_index = nd::empty(category_count, make_type<intptr_t>());
     m_category_index_to_value = nd::empty(category_count, make_type<intptr_t>());
 
-    // create the mapping from indices of (to be lexicographically sorted)
-    // categories to values
-    for (size_t i = 0; i != (size_t)category_count; ++i) {
-      unchecked_fixed_dim_get_rw<intptr_t>(m_category_index_to_value, i) = i;
-      const char *category_value = categories.cdata() + i * categories_stride;
+    // create the mapping from indices of (to be sorted) categories to values
+    std::vector<intptr_t> sorted(category_count);
+    for (intptr_t i = 0; i < category_count; ++i) {
+      sorted[i] = i;
+    }
+    std::sort(sorted.begin(), sorted.end(), category_layout::less{layout});
 
-      if (uniques.find(category_value) == uniques.end()) {
-        uniques.insert(category_value);
-      } else {
+    for (intptr_t i = 0; i < category_count; ++i) {
+      if (i > 0 && layout.compare(layout.at(sorted[i - 1]), layout.at(sorted[i])) == 0) {
         stringstream ss;
         ss << "categories must be unique: category value ";
-        m_category_tp.print_data(ss, categories_element_arrmeta, category_value);
+        m_category_tp.print_data(ss, categories.get()->metadata() + sizeof(fixed_dim_type_arrmeta),
+                                 layout.at(sorted[i]));
         ss << " appears more than once";
         throw std::runtime_error(ss.str());
       }
+      unchecked_fixed_dim_get_rw<intptr_t>(m_category_index_to_value, i) = sorted[i];
     }
-    // TODO: Putting everything in a set already caused a sort operation to
-    // occur,
-    //       there's no reason we should need a second sort.
-    std::sort(&unchecked_fixed_dim_get_rw<intptr_t>(m_category_index_to_value, 0),
-              &unchecked_fixed_dim_get_rw<intptr_t>(m_category_index_to_value, category_count),
-              sorter(categories.cdata(), categories_stride, fn, k.get()));
 
     // invert the m_category_index_to_value permutation
     for (intptr_t i = 0; i < category_count; ++i) {
@@ -197,7 +421,7 @@ ndt::categorical_type::categorical_type(type_id_t id, const nd::array &categorie
                                            unchecked_fixed_dim_get<intptr_t>(m_category_index_to_value, i)) = i;
     }
 
-    m_categories = make_sorted_categories(uniques, m_category_tp, categories_element_arrmeta);
+    m_categories = make_sorted_categories(layout, sorted, m_category_tp);
   }
 
   // Use the number of categories to set which underlying integer storage to use
@@ -210,6 +434,29 @@ ndt::categorical_type::categorical_type(type_id_t id, const nd::array &categorie
   }
   this->m_data_size = m_storage_type.get_data_size();
   this->m_data_alignment = (uint8_t)m_storage_type.get_data_alignment();
+
+  build_category_hash();
+}
+
+void ndt::categorical_type::build_category_hash() {
+  check_indexable_category_type(m_category_tp);
+
+  size_t category_count = get_category_count();
+  category_layout layout(m_category_tp, m_categories.cdata(),
+                         reinterpret_cast<const fixed_dim_type_arrmeta *>(m_categories.get()->metadata())->stride);
+  std::vector<intptr_t> indices(category_count);
+  for (size_t i = 0; i != category_count; ++i) {
+    indices[i] = i;
+  }
+  layout.fill_slots(m_category_hash, category_hash_capacity(category_count), indices.data(), category_count);
+}
+
+intptr_t ndt::categorical_type::find_category(const char *category_data) const {
+  category_layout layout(m_category_tp, m_categories.cdata(),
+                         reinterpret_cast<const fixed_dim_type_arrmeta *>(m_categories.get()->metadata())->stride);
+  category_key key;
+  layout.get_key(category_data, key);
+  return m_category_hash[layout.find_slot(m_category_hash, key)];
 }
 
 void ndt::categorical_type::print_data(std::ostream &o, const char *DYND_UNUSED(arrmeta), const char *data) const {
@@ -262,13 +509,7 @@ void ndt::categorical_type::get_shape(intptr_t ndim, intptr_t i, intptr_t *out_s
 }
 
 uint32_t ndt::categorical_type::get_value_from_category(const char *category_arrmeta, const char *category_data) const {
-  type dst_tp = make_type<intptr_t>();
-  type src_tp[2] = {m_categories.get_type(), m_category_tp};
-  const char *src_arrmeta[2] = {m_categories.get()->metadata(), category_arrmeta};
-  char *src_data[2] = {const_cast<char *>(m_categories.cdata()), const_cast<char *>(category_data)};
-  intptr_t i =
-      nd::binary_search->call(dst_tp, 2, src_tp, src_arrmeta, src_data, 0, NULL, std::map<std::string, ndt::type>())
-          .as<intptr_t>();
+  intptr_t i = find_category(category_data);
   if (i < 0) {
     stringstream ss;
     ss << "Unrecognized category value ";
@@ -291,11 +532,11 @@ uint32_t ndt::categorical_type::get_value_from_category(const nd::array &categor
     c.assign(category);
   }
 
-  intptr_t i = nd::binary_search(m_categories, c).as<intptr_t>();
+  intptr_t i = find_category(c.cdata());
   if (i < 0) {
     stringstream ss;
     ss << "Unrecognized category value ";
-    m_category_tp.print_data(ss, c.get()->metadata(), c.data());
+    m_category_tp.print_data(ss, c.get()->metadata(), c.cdata());
     ss << " assigning to dynd type " << type(this, true);
     throw std::runtime_error(ss.str());
   } else {
@@ -317,13 +558,9 @@ nd::array ndt::categorical_type::get_categories() const {
   type el_tp;
   const char *el_arrmeta;
   categories.get_type().get_as_strided(categories.get()->metadata(), &dim_size, &stride, &el_tp, &el_arrmeta);
-  nd::kernel_builder k;
-  //  ::make_assignment_kernel(&k, m_category_tp, el_arrmeta, el_tp, get_category_arrmeta(), kernel_request_single,
-  //                         &eval::default_eval_context);
-  kernel_single_t fn = k.get()->get_function<kernel_single_t>();
+  category_layout layout(m_category_tp, categories.data(), stride);
   for (intptr_t i = 0; i < dim_size; ++i) {
-    char *src = const_cast<char *>(get_category_data_from_value((uint32_t)i));
-    fn(k.get(), categories.data() + i * stride, &src);
+    layout.copy(categories.data() + i * stride, get_category_data_from_value((uint32_t)i));
   }
   return categories;
 }
@@ -346,13 +583,24 @@ bool ndt::categorical_type::operator==(const base_type &rhs) const {
     return true;
   if (rhs.get_id() != categorical_id)
     return false;
-  if (!m_categories.equals_exact(static_cast<const categorical_type &>(rhs).m_categories))
+  const categorical_type &other = static_cast<const categorical_type &>(rhs);
+  if (m_category_tp != other.m_category_tp || get_category_count() != other.get_category_count())
     return false;
-  if (!m_category_index_to_value.equals_exact(static_cast<const categorical_type &>(rhs).m_category_index_to_value))
+  if (!m_category_index_to_value.equals_exact(other.m_category_index_to_value))
     return false;
-  if (!m_value_to_category_index.equals_exact(static_cast<const categorical_type &>(rhs).m_value_to_category_index))
+  if (!m_value_to_category_index.equals_exact(other.m_value_to_category_index))
     return false;
 
+  // Compare the categories directly, as not every category type has an
+  // equality callable (e.g. fixed_string)
+  category_layout layout(m_category_tp, m_categories.cdata(),
+                         reinterpret_cast<const fixed_dim_type_arrmeta *>(m_categories.get()->metadata())->stride);
+  intptr_t other_stride = reinterpret_cast<const fixed_dim_type_arrmeta *>(other.m_categories.get()->metadata())->stride;
+  for (size_t i = 0; i != get_category_count(); ++i) {
+    if (layout.compare(layout.at(i), other.m_categories.cdata() + i * other_stride) != 0)
+      return false;
+  }
+
   return true;
 }
 
@@ -385,21 +633,28 @@ ndt::type ndt::factor_categorical(const nd::array &values) {
   const char *el_arrmeta;
   values_eval.get_type().get_as_strided(values_eval.get()->metadata(), &dim_size, &stride, &el_tp, &el_arrmeta);
 
-  nd::kernel_builder k;
-  kernel_single_t fn = k.get()->get_function<kernel_single_t>();
-
-  cmp less(fn, k.get());
-  set<const char *, cmp> uniques(less);
+  check_indexable_category_type(el_tp);
 
+  // Hash the values to find the unique ones, so only those get sorted
+  category_layout layout(el_tp, values_eval.cdata(), stride);
+  std::vector<intptr_t> slots(category_hash_capacity(0), -1), uniques;
   for (intptr_t i = 0; i < dim_size; ++i) {
-    const char *data = values_eval.cdata() + i * stride;
-    if (uniques.find(data) == uniques.end()) {
-      uniques.insert(data);
+    category_key key;
+    layout.get_key(layout.at(i), key);
+    size_t pos = layout.find_slot(slots, key);
+    if (slots[pos] < 0) {
+      uniques.push_back(i);
+      if (2 * uniques.size() > slots.size()) {
+        layout.fill_slots(slots, 2 * slots.size(), uniques.data(), uniques.size());
+      } else {
+        slots[pos] = i;
+      }
     }
   }
+  std::sort(uniques.begin(), uniques.end(), category_layout::less{layout});
 
   // Copy the values (now sorted and unique) into a new nd::array
-  nd::array categories = make_sorted_categories(uniques, el_tp, el_arrmeta);
+  nd::array categories = make_sorted_categories(layout, uniques, el_tp);
 
   return make_type<categorical_type>(categories, true);
 }
@@ -414,6 +669,6 @@ std::map<std::string, std::pair<ndt::type, const char *>> ndt::categorical_type:
 
 ndt::type ndt::categorical_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin,
                                                  const char *DYND_UNUSED(end),
-                                                 std::map<std::string, ndt::type> &DYND_UNUSED(symtable)) {
+                                                 ndt::typevar_map &DYND_UNUSED(symtable)) {
   throw datashape::internal_parse_error(rbegin, "categorical type parsing isn't implemented");
 }
\ No newline at end of file
@@ -68,7 +68,7 @@ bool ndt::char_type::operator==(const base_type &rhs) const {
 
 // char_type : char | char[encoding]
 ndt::type ndt::char_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin, const char *end,
-                                          std::map<std::string, ndt::type> &DYND_UNUSED(symtable)) {
+                                          ndt::typevar_map &DYND_UNUSED(symtable)) {
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
     const char *saved_begin = begin;
@@ -81,7 +81,7 @@ size_t dynd::ndt::get_cuda_device_data_alignment(const ndt::type &tp) {
 // cuda_device_type : cuda_device[storage_type]
 ndt::type ndt::cuda_device_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin,
                                                  const char *DYND_UNUSED(end),
-                                                 std::map<std::string, ndt::type> &DYND_UNUSED(symtable)) {
+                                                 ndt::typevar_map &DYND_UNUSED(symtable)) {
 #ifdef DYND_CUDA
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
@@ -63,7 +63,7 @@ void ndt::cuda_host_type::data_free(char *DYND_UNUSED(data)) const {
 // cuda_host_type : cuda_host[storage_type]
 ndt::type ndt::cuda_host_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin,
                                                const char *DYND_UNUSED(end),
-                                               std::map<std::string, ndt::type> &DYND_UNUSED(symtable)) {
+                                               ndt::typevar_map &DYND_UNUSED(symtable)) {
 #ifdef DYND_CUDA
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
@@ -58,7 +58,7 @@ static bool parse_name_or_number(const char *&rbegin, const char *end, const cha
 
 // complex_type : complex[float_type]
 // This is called after 'complex' is already matched
-static ndt::type parse_complex_parameters(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static ndt::type parse_complex_parameters(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
     const char *saved_begin = begin;
@@ -86,7 +86,7 @@ static ndt::type parse_complex_parameters(const char *&rbegin, const char *end,
 
 // datashape_list : datashape COMMA datashape_list RBRACKET
 //                | datashape RBRACKET
-static nd::buffer parse_datashape_list(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static nd::buffer parse_datashape_list(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
 
   vector<ndt::type> dlist;
@@ -179,7 +179,7 @@ static nd::buffer parse_string_list(const char *&rbegin, const char *end) {
 //          | INTEGER
 //          | STRING
 //          | list_type_arg
-static nd::buffer parse_type_arg(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static nd::buffer parse_type_arg(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
 
   skip_whitespace_and_pound_comments(begin, end);
@@ -288,7 +288,7 @@ static nd::buffer move_concatenate_arg_buffers(vector<nd::buffer> &pos_args, con
 // type_kwarg : NAME_LOWER EQUAL type_arg
 // type_constr_args : LBRACKET type_arg_list RBRACKET
 nd::buffer datashape::parse_type_constr_args(const char *&rbegin, const char *end,
-                                             map<std::string, ndt::type> &symtable) {
+                                             ndt::typevar_map &symtable) {
   nd::buffer result;
 
   const char *begin = rbegin;
@@ -367,7 +367,7 @@ nd::buffer datashape::parse_type_constr_args(const char *&rbegin, const char *en
 }
 
 // record_item_bare : BARENAME COLON rhs_expression
-static bool parse_struct_item_bare(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable,
+static bool parse_struct_item_bare(const char *&rbegin, const char *end, ndt::typevar_map &symtable,
                                    std::string &out_field_name, ndt::type &out_field_type) {
   const char *begin = rbegin;
   const char *field_name_begin, *field_name_end;
@@ -394,7 +394,7 @@ static bool parse_struct_item_bare(const char *&rbegin, const char *end, map<std
 
 // struct_item_general : struct_item_bare |
 //                       QUOTEDNAME COLON rhs_expression
-static bool parse_struct_item_general(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable,
+static bool parse_struct_item_general(const char *&rbegin, const char *end, ndt::typevar_map &symtable,
                                       std::string &out_field_name, ndt::type &out_field_type) {
   const char *begin = rbegin;
   const char *field_name_begin, *field_name_end;
@@ -441,7 +441,7 @@ static bool parse_struct_item_general(const char *&rbegin, const char *end, map<
 }
 
 // struct : LBRACE record_item record_item* RBRACE
-static ndt::type parse_struct(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static ndt::type parse_struct(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   vector<std::string> field_name_list;
   vector<ndt::type> field_type_list;
@@ -491,7 +491,7 @@ static ndt::type parse_struct(const char *&rbegin, const char *end, map<std::str
 }
 
 // funcproto_kwds : record_item, record_item*
-static ndt::type parse_funcproto_kwds(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static ndt::type parse_funcproto_kwds(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   vector<std::string> field_name_list;
   vector<ndt::type> field_type_list;
@@ -535,7 +535,7 @@ static ndt::type parse_funcproto_kwds(const char *&rbegin, const char *end, map<
 
 // tuple : LPAREN tuple_item tuple_item* RPAREN
 // funcproto : tuple -> type
-static ndt::type parse_tuple_or_funcproto(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static ndt::type parse_tuple_or_funcproto(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   vector<ndt::type> field_type_list;
   bool variadic = false;
@@ -654,7 +654,7 @@ static ndt::type parse_tuple_or_funcproto(const char *&rbegin, const char *end,
 
 //    datashape_nooption : dim ASTERISK datashape
 //                       | dtype
-static ndt::type parse_datashape_nooption(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static ndt::type parse_datashape_nooption(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   ndt::type result;
   const char *begin = rbegin;
   skip_whitespace_and_pound_comments(begin, end);
@@ -829,7 +829,7 @@ static ndt::type parse_datashape_nooption(const char *&rbegin, const char *end,
 // This is what parses a single datashape as an ndt::type
 //    datashape : datashape_nooption
 //              | QUESTIONMARK datashape_nooption
-ndt::type datashape::parse(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+ndt::type datashape::parse(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   skip_whitespace_and_pound_comments(begin, end);
   if (parse_token_no_ws(begin, end, '?')) {
@@ -845,7 +845,7 @@ ndt::type datashape::parse(const char *&rbegin, const char *end, map<std::string
   }
 }
 
-static ndt::type parse_stmt(const char *&rbegin, const char *end, map<std::string, ndt::type> &symtable) {
+static ndt::type parse_stmt(const char *&rbegin, const char *end, ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   // stmt : TYPE name EQUALS rhs_expression
   // NOTE that this doesn't support parameterized lhs_expression, this is subset
@@ -899,7 +899,7 @@ static ndt::type parse_stmt(const char *&rbegin, const char *end, map<std::strin
 }
 
 // top : stmt stmt*
-static ndt::type parse_top(const char *&begin, const char *end, map<std::string, ndt::type> &symtable) {
+static ndt::type parse_top(const char *&begin, const char *end, ndt::typevar_map &symtable) {
   ndt::type result = parse_stmt(begin, end, symtable);
   if (result.is_null()) {
     throw datashape::internal_parse_error(begin, "expected a datashape statement");
@@ -954,7 +954,7 @@ static void get_error_line_column(const char *begin, const char *end, const char
 ndt::type dynd::type_from_datashape(const char *datashape_begin, const char *datashape_end) {
   try {
     // Symbol table for intermediate types declared in the datashape
-    map<std::string, ndt::type> symtable;
+    ndt::typevar_map symtable;
     // Parse the datashape and construct the type
     const char *begin = datashape_begin, *end = datashape_end;
     return parse_top(begin, end, symtable);
@@ -979,7 +979,7 @@ ndt::type dynd::type_from_datashape(const char *datashape_begin, const char *dat
 
 nd::buffer datashape::parse_type_constr_args(const std::string &str) {
   nd::buffer result;
-  std::map<std::string, ndt::type> symtable;
+  ndt::typevar_map symtable;
   if (!str.empty()) {
     const char *begin = &str[0], *end = &str[0] + str.size();
     try {
@@ -88,7 +88,7 @@ void ndt::ellipsis_dim_type::arrmeta_destruct(char *DYND_UNUSED(arrmeta)) const
   throw type_error("Cannot store data of ellipsis type");
 }
 
-bool ndt::ellipsis_dim_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::ellipsis_dim_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   // TODO XXX This is wrong, "Any" could represent a type that doesn't match
   // against this one...
   if (candidate_tp.get_id() == any_kind_id) {
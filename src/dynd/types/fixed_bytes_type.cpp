@@ -70,7 +70,7 @@ bool ndt::fixed_bytes_type::operator==(const base_type &rhs) const
 }
 
 ndt::type ndt::fixed_bytes_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin, const char *end,
-                                                 std::map<std::string, ndt::type> &DYND_UNUSED(symtable)) {
+                                                 ndt::typevar_map &DYND_UNUSED(symtable)) {
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
     std::string size_val = datashape::parse_number(begin, end);
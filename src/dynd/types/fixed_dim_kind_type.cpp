@@ -144,7 +144,7 @@ void ndt::fixed_dim_kind_type::data_destruct_strided(const char *DYND_UNUSED(arr
   throw runtime_error(ss.str());
 }
 
-bool ndt::fixed_dim_kind_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::fixed_dim_kind_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   switch (candidate_tp.get_id()) {
   case fixed_dim_kind_id:
     return m_element_tp.match(candidate_tp.extended<base_dim_type>()->get_element_type(), tp_vars);
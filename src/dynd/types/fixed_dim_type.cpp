@@ -508,7 +508,7 @@ void ndt::fixed_dim_type::reorder_default_constructed_strides(char *dst_arrmeta,
   }
 }
 
-bool ndt::fixed_dim_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::fixed_dim_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   switch (candidate_tp.get_id()) {
   case fixed_dim_id:
     return m_dim_size == candidate_tp.extended<fixed_dim_type>()->m_dim_size &&
@@ -536,7 +536,7 @@ ndt::type ndt::make_fixed_dim(size_t dim_size, const type &element_tp) {
 
 // fixed_type : fixed[N] * rhs_expression
 ndt::type ndt::fixed_dim_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin, const char *end,
-                                               std::map<std::string, ndt::type> &symtable) {
+                                               ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
     const char *saved_begin = begin;
@@ -94,6 +94,6 @@ void ndt::fixed_string_kind_type::data_destruct_strided(const char *DYND_UNUSED(
 }
 
 bool ndt::fixed_string_kind_type::match(const type &candidate_tp,
-                                        std::map<std::string, type> &DYND_UNUSED(tp_vars)) const {
+                                        typevar_map &DYND_UNUSED(tp_vars)) const {
   return candidate_tp.get_id() == fixed_string_kind_id || candidate_tp.get_id() == fixed_string_id;
 }
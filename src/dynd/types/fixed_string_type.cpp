@@ -60,9 +60,14 @@ void ndt::fixed_string_type::set_from_utf8_string(const char *DYND_UNUSED(arrmet
   char *dst_end = dst + get_data_size();
   next_unicode_codepoint_t next_fn = get_next_unicode_codepoint_function(string_encoding_utf_8, errmode);
   append_unicode_codepoint_t append_fn = get_append_unicode_codepoint_function(m_encoding, errmode);
+  transcode_run_t run_fn = get_transcode_run_function(m_encoding, string_encoding_utf_8);
   uint32_t cp;
 
   while (utf8_begin < utf8_end && dst < dst_end) {
+    run_fn(utf8_begin, utf8_end, dst, dst_end);
+    if (utf8_begin == utf8_end || dst == dst_end) {
+      break;
+    }
     cp = next_fn(utf8_begin, utf8_end);
     append_fn(cp, dst, dst_end);
   }
@@ -142,7 +147,7 @@ std::map<std::string, std::pair<ndt::type, const char *>> ndt::fixed_string_type
 // fixed_string_type : fixed_string[NUMBER] |
 //                     fixed_string[NUMBER,'encoding']
 ndt::type ndt::fixed_string_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin, const char *end,
-                                                  std::map<std::string, ndt::type> &DYND_UNUSED(symtable)) {
+                                                  ndt::typevar_map &DYND_UNUSED(symtable)) {
   const char *begin = rbegin;
   if (datashape::parse_token(begin, end, '[')) {
     const char *saved_begin = begin;
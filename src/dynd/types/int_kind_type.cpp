@@ -8,7 +8,7 @@
 using namespace std;
 using namespace dynd;
 
-bool ndt::int_kind_type::match(const type &candidate_tp, std::map<std::string, type> &DYND_UNUSED(tp_vars)) const {
+bool ndt::int_kind_type::match(const type &candidate_tp, typevar_map &DYND_UNUSED(tp_vars)) const {
   return candidate_tp.get_base_id() == int_kind_id;
 }
 
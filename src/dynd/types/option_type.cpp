@@ -197,7 +197,7 @@ void ndt::option_type::data_destruct_strided(const char *arrmeta, char *data, in
   m_value_tp.extended()->data_destruct_strided(arrmeta, data, stride, count);
 }
 
-bool ndt::option_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::option_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.get_id() != option_id) {
     return false;
   }
@@ -213,7 +213,7 @@ std::map<std::string, std::pair<ndt::type, const char *>> ndt::option_type::get_
 }
 
 ndt::type ndt::option_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin, const char *end,
-                                            std::map<std::string, ndt::type> &symtable) {
+                                            ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   if (!datashape::parse_token(begin, end, '[')) {
     throw datashape::internal_parse_error(begin, "expected opening '[' after 'option'");
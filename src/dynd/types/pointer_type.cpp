@@ -225,7 +225,7 @@ void ndt::pointer_type::arrmeta_debug_print(const char *arrmeta, std::ostream &o
   }
 }
 
-bool ndt::pointer_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::pointer_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   return candidate_tp.get_id() == pointer_id &&
          m_target_tp.match(candidate_tp.extended<pointer_type>()->m_target_tp, tp_vars);
 }
@@ -238,7 +238,7 @@ std::map<std::string, std::pair<ndt::type, const char *>> ndt::pointer_type::get
 }
 
 ndt::type ndt::pointer_type::parse_type_args(type_id_t DYND_UNUSED(id), const char *&rbegin, const char *end,
-                                             std::map<std::string, ndt::type> &symtable) {
+                                             ndt::typevar_map &symtable) {
   const char *begin = rbegin;
   if (!datashape::parse_token(begin, end, '[')) {
     throw datashape::internal_parse_error(begin, "expected opening '[' after 'pointer'");
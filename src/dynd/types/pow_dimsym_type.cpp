@@ -96,7 +96,7 @@ void ndt::pow_dimsym_type::arrmeta_destruct(char *DYND_UNUSED(arrmeta)) const {
   throw type_error("Cannot store data of typevar type");
 }
 
-bool ndt::pow_dimsym_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::pow_dimsym_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.get_id() == typevar_constructed_id) {
     return candidate_tp.extended<typevar_constructed_type>()->match(type(this, true), tp_vars);
   }
@@ -13,7 +13,7 @@ bool ndt::scalar_kind_type::operator==(const base_type &other) const
   return this == &other || other.get_id() == scalar_kind_id;
 }
 
-bool ndt::scalar_kind_type::match(const type &candidate_tp, std::map<std::string, type> &DYND_UNUSED(tp_vars)) const
+bool ndt::scalar_kind_type::match(const type &candidate_tp, typevar_map &DYND_UNUSED(tp_vars)) const
 {
   // Match against any scalar
   return candidate_tp.is_scalar();
@@ -30,6 +30,7 @@ void ndt::string_type::set_from_utf8_string(const char *DYND_UNUSED(arrmeta), ch
   char *dst_current;
   next_unicode_codepoint_t next_fn = get_next_unicode_codepoint_function(string_encoding_utf_8, errmode);
   append_unicode_codepoint_t append_fn = get_append_unicode_codepoint_function(string_encoding_utf_8, errmode);
+  transcode_run_t run_fn = get_transcode_run_function(string_encoding_utf_8, string_encoding_utf_8);
   uint32_t cp;
 
   // Allocate the initial output as the src number of characters + some padding
@@ -41,6 +42,10 @@ void ndt::string_type::set_from_utf8_string(const char *DYND_UNUSED(arrmeta), ch
 
   dst_current = dst_begin;
   while (utf8_begin < utf8_end) {
+    run_fn(utf8_begin, utf8_end, dst_current, dst_end);
+    if (utf8_begin == utf8_end) {
+      break;
+    }
     cp = next_fn(utf8_begin, utf8_end);
     // Append the codepoint, or increase the allocated memory as necessary
     if (dst_end - dst_current >= 8) {
@@ -287,7 +287,7 @@ std::map<std::string, std::pair<ndt::type, const char *>> ndt::struct_type::get_
   return properties;
 }
 
-bool ndt::struct_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::struct_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.get_id() != struct_id) {
     return false;
   }
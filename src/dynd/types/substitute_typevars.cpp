@@ -26,7 +26,7 @@ using namespace dynd;
  * Substitutes the field types for contiguous array of types
  */
 static std::vector<ndt::type> substitute_type_array(const std::vector<ndt::type> &type_array,
-                                                    const std::map<std::string, ndt::type> &typevars, bool concrete) {
+                                                    const ndt::typevar_map &typevars, bool concrete) {
   intptr_t field_count = type_array.size();
   std::vector<ndt::type> tmp_field_types(field_count);
 
@@ -39,7 +39,7 @@ static std::vector<ndt::type> substitute_type_array(const std::vector<ndt::type>
 // This substitutes just the types supported by the datashape argument grammar
 static void internal_substitute_args(const ndt::type &tp, const char *out_arrmeta, char *out_data,
                                      const char *in_arrmeta, const char *in_data,
-                                     const std::map<std::string, ndt::type> &typevars, bool concrete) {
+                                     const ndt::typevar_map &typevars, bool concrete) {
   switch (tp.get_id()) {
   case int64_id:
     *reinterpret_cast<int64_t *>(out_data) = *reinterpret_cast<const int64_t *>(in_data);
@@ -95,7 +95,7 @@ static void internal_substitute_args(const ndt::type &tp, const char *out_arrmet
   }
 }
 
-static nd::buffer internal_substitute_args(const nd::buffer &args, const std::map<std::string, ndt::type> &typevars,
+static nd::buffer internal_substitute_args(const nd::buffer &args, const ndt::typevar_map &typevars,
                                            bool concrete) {
   nd::buffer result = nd::buffer::empty(args.get_type());
   internal_substitute_args(args.get_type(), result->metadata(), result.data(), args->metadata(), args.cdata(), typevars,
@@ -103,7 +103,7 @@ static nd::buffer internal_substitute_args(const nd::buffer &args, const std::ma
   return result;
 }
 
-ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const std::map<std::string, ndt::type> &typevars,
+ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const ndt::typevar_map &typevars,
                                            bool concrete) {
   // This function assumes that ``pattern`` is symbolic, so does not
   // have to check types that are always concrete
@@ -145,7 +145,7 @@ ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const std::
     return ndt::make_type<ndt::option_type>(
         ndt::substitute(pattern.extended<option_type>()->get_value_type(), typevars, concrete));
   case typevar_constructed_id: {
-    map<std::string, ndt::type>::const_iterator it =
+    ndt::typevar_map::const_iterator it =
         typevars.find(pattern.extended<typevar_constructed_type>()->get_name());
     if (it->second.get_id() == void_id) {
       return substitute(pattern.extended<typevar_constructed_type>()->get_arg(), typevars, concrete);
@@ -158,7 +158,7 @@ ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const std::
 #endif
   }
   case typevar_id: {
-    map<std::string, ndt::type>::const_iterator it = typevars.find(pattern.extended<typevar_type>()->get_name());
+    ndt::typevar_map::const_iterator it = typevars.find(pattern.extended<typevar_type>()->get_name());
     if (it != typevars.end()) {
       if (it->second.get_ndim() != 0) {
         stringstream ss;
@@ -184,7 +184,7 @@ ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const std::
     }
   }
   case typevar_dim_id: {
-    map<std::string, ndt::type>::const_iterator it = typevars.find(pattern.extended<typevar_dim_type>()->get_name());
+    ndt::typevar_map::const_iterator it = typevars.find(pattern.extended<typevar_dim_type>()->get_name());
     if (it != typevars.end()) {
       if (it->second.get_ndim() == 0) {
         stringstream ss;
@@ -231,7 +231,7 @@ ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const std::
   case pow_dimsym_id: {
     // Look up to the exponent typevar
     std::string exponent_name = pattern.extended<pow_dimsym_type>()->get_exponent();
-    map<std::string, ndt::type>::const_iterator tv_type = typevars.find(exponent_name);
+    ndt::typevar_map::const_iterator tv_type = typevars.find(exponent_name);
     intptr_t exponent = -1;
     if (tv_type != typevars.end()) {
       if (tv_type->second.get_id() == fixed_dim_id) {
@@ -259,7 +259,7 @@ ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const std::
     // Get the base type
     ndt::type base_tp = pattern.extended<pow_dimsym_type>()->get_base_type();
     if (base_tp.get_id() == typevar_dim_id) {
-      map<std::string, ndt::type>::const_iterator btv_type =
+      ndt::typevar_map::const_iterator btv_type =
           typevars.find(base_tp.extended<typevar_dim_type>()->get_name());
       if (btv_type == typevars.end()) {
         // We haven't seen this typevar yet, check if concrete
@@ -328,7 +328,7 @@ ndt::type ndt::detail::internal_substitute(const ndt::type &pattern, const std::
   case ellipsis_dim_id: {
     const std::string &name = pattern.extended<ellipsis_dim_type>()->get_name();
     if (!name.empty()) {
-      map<std::string, ndt::type>::const_iterator it = typevars.find(pattern.extended<typevar_dim_type>()->get_name());
+      ndt::typevar_map::const_iterator it = typevars.find(pattern.extended<typevar_dim_type>()->get_name());
       if (it != typevars.end()) {
         if (it->second.get_id() == dim_fragment_id) {
           return it->second.extended<dim_fragment_type>()->apply_to_dtype(
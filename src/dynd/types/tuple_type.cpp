@@ -387,7 +387,7 @@ void ndt::tuple_type::arrmeta_debug_print(const char *arrmeta, std::ostream &o,
   }
 }
 
-bool ndt::tuple_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::tuple_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.get_id() != tuple_id) {
     return false;
   }
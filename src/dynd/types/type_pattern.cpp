@@ -0,0 +1,126 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <dynd/types/fixed_dim_type.hpp>
+#include <dynd/types/option_type.hpp>
+#include <dynd/types/type_pattern.hpp>
+
+using namespace std;
+using namespace dynd;
+
+ndt::type_pattern::type_pattern(const type &tp) : m_tp(tp) {
+  // Each of the compiled checks has a single child pattern, so the program
+  // is a straight line that ends with the first instruction that decides
+  const type *child_tp = &m_tp;
+  for (;;) {
+    switch (child_tp->get_id()) {
+    case any_kind_id:
+      m_program.emplace_back(op_any, 0, *child_tp);
+      return;
+    case scalar_kind_id:
+      m_program.emplace_back(op_scalar, 0, *child_tp);
+      return;
+    case bool_kind_id:
+    case int_kind_id:
+    case uint_kind_id:
+    case float_kind_id:
+    case complex_kind_id:
+      m_program.emplace_back(op_base_id, child_tp->get_id(), *child_tp);
+      return;
+    case dim_kind_id:
+      m_program.emplace_back(op_dim, 0, *child_tp);
+      break;
+    case fixed_dim_id:
+      m_program.emplace_back(op_fixed_dim, child_tp->extended<fixed_dim_type>()->get_fixed_dim_size(), *child_tp);
+      break;
+    case fixed_dim_kind_id:
+      m_program.emplace_back(op_fixed_dim_kind, 0, *child_tp);
+      break;
+    case var_dim_id:
+      m_program.emplace_back(op_var_dim, 0, *child_tp);
+      break;
+    case option_id:
+      if (!child_tp->is_expression()) {
+        m_program.emplace_back(op_option, 0, *child_tp);
+        child_tp = &child_tp->extended<option_type>()->get_value_type();
+        continue;
+      }
+    // Fall through
+    default:
+      m_program.emplace_back(op_match, 0, *child_tp);
+      return;
+    }
+
+    child_tp = &child_tp->extended<base_dim_type>()->get_element_type();
+  }
+}
+
+bool ndt::type_pattern::match(const type &candidate_tp) const {
+  // None of the compiled checks binds a typevar, so the remaining pattern of
+  // an op_match starts from an empty typevar map, as it does in type::match
+  const type *tp = &candidate_tp;
+  type dim_element_tp;
+  for (const instruction &instr : m_program) {
+    if (instr.tp.extended() == tp->extended()) {
+      return true;
+    }
+
+    switch (instr.op) {
+    case op_match:
+      return instr.tp.match(*tp);
+    case op_any:
+      return true;
+    case op_scalar:
+      return tp->is_scalar();
+    case op_base_id:
+      return tp->get_base_id() == instr.arg;
+    case op_dim:
+      switch (tp->get_id()) {
+      case fixed_dim_id:
+      case var_dim_id:
+        tp = &tp->extended<base_dim_type>()->get_element_type();
+        break;
+      default:
+        if (tp->get_ndim() == 0) {
+          return false;
+        }
+        dim_element_tp = tp->get_type_at_dimension(NULL, 1);
+        tp = &dim_element_tp;
+        break;
+      }
+      break;
+    case op_fixed_dim:
+      if (tp->get_id() != fixed_dim_id || tp->extended<fixed_dim_type>()->get_fixed_dim_size() != instr.arg) {
+        return false;
+      }
+      tp = &tp->extended<base_dim_type>()->get_element_type();
+      break;
+    case op_fixed_dim_kind:
+      if (tp->get_id() != fixed_dim_id && tp->get_id() != fixed_dim_kind_id) {
+        return false;
+      }
+      tp = &tp->extended<base_dim_type>()->get_element_type();
+      break;
+    case op_var_dim:
+      if (tp->get_id() != var_dim_id) {
+        return false;
+      }
+      tp = &tp->extended<base_dim_type>()->get_element_type();
+      break;
+    case op_option:
+      if (tp->get_id() != option_id) {
+        return false;
+      }
+      if (tp->is_expression()) {
+        return instr.tp.match(*tp);
+      }
+      tp = &tp->extended<option_type>()->get_value_type();
+      break;
+    }
+  }
+
+  // Only a default constructed pattern has an empty program
+  return m_tp.match(candidate_tp);
+}
@@ -85,7 +85,7 @@ void ndt::typevar_constructed_type::arrmeta_destruct(char *DYND_UNUSED(arrmeta))
   throw type_error("Cannot store data of typevar_constructed type");
 }
 
-bool ndt::typevar_constructed_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::typevar_constructed_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.get_id() == typevar_constructed_id) {
     return m_arg.match(candidate_tp.extended<typevar_constructed_type>()->m_arg, tp_vars);
   }
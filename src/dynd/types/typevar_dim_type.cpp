@@ -82,7 +82,7 @@ void ndt::typevar_dim_type::arrmeta_destruct(char *DYND_UNUSED(arrmeta)) const {
   throw type_error("Cannot store data of typevar type");
 }
 
-bool ndt::typevar_dim_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::typevar_dim_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   if (candidate_tp.is_scalar()) {
     return false;
   }
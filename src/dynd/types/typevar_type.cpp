@@ -73,7 +73,7 @@ void ndt::typevar_type::arrmeta_destruct(char *DYND_UNUSED(arrmeta)) const {
   throw type_error("Cannot store data of typevar type");
 }
 
-bool ndt::typevar_type::match(const type &candidate_tp, std::map<std::string, type> &tp_vars) const {
+bool ndt::typevar_type::match(const type &candidate_tp, typevar_map &tp_vars) const {
   // TODO: This implementation is mostly wrong in the case of symbolic to symbolic type matches
   if (candidate_tp.get_ndim() > 0 || candidate_tp.get_id() == any_kind_id) {
     return false;
@@ -8,6 +8,7 @@
 #include <cmath>
 
 #include <dynd/config.hpp>
+#include <dynd/exceptions.hpp>
 
 #if !defined(DYND_HAS_UINT128)
 
@@ -117,6 +118,54 @@ void dynd::uint128::divrem(uint32_t rhs, uint32_t& out_rem)
     m_lo = (mid_div << 32) | low_div;
 }
 
+void dynd::uint128::throw_zero_division() { throw zero_division_error("Integer division or modulo by zero."); }
+
+uint128 dynd::uint128::multiply(const uint128& rhs) const
+{
+    // The full product of the low words from 32-bit halves, plus the cross
+    // products that land in the high word
+    uint64_t a0 = m_lo & 0x00000000ffffffffULL, a1 = m_lo >> 32;
+    uint64_t b0 = rhs.m_lo & 0x00000000ffffffffULL, b1 = rhs.m_lo >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0x00000000ffffffffULL) + (p10 & 0x00000000ffffffffULL);
+    uint64_t lo = (mid << 32) | (p00 & 0x00000000ffffffffULL);
+    uint64_t hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    hi += m_hi * rhs.m_lo + m_lo * rhs.m_hi;
+    return uint128(hi, lo);
+}
+
+void dynd::uint128::divrem(const uint128& rhs, uint128& out_quotient, uint128& out_remainder) const
+{
+    if (!rhs) {
+        throw_zero_division();
+    }
+    if (rhs.m_hi == 0 && rhs.m_lo <= 0xffffffffULL) {
+        uint32_t rem;
+        out_quotient = *this;
+        out_quotient.divrem(static_cast<uint32_t>(rhs.m_lo), rem);
+        out_remainder = uint128(0ULL, rem);
+        return;
+    }
+
+    // Restoring shift-subtract division, one quotient bit at a time
+    uint128 quotient(0ULL, 0ULL), remainder(0ULL, 0ULL);
+    for (int i = 127; i >= 0; --i) {
+        remainder = remainder << 1;
+        uint64_t bit = (i >= 64) ? (m_hi >> (i - 64)) & 1 : (m_lo >> i) & 1;
+        remainder.m_lo |= bit;
+        if (remainder >= rhs) {
+            remainder = remainder - rhs;
+            if (i >= 64) {
+                quotient.m_hi |= 1ULL << (i - 64);
+            } else {
+                quotient.m_lo |= 1ULL << i;
+            }
+        }
+    }
+    out_quotient = quotient;
+    out_remainder = remainder;
+}
+
 std::ostream& dynd::operator<<(ostream& out, const uint128& val)
 {
     if (val == uint128(0ULL)) {
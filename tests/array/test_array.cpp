@@ -661,6 +661,42 @@ TEST(Array, ConstructAssign) {
   EXPECT_EQ(4, v2[4].value());
 }
 
+TEST(Array, BufferPoolReuse) {
+  // Warm up the pool for this size class
+  nd::empty(64, ndt::make_type<double>());
+
+  nd::buffer_pool_stats before = nd::get_buffer_pool_stats();
+  for (int i = 0; i < 10; ++i) {
+    nd::array a = nd::empty(64, ndt::make_type<double>());
+    EXPECT_EQ(64, a.get_dim_size());
+  }
+  nd::buffer_pool_stats after = nd::get_buffer_pool_stats();
+  EXPECT_EQ(before.hits + 10, after.hits);
+  EXPECT_EQ(before.misses, after.misses);
+
+  // Arrays too large for the pools have aligned data
+  nd::array a = nd::empty(100000, ndt::make_type<double>());
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(a.cdata()) % DYND_BUFFER_LARGE_ALIGNMENT);
+  EXPECT_EQ(after.large + 1, nd::get_buffer_pool_stats().large);
+}
+
+TEST(Array, LargeBufferDataAlignment) {
+  // The data of large arrays is aligned whatever the size of the arrmeta
+  // in front of it
+  nd::array a = nd::empty(1000, 100, ndt::make_type<double>());
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(a.cdata()) % DYND_BUFFER_LARGE_ALIGNMENT);
+  a = nd::empty(10, 100, 100, ndt::make_type<int32_t>());
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(a.cdata()) % DYND_BUFFER_LARGE_ALIGNMENT);
+  a = nd::empty(ndt::type("20 * 30 * 40 * 5 * int8"));
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(a.cdata()) % DYND_BUFFER_LARGE_ALIGNMENT);
+  a = nd::empty(3, 100000, ndt::make_type<uint8_t>());
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(a.cdata()) % DYND_BUFFER_LARGE_ALIGNMENT);
+
+  // The whole data is usable
+  a.assign(7);
+  EXPECT_EQ(7, a(2, 99999).as<int>());
+}
+
 REGISTER_TYPED_TEST_CASE_P(Array, ScalarConstructor, OneDimConstructor, TwoDimConstructor, ThreeDimConstructor,
                            AsScalar);
 
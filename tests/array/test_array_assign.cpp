@@ -596,6 +596,53 @@ TEST(ArrayAssign, ArrayValsAtType) {
   }
 }
 
+TEST(ArrayAssign, ContiguousStreamingAssign) {
+  // Lower the threshold so the non-temporal stores are used
+  set_nontemporal_store_threshold(1024);
+
+  nd::array a = nd::empty(10000, ndt::make_type<int32_t>());
+  int32_t *a_data = reinterpret_cast<int32_t *>(a.data());
+  for (int32_t i = 0; i < 10000; ++i) {
+    a_data[i] = i * 3 - 5000;
+  }
+
+  nd::array b = nd::empty(10000, ndt::make_type<double>());
+  b.assign(a);
+  nd::array c = nd::empty(10000, ndt::make_type<int32_t>());
+  c.assign(a);
+  set_nontemporal_store_threshold(0);
+
+  const double *b_data = reinterpret_cast<const double *>(b.cdata());
+  const int32_t *c_data = reinterpret_cast<const int32_t *>(c.cdata());
+  for (int32_t i = 0; i < 10000; ++i) {
+    ASSERT_EQ(i * 3 - 5000, b_data[i]);
+    ASSERT_EQ(i * 3 - 5000, c_data[i]);
+  }
+}
+
+TEST(ArrayAssign, WideStridedAssign) {
+  // Each element of the column is on its own cache line
+  nd::array a = nd::empty(1000, 16, ndt::make_type<int64_t>());
+  int64_t *a_data = reinterpret_cast<int64_t *>(a.data());
+  for (int64_t i = 0; i < 1000 * 16; ++i) {
+    a_data[i] = i;
+  }
+
+  nd::array b = nd::empty(1000, ndt::make_type<double>());
+  b.assign(a(irange(), 3));
+  const double *b_data = reinterpret_cast<const double *>(b.cdata());
+  for (int64_t i = 0; i < 1000; ++i) {
+    ASSERT_EQ(i * 16 + 3, b_data[i]);
+  }
+
+  nd::array c = nd::empty(1000, ndt::make_type<int64_t>());
+  c.assign(a(irange().by(-1), 15));
+  const int64_t *c_data = reinterpret_cast<const int64_t *>(c.cdata());
+  for (int64_t i = 0; i < 1000; ++i) {
+    ASSERT_EQ((999 - i) * 16 + 15, c_data[i]);
+  }
+}
+
 #if !(defined(_WIN32) && !defined(_M_X64)) // TODO: How to mark as expected failures in googletest?
 REGISTER_TYPED_TEST_CASE_P(ArrayAssign, ScalarAssignment_Bool, ScalarAssignment_Int8, ScalarAssignment_UInt16,
                            ScalarAssignment_Float32, ScalarAssignment_Float64, ScalarAssignment_Uint64,
@@ -4,8 +4,10 @@
 //
 
 #include <algorithm>
+#include <clocale>
 #include <cmath>
 #include <iostream>
+#include <sstream>
 #include <stdexcept>
 
 #include <dynd/gtest.hpp>
@@ -48,12 +50,135 @@ TEST(JSONFormatter, Builtins) {
   EXPECT_EQ("null", format_json(a).as<std::string>());
 }
 
+TEST(JSONFormatter, IntegerLimits) {
+  nd::array a;
+  a = (int8_t)-128;
+  EXPECT_EQ("-128", format_json(a).as<std::string>());
+  a = (int32_t)0;
+  EXPECT_EQ("0", format_json(a).as<std::string>());
+  a = std::numeric_limits<int64_t>::min();
+  EXPECT_EQ("-9223372036854775808", format_json(a).as<std::string>());
+  a = std::numeric_limits<int64_t>::max();
+  EXPECT_EQ("9223372036854775807", format_json(a).as<std::string>());
+  a = std::numeric_limits<uint64_t>::max();
+  EXPECT_EQ("18446744073709551615", format_json(a).as<std::string>());
+}
+
+TEST(JSONFormatter, FloatRoundTrip) {
+  nd::array a;
+  a = 0.1;
+  EXPECT_EQ("0.1", format_json(a).as<std::string>());
+  a = 0.1f;
+  EXPECT_EQ("0.1", format_json(a).as<std::string>());
+  a = 1234567.0;
+  EXPECT_EQ("1234567", format_json(a).as<std::string>());
+  a = 1e100;
+  EXPECT_EQ("1e+100", format_json(a).as<std::string>());
+
+  // Values which need more than digits10 digits still parse back exactly
+  double dvals[] = {1.0 / 3.0, 0.1 + 0.2, 5e-324, std::numeric_limits<double>::max()};
+  for (double d : dvals) {
+    a = d;
+    EXPECT_EQ(d, strtod(format_json(a).as<std::string>().c_str(), NULL));
+  }
+  a = 0.1 + 0.2;
+  EXPECT_EQ("0.30000000000000004", format_json(a).as<std::string>());
+  float fvals[] = {1.0f / 3.0f, 16777217.0f, 1e-45f, std::numeric_limits<float>::max()};
+  for (float f : fvals) {
+    a = f;
+    EXPECT_EQ(f, strtof(format_json(a).as<std::string>().c_str(), NULL));
+  }
+}
+
+TEST(JSONFormatter, FloatShortest) {
+  nd::array a;
+  a = -2.5;
+  EXPECT_EQ("-2.5", format_json(a).as<std::string>());
+  a = -0.0;
+  EXPECT_EQ("-0", format_json(a).as<std::string>());
+  a = 1e-5;
+  EXPECT_EQ("1e-05", format_json(a).as<std::string>());
+  a = 1234567890123456.0;
+  EXPECT_EQ("1234567890123456", format_json(a).as<std::string>());
+  // Subnormals have fewer than digits10 significant digits
+  a = 5e-324;
+  EXPECT_EQ("5e-324", format_json(a).as<std::string>());
+  a = 1e-45f;
+  EXPECT_EQ("1e-45", format_json(a).as<std::string>());
+  // Below a power of two the gap to the next smaller value is half as wide,
+  // so 16 digits suffice where rounding to 16 digits does not parse back
+  a = std::ldexp(1.0, -44);
+  EXPECT_EQ("5.684341886080802e-14", format_json(a).as<std::string>());
+
+  // Covers both the Grisu3 digits and the values it hands to snprintf
+  for (int i = 1; i < 20000; ++i) {
+    double d = i * 1.37e-3 / 7.0;
+    a = d;
+    EXPECT_EQ(d, strtod(format_json(a).as<std::string>().c_str(), NULL));
+    float f = static_cast<float>(d);
+    a = f;
+    EXPECT_EQ(f, strtof(format_json(a).as<std::string>().c_str(), NULL));
+  }
+}
+
+TEST(JSONFormatter, FloatLocale) {
+  // JSON numbers always use '.', whatever decimal point the C locale has
+  std::string saved = setlocale(LC_NUMERIC, NULL);
+  const char *locales[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "de_DE", "fr_FR"};
+  const char *comma_locale = NULL;
+  for (const char *name : locales) {
+    if (setlocale(LC_NUMERIC, name) != NULL) {
+      comma_locale = name;
+      break;
+    }
+  }
+  if (comma_locale == NULL) {
+    // No locale with a decimal comma is installed
+    return;
+  }
+
+  nd::array a;
+  a = 0.5;
+  EXPECT_EQ("0.5", format_json(a).as<std::string>());
+  a = 1.0 / 3.0;
+  EXPECT_EQ("0.3333333333333333", format_json(a).as<std::string>());
+  a = 0.1f;
+  EXPECT_EQ("0.1", format_json(a).as<std::string>());
+  a = 1e100;
+  EXPECT_EQ("1e+100", format_json(a).as<std::string>());
+
+  // Numbers which need strtod parse with the '.' as well
+  EXPECT_EQ(1.0 / 3.0, parse_json("float64", "0.3333333333333333").as<double>());
+  EXPECT_EQ(0.1f, parse_json("float32", "0.1").as<float>());
+
+  setlocale(LC_NUMERIC, saved.c_str());
+}
+
+TEST(JSONFormatter, Stream) {
+  nd::array a = nd::empty(20000, ndt::make_type<double>());
+  for (int i = 0; i < 20000; ++i) {
+    a(i).vals() = i / 8.0;
+  }
+
+  // Large enough to be flushed to the stream in several blocks
+  std::ostringstream ss;
+  format_json(ss, a);
+  EXPECT_EQ(format_json(a).as<std::string>(), ss.str());
+  EXPECT_EQ("[0,0.125,0.25,", ss.str().substr(0, 14));
+}
+
 TEST(JSONFormatter, String) {
   nd::array a;
   a = "testing string";
   EXPECT_EQ("\"testing string\"", format_json(a).as<std::string>());
   a = " \" \\ / \b \f \n \r \t ";
   EXPECT_EQ("\" \\\" \\\\ \\/ \\b \\f \\n \\r \\t \"", format_json(a).as<std::string>());
+  // Escapes inside and after long runs of plain characters
+  a = "a long run of plain characters \"quoted\" then a/slash and a\ttab at the end\n";
+  EXPECT_EQ("\"a long run of plain characters \\\"quoted\\\" then a\\/slash and a\\ttab at the end\\n\"",
+            format_json(a).as<std::string>());
+  a = "sixteen chars ok\x01 and non-ASCII \xc3\xa9t\xc3\xa9 \x7f";
+  EXPECT_EQ("\"sixteen chars ok\\u0001 and non-ASCII \xc3\xa9t\xc3\xa9 \\u007f\"", format_json(a).as<std::string>());
 }
 
 TEST(JSONFormatter, UniformDim) {
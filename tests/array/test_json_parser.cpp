@@ -298,3 +298,49 @@ TEST(JSON, DiscoverObject)
   EXPECT_EQ(ndt::type("{x: float64, y: 3 * int64}"), ndt::json::discover("{\"x\": 3.14, \"y\": [1, 2, 3]}"));
 }
 */
+
+TEST(Parse, UInt64Digits)
+{
+  // Long enough to use the eight digit blocks, with and without a tail
+  EXPECT_EQ(12345678ULL, parse<uint64_t>(std::string("12345678")));
+  EXPECT_EQ(1234567890123456ULL, parse<uint64_t>(std::string("1234567890123456")));
+  EXPECT_EQ(1234567890123456789ULL, parse<uint64_t>(std::string("1234567890123456789")));
+  EXPECT_EQ(12345678901234567890ULL, parse<uint64_t>(std::string("12345678901234567890")));
+  EXPECT_EQ(numeric_limits<uint64_t>::max(), parse<uint64_t>(to_string(numeric_limits<uint64_t>::max())));
+  EXPECT_EQ(98765432ULL, parse<uint64_t>(std::string("0000000098765432")));
+  EXPECT_EQ(1234567890123456ULL, parse<uint64_t>(std::string("1234567890123456"), nocheck));
+
+  EXPECT_THROW(parse<uint64_t>(std::string("18446744073709551616")), out_of_range);
+  EXPECT_THROW(parse<uint32_t>(std::string("10000000000")), out_of_range);
+  EXPECT_THROW(parse<uint64_t>(std::string("12345678x1234567")), invalid_argument);
+  EXPECT_EQ(1200000000ULL, parse<uint64_t>(std::string("12e8")));
+}
+
+TEST(Parse, ExactFloat)
+{
+  const char *strings[] = {"0", "-0", "1", "-1.5", "3.14159", "0.1", "0.3", "123456.789", "1e10", "2.5e-3",
+                           "9007199254740992", "9007199254740993", "1e22", "1e23", "4.35", "0.000001",
+                           ".5", "5.", "+7.25", "1.7976931348623157e308", "4.9e-324", "12345678901234567890"};
+  for (const char *s : strings) {
+    EXPECT_EQ(strtod(s, NULL), parse<double>(std::string(s))) << s;
+    EXPECT_EQ(strtod(s, NULL), parse<double>(std::string(s), nocheck)) << s;
+    EXPECT_EQ(strtof(s, NULL), parse<float>(std::string(s))) << s;
+  }
+
+  // The range may be followed by more characters, which must not be read
+  const char *text = "2.5,7";
+  EXPECT_EQ(2.5, parse<double>(text, text + 3));
+  const char *digits = "25e17";
+  EXPECT_EQ(2.0, parse<double>(digits, digits + 1));
+
+  EXPECT_THROW(parse<double>(std::string("1.5x")), invalid_argument);
+  EXPECT_THROW(parse<double>(std::string("1e")), invalid_argument);
+}
+
+TEST(JSONParse, Float)
+{
+  EXPECT_ARRAY_EQ(1.5f, nd::json::parse(ndt::make_type<float>(), "1.5"));
+  EXPECT_ARRAY_EQ(-0.1, nd::json::parse(ndt::make_type<double>(), "-0.1"));
+  EXPECT_ARRAY_EQ(2.5e-3, nd::json::parse(ndt::make_type<double>(), "2.5e-3"));
+  EXPECT_ARRAY_EQ(1e23, nd::json::parse(ndt::make_type<double>(), "1e23"));
+}
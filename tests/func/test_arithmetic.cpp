@@ -257,6 +257,32 @@ TEST(Arithmetic, Minus) {
   EXPECT_ARRAY_EQ(nd::array({-0.0, -1.0, -2.0, -3.0, -4.0}), -a);
 }
 
+TEST(Arithmetic, BuiltinScalars) {
+  // Two scalars of builtin types take a shortcut past the kernels, which
+  // must give the same type and value as the kernels do for arrays
+  vector<nd::array> values{static_cast<int8_t>(7),   static_cast<int16_t>(-3), static_cast<int32_t>(7),
+                           static_cast<int64_t>(-3), static_cast<uint8_t>(7),  static_cast<uint16_t>(3),
+                           static_cast<uint32_t>(7), static_cast<uint64_t>(3), 7.5f,
+                           -3.25,                    dynd::complex<float>(1.5f, -2.0f), dynd::complex<double>(-3.0, 0.5)};
+  vector<nd::callable> funcs{nd::add, nd::subtract, nd::multiply, nd::divide};
+
+  for (const nd::callable &f : funcs) {
+    for (const nd::array &a : values) {
+      for (const nd::array &b : values) {
+        nd::array a1 = nd::empty(ndt::make_fixed_dim(1, a.get_type()));
+        a1.assign(a);
+        nd::array b1 = nd::empty(ndt::make_fixed_dim(1, b.get_type()));
+        b1.assign(b);
+
+        nd::array res = f(a, b);
+        nd::array expected = f(a1, b1)(0);
+        EXPECT_EQ(expected.get_type(), res.get_type());
+        EXPECT_ARRAY_EQ(expected, res);
+      }
+    }
+  }
+}
+
 /*
 TEST(Arithmetic, CompoundDiv)
 {
@@ -424,6 +450,63 @@ TEST(Arithmetic, OptionArrayOptionFloat64) {
   }
 }
 
+TEST(Arithmetic, OptionArrayOptionRuns) {
+  // Long enough to cover several NA bitmap words and chunks, with all-available,
+  // all-missing and mixed words
+  const int n = 600;
+  nd::array a = nd::empty(n, ndt::type("?int32"));
+  nd::array b = nd::empty(n, ndt::type("?int32"));
+  for (int i = 0; i < n; ++i) {
+    if (i >= 128 && i < 256) {
+      a(i).assign_na();
+    } else {
+      a(i).vals() = i;
+    }
+    if (i % 7 == 3 || (i >= 400 && i < 470)) {
+      b(i).assign_na();
+    } else {
+      b(i).vals() = 2 * i;
+    }
+  }
+
+  nd::array c = a + b;
+  for (int i = 0; i < n; ++i) {
+    bool expected_na = (i >= 128 && i < 256) || i % 7 == 3 || (i >= 400 && i < 470);
+    EXPECT_EQ(expected_na, nd::is_na(c(i)).as<bool>());
+    if (!expected_na) {
+      EXPECT_EQ(3 * i, c(i).as<int>());
+    }
+  }
+}
+
+TEST(Arithmetic, OptionArrayOptionRunsFloat64) {
+  const int n = 600;
+  nd::array a = nd::empty(n, ndt::type("?float64"));
+  nd::array b = nd::empty(n, ndt::type("?float64"));
+  for (int i = 0; i < n; ++i) {
+    if (i >= 128 && i < 256) {
+      a(i).assign_na();
+    } else {
+      a(i).vals() = 0.5 * i;
+    }
+    if (i % 5 == 1 || (i >= 400 && i < 470)) {
+      b(i).assign_na();
+    } else {
+      b(i).vals() = 2.0 * i;
+    }
+  }
+
+  nd::array c = a * b;
+  nd::array c_na = nd::is_na(c);
+  for (int i = 0; i < n; ++i) {
+    bool expected_na = (i >= 128 && i < 256) || i % 5 == 1 || (i >= 400 && i < 470);
+    EXPECT_EQ(expected_na, c_na(i).as<bool>());
+    if (!expected_na) {
+      EXPECT_EQ(1.0 * i * i, c(i).as<double>());
+    }
+  }
+}
+
 TEST(Arithmetic, OptionArrayNotOptionFloat64) {
   nd::array data = parse_json("5 * ?int32", "[null, -1, 40, null, 1]");
   nd::array not_na_data = parse_json("5 * float64", "[2, -1, 40, 30, 1]");
@@ -0,0 +1,118 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include <dynd/functional.hpp>
+#include <dynd/gtest.hpp>
+#include <dynd/index.hpp>
+#include <dynd/kernels/byteswap_kernels.hpp>
+
+using namespace std;
+using namespace dynd;
+
+namespace {
+
+// Long enough for the vector loops and a scalar tail
+const intptr_t byteswap_test_size = 103;
+
+template <typename T>
+nd::array make_sequence(intptr_t size) {
+  nd::array a = nd::empty(size, ndt::make_type<T>());
+  T *data = reinterpret_cast<T *>(a.data());
+  for (intptr_t i = 0; i < size; ++i) {
+    data[i] = static_cast<T>(0x0102030405060708ULL * static_cast<uint64_t>(i + 1));
+  }
+  return a;
+}
+
+template <typename T>
+void check_byteswap(const nd::callable &f) {
+  nd::array a = make_sequence<T>(byteswap_test_size);
+  nd::array b = f(a);
+  const T *src = reinterpret_cast<const T *>(a.cdata());
+  const T *dst = reinterpret_cast<const T *>(b.cdata());
+  for (intptr_t i = 0; i < byteswap_test_size; ++i) {
+    ASSERT_EQ(byteswap_value(src[i]), dst[i]);
+  }
+}
+
+} // anonymous namespace
+
+TEST(Byteswap, Contiguous) {
+  nd::callable f = nd::functional::elwise(nd::byteswap);
+  check_byteswap<uint16_t>(f);
+  check_byteswap<uint32_t>(f);
+  check_byteswap<uint64_t>(f);
+}
+
+TEST(Byteswap, Strided) {
+  nd::callable f = nd::functional::elwise(nd::byteswap);
+  nd::array a = make_sequence<uint32_t>(byteswap_test_size);
+  nd::array b = f(a(irange().by(3)));
+  for (intptr_t i = 0; i < b.get_dim_size(); ++i) {
+    ASSERT_EQ(byteswap_value(a(3 * i).as<uint32_t>()), b(i).as<uint32_t>());
+  }
+}
+
+TEST(Byteswap, Contiguous16) {
+  char src[3 * 16], dst[3 * 16];
+  for (int i = 0; i < 3 * 16; ++i) {
+    src[i] = static_cast<char>(i);
+  }
+  byteswap_contiguous(dst, src, 16, 3);
+  for (int i = 0; i < 3 * 16; ++i) {
+    ASSERT_EQ((i / 16) * 16 + 15 - i % 16, dst[i]);
+  }
+
+  // In place
+  byteswap_contiguous(dst, dst, 16, 3);
+  EXPECT_EQ(0, memcmp(src, dst, sizeof(src)));
+}
+
+TEST(Byteswap, Pairwise) {
+  nd::callable f = nd::functional::elwise(nd::pairwise_byteswap);
+  nd::array a = nd::empty(byteswap_test_size, ndt::make_type<dynd::complex<float>>());
+  dynd::complex<float> *data = reinterpret_cast<dynd::complex<float> *>(a.data());
+  for (intptr_t i = 0; i < byteswap_test_size; ++i) {
+    data[i] = dynd::complex<float>(static_cast<float>(i), -0.5f * i);
+  }
+
+  nd::array b = f(a);
+  const uint32_t *src = reinterpret_cast<const uint32_t *>(a.cdata());
+  const uint32_t *dst = reinterpret_cast<const uint32_t *>(b.cdata());
+  for (intptr_t i = 0; i < 2 * byteswap_test_size; ++i) {
+    ASSERT_EQ(byteswap_value(src[i]), dst[i]);
+  }
+}
+
+TEST(Byteswap, Assign) {
+  nd::callable f = nd::functional::elwise(nd::byteswap);
+
+  // Non-native int32 values widened to native int64 in one kernel
+  nd::array a = nd::empty(byteswap_test_size, ndt::make_type<int32_t>());
+  int32_t *data = reinterpret_cast<int32_t *>(a.data());
+  for (intptr_t i = 0; i < byteswap_test_size; ++i) {
+    data[i] = static_cast<int32_t>(byteswap_value(static_cast<uint32_t>(-1000 * i)));
+  }
+  nd::array b = f({a}, {{"dst_tp", ndt::make_fixed_dim(byteswap_test_size, ndt::make_type<int64_t>())}});
+  for (intptr_t i = 0; i < byteswap_test_size; ++i) {
+    ASSERT_EQ(-1000 * i, b(i).as<int64_t>());
+  }
+
+  // Non-native float32 values to native float64, with a strided source
+  nd::array c = nd::empty(4, ndt::make_type<float>());
+  float *c_data = reinterpret_cast<float *>(c.data());
+  for (int i = 0; i < 4; ++i) {
+    uint32_t bits = alias_cast<uint32_t>(1.5f * i);
+    c_data[i] = alias_cast<float>(byteswap_value(bits));
+  }
+  EXPECT_ARRAY_EQ((nd::array{0.0, 3.0}),
+                  f({c(irange().by(2))}, {{"dst_tp", ndt::make_fixed_dim(2, ndt::make_type<double>())}}));
+
+  EXPECT_ARRAY_EQ(int64_t(0x12345678), nd::byteswap({int32_t(0x78563412)}, {{"dst_tp", ndt::make_type<int64_t>()}}));
+}
@@ -0,0 +1,107 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+#include <dynd/callables/describe_callable.hpp>
+#include <dynd/gtest.hpp>
+#include <dynd/json_parser.hpp>
+#include <dynd/statistics.hpp>
+
+using namespace std;
+using namespace dynd;
+
+TEST(Describe, FixedDim) {
+  nd::array a = nd::describe(nd::array{2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0});
+  EXPECT_EQ(nd::make_describe_type(), a.get_type());
+  EXPECT_EQ(8, a.p("count").as<int64_t>());
+  EXPECT_EQ(40.0, a.p("sum").as<double>());
+  EXPECT_EQ(5.0, a.p("mean").as<double>());
+  EXPECT_EQ(32.0, a.p("m2").as<double>());
+  EXPECT_EQ(2.0, a.p("min").as<double>());
+  EXPECT_EQ(9.0, a.p("max").as<double>());
+  EXPECT_DOUBLE_EQ(32.0 / 7.0, a.p("var").as<double>());
+  EXPECT_DOUBLE_EQ(sqrt(32.0 / 7.0), a.p("stddev").as<double>());
+
+  a = nd::describe(nd::array{3});
+  EXPECT_EQ(1, a.p("count").as<int64_t>());
+  EXPECT_EQ(3.0, a.p("min").as<double>());
+  EXPECT_TRUE(std::isnan(a.p("var").as<double>()));
+}
+
+TEST(Describe, Long) {
+  // Spans several chunks, with a large offset that a naive sum of squares would lose
+  const int n = 10007;
+  nd::array x = nd::empty(n, ndt::make_type<double>());
+  double sum = 0.0;
+  for (int i = 0; i < n; ++i) {
+    double value = 1.0e9 + (i % 17) - 0.25 * (i % 5);
+    x(i).vals() = value;
+    sum += value;
+  }
+  double mean = sum / n, m2 = 0.0;
+  for (int i = 0; i < n; ++i) {
+    double delta = x(i).as<double>() - mean;
+    m2 += delta * delta;
+  }
+
+  nd::array a = nd::describe(x);
+  EXPECT_EQ(n, a.p("count").as<int64_t>());
+  EXPECT_DOUBLE_EQ(mean, a.p("mean").as<double>());
+  EXPECT_NEAR(m2, a.p("m2").as<double>(), 1e-6 * m2);
+  EXPECT_EQ(1.0e9 - 1.0, a.p("min").as<double>());
+  EXPECT_EQ(1.0e9 + 16.0, a.p("max").as<double>());
+
+  // A strided view gives the same result as a copy of it
+  nd::array every_third = x(irange().by(3));
+  nd::array b = nd::describe(every_third);
+  nd::array c = nd::describe(every_third.eval());
+  EXPECT_EQ(c.p("count").as<int64_t>(), b.p("count").as<int64_t>());
+  EXPECT_EQ(c.p("mean").as<double>(), b.p("mean").as<double>());
+  EXPECT_EQ(c.p("m2").as<double>(), b.p("m2").as<double>());
+}
+
+TEST(Describe, Axes) {
+  nd::array x = nd::array{{1, 2, 3}, {4, 6, 8}};
+
+  nd::array a = nd::describe(x);
+  EXPECT_EQ(6, a.p("count").as<int64_t>());
+  EXPECT_EQ(4.0, a.p("mean").as<double>());
+
+  // Reducing the inner axis gives one result per row
+  a = nd::describe({x}, {{"axes", nd::array{1}}});
+  ASSERT_EQ(ndt::make_type<ndt::fixed_dim_type>(2, nd::make_describe_type()), a.get_type());
+  EXPECT_EQ(2.0, a(0).p("mean").as<double>());
+  EXPECT_EQ(6.0, a(1).p("mean").as<double>());
+  EXPECT_EQ(4.0, a(1).p("var").as<double>());
+
+  // Reducing the outer axis gives one result per column
+  a = nd::describe({x}, {{"axes", nd::array{0}}});
+  ASSERT_EQ(ndt::make_type<ndt::fixed_dim_type>(3, nd::make_describe_type()), a.get_type());
+  EXPECT_EQ(2.5, a(0).p("mean").as<double>());
+  EXPECT_EQ(3.0, a(2).p("min").as<double>());
+  EXPECT_EQ(8.0, a(2).p("max").as<double>());
+  // var and stddev are computed for each column once the rows are merged
+  EXPECT_EQ(4.5, a(0).p("var").as<double>());
+  EXPECT_EQ(8.0, a(1).p("var").as<double>());
+  EXPECT_DOUBLE_EQ(sqrt(12.5), a(2).p("stddev").as<double>());
+
+  a = nd::describe({x}, {{"axes", nd::array{1}}, {"keepdims", true}});
+  EXPECT_EQ(ndt::type("2 * 1 * {count: int64, sum: float64, mean: float64, m2: float64, min: float64, max: float64, "
+                      "var: float64, stddev: float64}"),
+            a.get_type());
+}
+
+TEST(Describe, VarDim) {
+  nd::array a = nd::describe(parse_json(ndt::type("3 * var * float64"), "[[23.5], [10, 2, 15], [-4]]"));
+  EXPECT_EQ(5, a.p("count").as<int64_t>());
+  EXPECT_EQ(46.5, a.p("sum").as<double>());
+  EXPECT_EQ(-4.0, a.p("min").as<double>());
+  EXPECT_EQ(23.5, a.p("max").as<double>());
+  EXPECT_DOUBLE_EQ(a.p("m2").as<double>() / 4.0, a.p("var").as<double>());
+}
@@ -218,6 +218,73 @@ TEST(Elwise, Binary_FixedDim) {
   EXPECT_ARRAY_EQ((nd::array{3, 5, 7}), f({{0, 1, 2}, {3, 4, 5}}, {}));
 }
 
+TEST(Elwise, Binary_FixedDimCoalesced) {
+  nd::callable f = nd::functional::elwise(nd::functional::apply([](int x, int y) { return 100 * x + y; }));
+
+  nd::array a = nd::empty(4, 5, 3, ndt::make_type<int>());
+  nd::array b = nd::empty(4, 5, 3, ndt::make_type<int>());
+  nd::array c = nd::empty(3, ndt::make_type<int>());
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        a(i, j, k).vals() = 15 * i + 3 * j + k;
+        b(i, j, k).vals() = 60 - (15 * i + 3 * j + k);
+      }
+    }
+  }
+  for (int k = 0; k < 3; ++k) {
+    c(k).vals() = k;
+  }
+
+  // Contiguous, so all three dimensions run as one loop
+  nd::array res = f(a, b);
+  // Broadcast along the outer dimensions
+  nd::array res_broadcast = f(a, c);
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        EXPECT_EQ(100 * (15 * i + 3 * j + k) + 60 - (15 * i + 3 * j + k), res(i, j, k).as<int>());
+        EXPECT_EQ(100 * (15 * i + 3 * j + k) + k, res_broadcast(i, j, k).as<int>());
+      }
+    }
+  }
+}
+
+TEST(Elwise, Binary_FixedDimTransposed) {
+  nd::callable f = nd::functional::elwise(nd::functional::apply([](int x, int y) { return 100 * x + y; }));
+
+  nd::array a = nd::empty(6, 7, ndt::make_type<int>());
+  nd::array b = nd::empty(7, 7, ndt::make_type<int>());
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      a(i, j).vals() = 7 * i + j;
+    }
+  }
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      b(i, j).vals() = 7 * i + j;
+    }
+  }
+
+  // Both inputs in F order, the loops get swapped
+  nd::array at = a.transpose();
+  nd::array res = f(at, at);
+  EXPECT_EQ(ndt::type("7 * 6 * int32"), res.get_type());
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      EXPECT_EQ(101 * (7 * j + i), res(i, j).as<int>());
+    }
+  }
+
+  // Mixed orders
+  res = f(b, b.transpose());
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 7; ++j) {
+      EXPECT_EQ(100 * (7 * i + j) + 7 * j + i, res(i, j).as<int>());
+    }
+  }
+}
+
 /*
 // TODO Reenable once there's a convenient way to make the binary callable
 TEST(LiftCallable, Expr_MultiDimVarToVarDim) {
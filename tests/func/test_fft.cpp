@@ -32,7 +32,7 @@ public:
         ::testing::TestWithParam<std::tr1::tuple<const char *, const char *, const char *>>::GetParam()));
 
     if (pattern_tp == ndt::type("T")) {
-      std::map<std::string, ndt::type> tp_vars;
+      ndt::typevar_map tp_vars;
       tp_vars["R"] = dtp;
 
       return ndt::substitute(concrete_tp, tp_vars, true);
@@ -40,7 +40,7 @@ public:
 
 #ifdef DYND_CUDA
     if (pattern_tp == ndt::type("cuda_device[T]")) {
-      std::map<std::string, ndt::type> tp_vars;
+      ndt::typevar_map tp_vars;
       tp_vars["R"] = dtp;
 
       return ndt::substitute(ndt::make_cuda_device(concrete_tp), tp_vars, true);
@@ -64,7 +64,7 @@ public:
         ::testing::TestWithParam<std::tr1::tuple<const char *, const char *, const char *>>::GetParam()));
 
     if (pattern_tp == ndt::type("T")) {
-      std::map<std::string, ndt::type> tp_vars;
+      ndt::typevar_map tp_vars;
       tp_vars["R"] = dtp;
 
       return ndt::substitute(concrete_tp, tp_vars, true);
@@ -72,7 +72,7 @@ public:
 
 #ifdef DYND_CUDA
     if (pattern_tp == ndt::type("cuda_device[T]")) {
-      std::map<std::string, ndt::type> tp_vars;
+      ndt::typevar_map tp_vars;
       tp_vars["R"] = dtp;
 
       return ndt::substitute(ndt::make_cuda_device(concrete_tp), tp_vars, true);
@@ -19,3 +19,59 @@ TEST(Math, Sin) {
   nd::array x = nd::random::uniform({}, {{"dst_tp", ndt::type("100 * float64")}});
   nd::sin(x);
 }
+
+TEST(Math, Overloads) {
+  EXPECT_EQ(ndt::make_type<float>(), nd::exp(1.0f).get_type());
+  EXPECT_EQ(ndt::make_type<double>(), nd::exp(1.0).get_type());
+  EXPECT_EQ(ndt::make_type<double>(), nd::exp(1).get_type());
+  EXPECT_EQ(ndt::make_type<dynd::complex<double>>(), nd::exp(dynd::complex<double>(0.0, 1.0)).get_type());
+  EXPECT_EQ(ndt::type("3 * float32"), nd::log(nd::array{1.0f, 2.0f, 3.0f}).get_type());
+
+  EXPECT_DOUBLE_EQ(std::exp(2.0), nd::exp(2).as<double>());
+  EXPECT_DOUBLE_EQ(std::cos(0.5), nd::cos(0.5).as<double>());
+  EXPECT_DOUBLE_EQ(std::expm1(1e-10), nd::expm1(1e-10).as<double>());
+  EXPECT_DOUBLE_EQ(std::log1p(1e-10), nd::log1p(1e-10).as<double>());
+  EXPECT_DOUBLE_EQ(std::tanh(0.75), nd::tanh(0.75).as<double>());
+  EXPECT_DOUBLE_EQ(std::erf(0.25), nd::erf(0.25).as<double>());
+  EXPECT_FLOAT_EQ(std::erf(0.25f), nd::erf(0.25f).as<float>());
+
+  dynd::complex<double> z = nd::exp(dynd::complex<double>(0.0, 1.0)).as<dynd::complex<double>>();
+  EXPECT_DOUBLE_EQ(std::cos(1.0), z.real());
+  EXPECT_DOUBLE_EQ(std::sin(1.0), z.imag());
+}
+
+TEST(Math, ExpLogFloat32) {
+  // Contiguous and strided
+  nd::array x = nd::empty(2000, ndt::make_type<float>());
+  for (int i = 0; i < 2000; ++i) {
+    x(i).vals() = -100.0f + 0.0947f * i;
+  }
+  nd::array y = nd::exp(x);
+  nd::array y_strided = nd::exp(x(irange().by(2)));
+  for (int i = 0; i < 2000; ++i) {
+    float expected = static_cast<float>(std::exp(static_cast<double>(x(i).as<float>())));
+    EXPECT_FLOAT_EQ(expected, y(i).as<float>());
+    if (i % 2 == 0) {
+      EXPECT_EQ(y(i).as<float>(), y_strided(i / 2).as<float>());
+    }
+  }
+
+  nd::array z = nd::log(y);
+  for (int i = 0; i < 2000; ++i) {
+    float value = y(i).as<float>();
+    float expected = static_cast<float>(std::log(static_cast<double>(value)));
+    EXPECT_FLOAT_EQ(expected, z(i).as<float>());
+  }
+
+  // Subnormals and special values
+  EXPECT_FLOAT_EQ(static_cast<float>(std::exp(-100.0)), nd::exp(-100.0f).as<float>());
+  EXPECT_FLOAT_EQ(static_cast<float>(std::log(1e-40)), nd::log(1e-40f).as<float>());
+  EXPECT_EQ(std::numeric_limits<float>::infinity(), nd::exp(100.0f).as<float>());
+  EXPECT_EQ(0.0f, nd::exp(-200.0f).as<float>());
+  EXPECT_EQ(1.0f, nd::exp(0.0f).as<float>());
+  EXPECT_EQ(0.0f, nd::log(1.0f).as<float>());
+  EXPECT_EQ(-std::numeric_limits<float>::infinity(), nd::log(0.0f).as<float>());
+  EXPECT_EQ(std::numeric_limits<float>::infinity(), nd::log(std::numeric_limits<float>::infinity()).as<float>());
+  EXPECT_TRUE(std::isnan(nd::log(-1.0f).as<float>()));
+  EXPECT_TRUE(std::isnan(nd::exp(std::numeric_limits<float>::quiet_NaN()).as<float>()));
+}
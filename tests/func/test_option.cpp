@@ -9,6 +9,7 @@
 
 #include "../test_memory_new.hpp"
 
+#include <dynd/functional.hpp>
 #include <dynd/gtest.hpp>
 #include <dynd/option.hpp>
 
@@ -57,3 +58,23 @@ TEST(Option, AssignNAArray) {
   nd::array expected = {true, false, false};
   EXPECT_ARRAY_EQ(nd::is_na(a), expected);
 }
+
+TEST(Option, ForwardNAUserChild) {
+  // A user child is only called on available values, even for
+  // floating-point arguments
+  static int calls;
+  calls = 0;
+  nd::callable f = nd::functional::elwise(nd::functional::forward_na<0>(nd::functional::apply([](double x, double y) {
+    ++calls;
+    return x + y;
+  })));
+
+  nd::array res = f(parse_json("5 * ?float64", "[1, null, 3, null, 5]"), nd::array{1.0, 1.0, 1.0, 1.0, 1.0});
+  EXPECT_EQ(3, calls);
+  EXPECT_EQ(ndt::type("5 * ?float64"), res.get_type());
+  nd::array expected{false, true, false, true, false};
+  EXPECT_ARRAY_EQ(nd::is_na(res), expected);
+  EXPECT_EQ(2.0, res(0).as<double>());
+  EXPECT_EQ(4.0, res(2).as<double>());
+  EXPECT_EQ(6.0, res(4).as<double>());
+}
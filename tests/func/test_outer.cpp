@@ -39,3 +39,32 @@ TEST(Outer, 3D) {
   EXPECT_ARRAY_EQ(nd::array({3, 4}), f(0, 1, nd::array{2, 3}));
   EXPECT_ARRAY_EQ(3, f(0, 1, 2));
 }
+
+TEST(Outer, Tiled) {
+  nd::callable f = nd::functional::outer([](int x, int y) { return 100000 * x + y; });
+
+  // Long enough that the inner dimension is processed in several tiles
+  const int n = 3, m = 10000;
+  nd::array a = nd::empty(n, ndt::make_type<int>());
+  nd::array b = nd::empty(2 * m, ndt::make_type<int>());
+  for (int i = 0; i < n; ++i) {
+    a(i).vals() = i + 1;
+  }
+  for (int j = 0; j < 2 * m; ++j) {
+    b(j).vals() = j;
+  }
+
+  nd::array res = f(a, b);
+  EXPECT_EQ(ndt::type("3 * 20000 * int32"), res.get_type());
+  nd::array res_strided = f(a, b(irange().by(2)));
+  EXPECT_EQ(ndt::type("3 * 10000 * int32"), res_strided.get_type());
+  for (int i = 0; i < n; ++i) {
+    const int *row = reinterpret_cast<const int *>(res(i).cdata());
+    for (int j = 0; j < 2 * m; ++j) {
+      ASSERT_EQ(100000 * (i + 1) + j, row[j]);
+    }
+    for (int j = 0; j < m; ++j) {
+      ASSERT_EQ(100000 * (i + 1) + 2 * j, res_strided(i, j).as<int>());
+    }
+  }
+}
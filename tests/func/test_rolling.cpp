@@ -0,0 +1,116 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+#include <dynd/gtest.hpp>
+#include <dynd/index.hpp>
+#include <dynd/statistics.hpp>
+
+using namespace std;
+using namespace dynd;
+
+TEST(Rolling, Sum) {
+  EXPECT_ARRAY_EQ((nd::array{int64_t(1), int64_t(3), int64_t(6), int64_t(9), int64_t(12)}),
+                  nd::rolling_sum(3)(nd::array{1, 2, 3, 4, 5}));
+  EXPECT_ARRAY_EQ((nd::array{1.5, 2.5, 4.5}), nd::rolling_sum(2)(nd::array{1.5, 1.0, 3.5}));
+  EXPECT_ARRAY_EQ((nd::array{int64_t(4), int64_t(-2), int64_t(7)}), nd::rolling_sum(1)(nd::array{4, -2, 7}));
+  // The window is larger than the dimension
+  EXPECT_ARRAY_EQ((nd::array{int64_t(1), int64_t(3), int64_t(6)}), nd::rolling_sum(10)(nd::array{1, 2, 3}));
+}
+
+TEST(Rolling, SumWidensIntegers) {
+  // The sums are accumulated and returned in 64 bits
+  EXPECT_ARRAY_EQ((nd::array{int64_t(100), int64_t(200), int64_t(200)}),
+                  nd::rolling_sum(2)(nd::array{int8_t(100), int8_t(100), int8_t(100)}));
+  EXPECT_ARRAY_EQ((nd::array{uint64_t(4000000000u), uint64_t(8000000000u)}),
+                  nd::rolling_sum(2)(nd::array{4000000000u, 4000000000u}));
+}
+
+TEST(Rolling, SumCompensated) {
+  // Without compensation, the 1.0 entering together with 1e16 is lost, and
+  // stays lost for the rest of the row
+  nd::array res = nd::rolling_sum(3)(nd::array{1e16, 1.0, -1e16, 1.0, 1.0, 1.0});
+  EXPECT_EQ(1.0, res(2).as<double>());
+  EXPECT_EQ(-1e16 + 2.0, res(3).as<double>());
+  EXPECT_EQ(3.0, res(5).as<double>());
+}
+
+TEST(Rolling, SumNonFinite) {
+  const double inf = numeric_limits<double>::infinity();
+  const double nan = numeric_limits<double>::quiet_NaN();
+
+  // The sum recovers once the infinity leaves the window
+  EXPECT_ARRAY_EQ((nd::array{1.0, inf, inf, 5.0, 7.0}), nd::rolling_sum(2)(nd::array{1.0, inf, 2.0, 3.0, 4.0}));
+  EXPECT_ARRAY_EQ((nd::array{-inf, -inf, 5.0}), nd::rolling_sum(2)(nd::array{-inf, 2.0, 3.0}));
+
+  nd::array res = nd::rolling_sum(2)(nd::array{1.0, nan, 2.0, 3.0});
+  EXPECT_EQ(1.0, res(0).as<double>());
+  EXPECT_TRUE(std::isnan(res(1).as<double>()));
+  EXPECT_TRUE(std::isnan(res(2).as<double>()));
+  EXPECT_EQ(5.0, res(3).as<double>());
+
+  // Opposite infinities in the same window give NaN
+  res = nd::rolling_sum(2)(nd::array{inf, -inf, 1.0});
+  EXPECT_EQ(inf, res(0).as<double>());
+  EXPECT_TRUE(std::isnan(res(1).as<double>()));
+  EXPECT_EQ(-inf, res(2).as<double>());
+
+  // Finite values that overflow together are summed again once one leaves
+  const double big = numeric_limits<double>::max();
+  EXPECT_ARRAY_EQ((nd::array{big, inf, big + -1.0, 0.0}), nd::rolling_sum(2)(nd::array{big, big, -1.0, 1.0}));
+}
+
+TEST(Rolling, Min) {
+  EXPECT_ARRAY_EQ((nd::array{5, 3, 3, 1, 1, 1, 2}), nd::rolling_min(3)(nd::array{5, 3, 4, 1, 6, 7, 2}));
+  EXPECT_ARRAY_EQ((nd::array{2.0, 2.0, -1.0, -1.0}), nd::rolling_min(2)(nd::array{2.0, 2.0, -1.0, 0.5}));
+  EXPECT_ARRAY_EQ((nd::array{4, -2, 7}), nd::rolling_min(1)(nd::array{4, -2, 7}));
+}
+
+TEST(Rolling, Max) {
+  EXPECT_ARRAY_EQ((nd::array{5, 5, 5, 4, 6, 7, 7}), nd::rolling_max(3)(nd::array{5, 3, 4, 1, 6, 7, 2}));
+  EXPECT_ARRAY_EQ((nd::array{1u, 2u, 3u, 4u}), nd::rolling_max(4)(nd::array{1u, 2u, 3u, 4u}));
+  EXPECT_ARRAY_EQ((nd::array{9, 9, 9, 8, 7}), nd::rolling_max(3)(nd::array{9, 8, 7, 6, 5}));
+}
+
+TEST(Rolling, NaNPropagates) {
+  // Each window that contains a NaN yields NaN, wherever the NaN is in it
+  const double nan = numeric_limits<double>::quiet_NaN();
+  nd::array a{1.0, nan, 0.5, 2.0, 3.0};
+
+  nd::array res = nd::rolling_max(2)(a);
+  EXPECT_EQ(1.0, res(0).as<double>());
+  EXPECT_TRUE(std::isnan(res(1).as<double>()));
+  EXPECT_TRUE(std::isnan(res(2).as<double>()));
+  EXPECT_EQ(2.0, res(3).as<double>());
+  EXPECT_EQ(3.0, res(4).as<double>());
+
+  res = nd::rolling_min(3)(a);
+  EXPECT_EQ(1.0, res(0).as<double>());
+  EXPECT_TRUE(std::isnan(res(1).as<double>()));
+  EXPECT_TRUE(std::isnan(res(2).as<double>()));
+  EXPECT_TRUE(std::isnan(res(3).as<double>()));
+  EXPECT_EQ(0.5, res(4).as<double>());
+}
+
+TEST(Rolling, FixedDimFixedDim) {
+  EXPECT_ARRAY_EQ((nd::array{{int64_t(1), int64_t(3), int64_t(5)}, {int64_t(4), int64_t(9), int64_t(11)}}),
+                  nd::rolling_sum(2)(nd::array{{1, 2, 3}, {4, 5, 6}}));
+  EXPECT_ARRAY_EQ((nd::array{{3, 1, 1}, {0, 0, 2}}), nd::rolling_min(2)(nd::array{{3, 1, 4}, {0, 5, 2}}));
+}
+
+TEST(Rolling, Strided) {
+  nd::array a{0, 1, 2, 3, 4, 5, 6, 7};
+  EXPECT_ARRAY_EQ((nd::array{int64_t(7), int64_t(12), int64_t(8), int64_t(4)}), nd::rolling_sum(2)(a(irange().by(-2))));
+  EXPECT_ARRAY_EQ((nd::array{0, 2, 4, 6}), nd::rolling_max(3)(a(irange().by(2))));
+}
+
+TEST(Rolling, Errors) {
+  EXPECT_THROW(nd::rolling_sum(0), invalid_argument);
+  EXPECT_THROW(nd::rolling_min(2)(nd::array(1)), type_error);
+}
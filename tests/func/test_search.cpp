@@ -7,7 +7,9 @@
 #include <cmath>
 #include <iostream>
 #include <stdexcept>
+#include <vector>
 
+#include <dynd/functional.hpp>
 #include <dynd/gtest.hpp>
 #include <dynd/search.hpp>
 
@@ -19,3 +21,79 @@ TEST(Search, BinarySearch) {
   EXPECT_ARRAY_VALS_EQ(1, nd::binary_search(nd::array{5, 3, 1}, 3));
   EXPECT_ARRAY_VALS_EQ(-1, nd::binary_search(nd::array{5, 3, 1}, 10));
 }
+
+TEST(Search, BinarySearchFloat) {
+  EXPECT_ARRAY_VALS_EQ(2, nd::binary_search(nd::array{-1.5, 0.0, 2.5, 7.0}, 2.5));
+  EXPECT_ARRAY_VALS_EQ(1, nd::binary_search(nd::array{-1.5, 0.0, 2.5, 7.0}, -0.0));
+  EXPECT_ARRAY_VALS_EQ(-1, nd::binary_search(nd::array{-1.5, 0.0, 2.5, 7.0}, 1.0));
+}
+
+TEST(Search, BinarySearchString) {
+  EXPECT_ARRAY_VALS_EQ(2, nd::binary_search(nd::array{"apple", "banana", "cherry"}, nd::array("cherry")));
+  EXPECT_ARRAY_VALS_EQ(-1, nd::binary_search(nd::array{"apple", "banana", "cherry"}, nd::array("date")));
+}
+
+/**
+ * Checks an elementwise binary search of a shared array against
+ * std::lower_bound, for each of the batch search strategies.
+ */
+template <typename T>
+static void check_batch_search(const std::vector<T> &keys, const std::vector<T> &values) {
+  nd::array a = nd::empty(static_cast<intptr_t>(keys.size()), ndt::make_type<T>());
+  std::copy(keys.begin(), keys.end(), reinterpret_cast<T *>(a.data()));
+  nd::array b = nd::empty(static_cast<intptr_t>(values.size()), ndt::make_type<T>());
+  std::copy(values.begin(), values.end(), reinterpret_cast<T *>(b.data()));
+
+  nd::array res = nd::functional::elwise(nd::binary_search)(a, b);
+  ASSERT_EQ(static_cast<intptr_t>(values.size()), res.get_dim_size());
+  const intptr_t *res_data = reinterpret_cast<const intptr_t *>(res.cdata());
+  for (size_t i = 0; i < values.size(); ++i) {
+    auto it = std::lower_bound(keys.begin(), keys.end(), values[i]);
+    intptr_t expected = (it != keys.end() && *it == values[i]) ? (it - keys.begin()) : -1;
+    ASSERT_EQ(expected, res_data[i]) << "searching for " << values[i];
+  }
+}
+
+TEST(Search, BinarySearchBatch) {
+  std::vector<int32_t> keys, values;
+
+  // Irregular keys, with a duplicate
+  for (int32_t i = 0; i < 5000; ++i) {
+    keys.push_back(i * i / 7);
+  }
+  for (int32_t i = 0; i < 3000; ++i) {
+    values.push_back((i * 7919) % 4000000 - 10);
+  }
+  // Eytzinger layout
+  check_batch_search(keys, values);
+  // Lower bound search, too few values for a layout
+  check_batch_search(keys, std::vector<int32_t>(values.begin(), values.begin() + 100));
+  // Merge with sorted values
+  std::sort(values.begin(), values.end());
+  check_batch_search(keys, values);
+
+  // Interpolation search over uniform keys
+  keys.clear();
+  for (int32_t i = 0; i < 5000; ++i) {
+    keys.push_back(3 * i + (i % 3));
+  }
+  std::reverse(values.begin(), values.end());
+  for (int32_t i = 0; i < 3000; ++i) {
+    values[i] %= 16000;
+  }
+  check_batch_search(keys, values);
+}
+
+TEST(Search, BinarySearchBatchFloat) {
+  std::vector<double> keys, values;
+  for (int i = 0; i < 1000; ++i) {
+    keys.push_back(i * 0.5 - 100);
+  }
+  for (int i = 0; i < 500; ++i) {
+    values.push_back((i * 37 % 500) * 0.75 - 120);
+  }
+  values.push_back(std::numeric_limits<double>::quiet_NaN());
+  check_batch_search(keys, values);
+  keys.push_back(std::numeric_limits<double>::infinity());
+  check_batch_search(keys, values);
+}
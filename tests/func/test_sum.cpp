@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <stdexcept>
 
 #include <dynd/arithmetic.hpp>
@@ -62,3 +63,77 @@ TEST(Sum, 2D)
   EXPECT_ARRAY_EQ(15, nd::sum(nd::array{{0, 1, 2}, {3, 4, 5}}));
 }
 */
+
+TEST(WideSum, Int64)
+{
+  // The exact sum doesn't fit in an int64
+  const int64_t big = std::numeric_limits<int64_t>::max();
+  nd::array a = nd::wide_sum(nd::array{big, big, big, static_cast<int64_t>(-1)});
+  EXPECT_EQ(ndt::make_type<int128>(), a.get_type());
+  EXPECT_EQ(int128(big) * int128(3) - int128(1), *reinterpret_cast<const int128 *>(a.cdata()));
+
+  a = nd::wide_sum(nd::array{std::numeric_limits<uint64_t>::max(), std::numeric_limits<uint64_t>::max()});
+  EXPECT_EQ(ndt::make_type<uint128>(), a.get_type());
+  EXPECT_EQ(uint128(1ULL, 0xfffffffffffffffeULL), *reinterpret_cast<const uint128 *>(a.cdata()));
+}
+
+TEST(WideSum, Int32)
+{
+  const int n = 1001;
+  nd::array x = nd::empty(n, ndt::make_type<int32_t>());
+  int64_t expected = 0;
+  for (int i = 0; i < n; ++i) {
+    int32_t value = (i % 2 == 0) ? std::numeric_limits<int32_t>::max() - i : -i;
+    x(i).vals() = value;
+    expected += value;
+  }
+
+  nd::array a = nd::wide_sum(x);
+  EXPECT_EQ(ndt::make_type<int128>(), a.get_type());
+  EXPECT_EQ(int128(expected), *reinterpret_cast<const int128 *>(a.cdata()));
+}
+
+TEST(WideSum, Axes)
+{
+  nd::array a = nd::wide_sum({nd::array{{1LL, 2LL, 3LL}, {4LL, 5LL, 6LL}}}, {{"axes", nd::array{1}}});
+  EXPECT_EQ(ndt::type("2 * int128"), a.get_type());
+  EXPECT_EQ(int128(6), *reinterpret_cast<const int128 *>(a(0).cdata()));
+  EXPECT_EQ(int128(15), *reinterpret_cast<const int128 *>(a(1).cdata()));
+}
+
+TEST(WideMean, Int64)
+{
+  const int64_t big = std::numeric_limits<int64_t>::max();
+  nd::array a = nd::wide_mean(nd::array{big, big, big - 3});
+  EXPECT_EQ(ndt::type("{sum: int128, count: int64, mean: float64}"), a.get_type());
+  EXPECT_EQ(int128(big) * int128(3) - int128(3), *reinterpret_cast<const int128 *>(a.p("sum").cdata()));
+  EXPECT_EQ(3, a.p("count").as<int64_t>());
+  EXPECT_DOUBLE_EQ(static_cast<double>(big - 1), a.p("mean").as<double>());
+
+  a = nd::wide_mean({nd::array{{1, 2}, {4, 7}}}, {{"axes", nd::array{1}}});
+  EXPECT_EQ(1.5, a(0).p("mean").as<double>());
+  EXPECT_EQ(5.5, a(1).p("mean").as<double>());
+}
+
+TEST(WideMean, Negative)
+{
+  nd::array a = nd::wide_mean(nd::array{-1, -2, -6});
+  EXPECT_EQ(int128(-9), *reinterpret_cast<const int128 *>(a.p("sum").cdata()));
+  EXPECT_EQ(-3.0, a.p("mean").as<double>());
+
+  const int64_t small = std::numeric_limits<int64_t>::min();
+  a = nd::wide_mean(nd::array{small, small, small + 3});
+  EXPECT_EQ(int128(small) * int128(3) + int128(3), *reinterpret_cast<const int128 *>(a.p("sum").cdata()));
+  EXPECT_DOUBLE_EQ(static_cast<double>(small + 1), a.p("mean").as<double>());
+}
+
+TEST(WideMean, MixedSign)
+{
+  nd::array a = nd::wide_mean(nd::array{5, -9, 2, -6});
+  EXPECT_EQ(int128(-8), *reinterpret_cast<const int128 *>(a.p("sum").cdata()));
+  EXPECT_EQ(-2.0, a.p("mean").as<double>());
+
+  a = nd::wide_mean({nd::array{{-3, 1}, {4, -1}}}, {{"axes", nd::array{1}}});
+  EXPECT_EQ(-1.0, a(0).p("mean").as<double>());
+  EXPECT_EQ(1.5, a(1).p("mean").as<double>());
+}
@@ -38,6 +38,23 @@ struct member_func_wrapper {
 
 DYND_HAS(func);
 
+TEST(Config, BufferChunkSize) {
+  EXPECT_GT(get_data_cache_size(1), 0u);
+  EXPECT_LE(get_data_cache_size(1), get_data_cache_size(2));
+  EXPECT_THROW(get_data_cache_size(4), invalid_argument);
+
+  // Bigger elements get shorter chunks
+  EXPECT_GE(get_buffer_chunk_size(1), get_buffer_chunk_size(8));
+  EXPECT_GE(get_buffer_chunk_size(8), get_buffer_chunk_size(64));
+
+  set_buffer_chunk_bytes(8192);
+  EXPECT_EQ(1024u, get_buffer_chunk_size(8));
+  // Chunks are never shorter than 16 elements
+  EXPECT_EQ(16u, get_buffer_chunk_size(4096));
+  set_buffer_chunk_bytes(0);
+  EXPECT_EQ(get_data_cache_size(1) / 2 / 8, get_buffer_chunk_size(8));
+}
+
 TEST(Config, Has) {
   EXPECT_TRUE(has_value<value_wrapper<int>>::value);
   EXPECT_TRUE(has_value<value_wrapper<const char *>>::value);
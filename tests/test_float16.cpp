@@ -5,9 +5,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <stdexcept>
+#include <vector>
 
+#include <dynd/arithmetic.hpp>
+#include <dynd/array.hpp>
 #include <dynd/config.hpp>
 #include <dynd/gtest.hpp>
 
@@ -23,3 +27,105 @@ TEST(Float16, CommonType)
                             float64>::value));
 }
 */
+
+TEST(Float16, BulkWidening)
+{
+  vector<uint16_t> bits(0x10000);
+  for (size_t i = 0; i < bits.size(); ++i) {
+    bits[i] = static_cast<uint16_t>(i);
+  }
+
+  // Start at an offset too, so the vector loop sees unaligned data and a tail
+  for (size_t offset = 0; offset < 2; ++offset) {
+    size_t count = bits.size() - offset;
+
+    vector<float> f(count);
+    halfbits_to_floats(f.data(), bits.data() + offset, count);
+    for (size_t i = 0; i < count; ++i) {
+      float expected = halfbits_to_float(bits[i + offset]);
+      ASSERT_EQ(0, memcmp(&expected, &f[i], sizeof(float))) << "float16 bits " << bits[i + offset];
+    }
+
+    vector<double> d(count);
+    halfbits_to_doubles(d.data(), bits.data() + offset, count);
+    for (size_t i = 0; i < count; ++i) {
+      double expected = halfbits_to_double(bits[i + offset]);
+      ASSERT_EQ(0, memcmp(&expected, &d[i], sizeof(double))) << "float16 bits " << bits[i + offset];
+    }
+  }
+}
+
+TEST(Float16, BulkNarrowing)
+{
+  // Every float16 value, which narrows exactly, followed by the normal values
+  // nudged towards the next one, which have to round
+  vector<float> f;
+  for (uint32_t i = 0; i < 0x10000; ++i) {
+    f.push_back(halfbits_to_float(static_cast<uint16_t>(i)));
+  }
+  for (uint32_t i = 0x0400; i < 0x7bff; ++i) {
+    float lo = halfbits_to_float(static_cast<uint16_t>(i)), hi = halfbits_to_float(static_cast<uint16_t>(i + 1));
+    f.push_back(lo + (hi - lo) * 0.25f);
+    f.push_back(-(lo + (hi - lo) * 0.5f));
+    f.push_back(lo + (hi - lo) * 0.75f);
+  }
+
+  vector<uint16_t> h(f.size());
+  floats_to_halfbits(h.data(), f.data(), f.size());
+  for (size_t i = 0; i < f.size(); ++i) {
+    ASSERT_EQ(float_to_halfbits(f[i]), h[i]) << "float32 value " << f[i];
+  }
+
+  vector<double> d(f.begin(), f.end());
+  doubles_to_halfbits(h.data(), d.data(), d.size());
+  for (size_t i = 0; i < d.size(); ++i) {
+    ASSERT_EQ(double_to_halfbits(d[i]), h[i]) << "float64 value " << d[i];
+  }
+
+  // Overflow in the middle of a block raises like the scalar conversion
+  vector<float> big(16, 1.0f);
+  big[11] = 65520.0f;
+  EXPECT_THROW(floats_to_halfbits(h.data(), big.data(), big.size()), overflow_error);
+}
+
+TEST(Float16, Assign)
+{
+  vector<float> values;
+  for (int i = 0; i < 300; ++i) {
+    values.push_back(static_cast<float>(i - 150) * 0.5f);
+  }
+  nd::array a = values;
+
+  nd::array b = nd::empty(300, ndt::make_type<float16>());
+  b.assign(a);
+  nd::array c = nd::empty(300, ndt::make_type<double>());
+  c.assign(b);
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(values[i], halfbits_to_float(b(i).as<float16>().bits()));
+    EXPECT_EQ(values[i], c(i).as<double>());
+  }
+
+  EXPECT_THROW(b.assign(nd::array(0.1f), assign_error_inexact), runtime_error);
+}
+
+TEST(Float16, Arithmetic)
+{
+  vector<float> values;
+  for (int i = 0; i < 300; ++i) {
+    values.push_back(static_cast<float>(i - 150) * 0.25f);
+  }
+  nd::array a = nd::empty(300, ndt::make_type<float16>());
+  a.assign(nd::array(values));
+
+  nd::array b = a + a;
+  EXPECT_EQ(ndt::type("300 * float16"), b.get_type());
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(values[i] + values[i], halfbits_to_float(b(i).as<float16>().bits()));
+  }
+
+  b = a * nd::array(float16(2.0f));
+  EXPECT_EQ(ndt::type("300 * float16"), b.get_type());
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(values[i] * 2.0f, halfbits_to_float(b(i).as<float16>().bits()));
+  }
+}
@@ -0,0 +1,105 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <dynd/arithmetic.hpp>
+#include <dynd/gtest.hpp>
+#include <dynd/instrumentation.hpp>
+
+using namespace std;
+using namespace dynd;
+
+TEST(Instrumentation, Disabled) {
+  nd::reset_callable_stats();
+  EXPECT_FALSE(nd::is_instrumentation_enabled());
+
+  nd::add(nd::array{1, 2, 3}, nd::array{4, 5, 6});
+  EXPECT_TRUE(nd::get_callable_stats().empty());
+
+  stringstream ss;
+  nd::dump_callable_stats_json(ss);
+  EXPECT_EQ("{\"callables\": [\n]}\n", ss.str());
+}
+
+TEST(Instrumentation, RecordCall) {
+  // The statistics are always compiled, only the hooks in the call path depend on DYND_INSTRUMENT
+  nd::reset_callable_stats();
+  nd::set_instrumentation_enabled(true);
+  nd::array a = nd::empty(ndt::type("3 * 2 * int32"));
+  for (int i = 0; i < 2; ++i) {
+    nd::detail::call_recorder recorder(nd::add.get());
+    recorder.resolved();
+    recorder.built(128);
+    recorder.executed(a.get_type(), a->metadata());
+  }
+  nd::set_instrumentation_enabled(false);
+
+  vector<nd::callable_stats> stats = nd::get_callable_stats();
+  ASSERT_EQ(1u, stats.size());
+  EXPECT_EQ("dynd.nd.add", stats[0].name);
+  EXPECT_EQ(2u, stats[0].calls);
+  EXPECT_EQ(12u, stats[0].elements);
+  EXPECT_EQ(256u, stats[0].kernel_bytes);
+
+  stringstream json;
+  nd::dump_callable_stats_json(json);
+  EXPECT_NE(std::string::npos, json.str().find("{\"name\": \"dynd.nd.add\", \"calls\": 2"));
+
+  stringstream trace;
+  nd::dump_callable_trace(trace);
+  EXPECT_EQ(0u, trace.str().find("{\"traceEvents\": ["));
+  EXPECT_NE(std::string::npos, trace.str().find("\"cat\": \"resolve\""));
+
+  // A recorder created while the instrumentation is disabled records nothing
+  nd::reset_callable_stats();
+  {
+    nd::detail::call_recorder recorder(nd::add.get());
+    recorder.resolved();
+    recorder.built(128);
+    recorder.executed(a.get_type(), a->metadata());
+  }
+  EXPECT_TRUE(nd::get_callable_stats().empty());
+}
+
+// Without DYND_INSTRUMENT the hooks are compiled out, so the test of calls
+// going through them is reported as disabled
+#ifdef DYND_INSTRUMENT
+#define DYND_INSTRUMENTED_TEST(NAME) NAME
+#else
+#define DYND_INSTRUMENTED_TEST(NAME) DISABLED_##NAME
+#endif
+
+TEST(Instrumentation, DYND_INSTRUMENTED_TEST(CallHooks)) {
+  EXPECT_TRUE(nd::is_instrumentation_available());
+
+  nd::reset_callable_stats();
+  nd::set_instrumentation_enabled(true);
+  nd::add(nd::array{1, 2, 3}, nd::array{4, 5, 6});
+  nd::add(nd::array{{1, 2}, {3, 4}}, nd::array{5, 6});
+  nd::set_instrumentation_enabled(false);
+
+  vector<nd::callable_stats> stats = nd::get_callable_stats();
+  auto it = find_if(stats.begin(), stats.end(), [](const nd::callable_stats &s) { return s.name == "dynd.nd.add"; });
+  ASSERT_NE(stats.end(), it);
+  EXPECT_EQ(2u, it->calls);
+  EXPECT_EQ(7u, it->elements);
+  EXPECT_GT(it->kernel_bytes, 0u);
+
+  stringstream json;
+  nd::dump_callable_stats_json(json);
+  EXPECT_NE(std::string::npos, json.str().find("{\"name\": \"dynd.nd.add\", \"calls\": 2"));
+
+  stringstream trace;
+  nd::dump_callable_trace(trace);
+  EXPECT_EQ(0u, trace.str().find("{\"traceEvents\": ["));
+  EXPECT_NE(std::string::npos, trace.str().find("\"cat\": \"execute\""));
+
+  nd::reset_callable_stats();
+  EXPECT_TRUE(nd::get_callable_stats().empty());
+}
@@ -0,0 +1,263 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include <dynd/config.hpp>
+#include <dynd/exceptions.hpp>
+#include <dynd/gtest.hpp>
+
+using namespace std;
+using namespace dynd;
+
+namespace {
+
+template <typename T>
+std::string to_string(const T &value)
+{
+  std::stringstream ss;
+  ss << value;
+  return ss.str();
+}
+
+} // anonymous namespace
+
+TEST(Int128, AddSubtract)
+{
+  EXPECT_EQ(int128(1ULL, 0ULL), int128(0ULL, 0xffffffffffffffffULL) + int128(1));
+  EXPECT_EQ(int128(0ULL, 0xffffffffffffffffULL), int128(1ULL, 0ULL) - int128(1));
+  EXPECT_EQ(int128(-3), int128(2) - int128(5));
+  EXPECT_EQ(int128(10), int128(12) - int128(2));
+
+  int128 x = int128(-7);
+  x += int128(3);
+  EXPECT_EQ(int128(-4), x);
+  x -= int128(-10);
+  EXPECT_EQ(int128(6), x);
+}
+
+TEST(Int128, Multiply)
+{
+  const int128 min_value = std::numeric_limits<int128>::min();
+  EXPECT_EQ(int128(-6), int128(-2) * int128(3));
+  EXPECT_EQ(int128(6), int128(-2) * int128(-3));
+  EXPECT_EQ("85070591730234615847396907784232501249",
+            to_string(int128(9223372036854775807LL) * int128(9223372036854775807LL)));
+  EXPECT_EQ("-85070591730234615856620279821087277056",
+            to_string(int128(-9223372036854775807LL - 1) * int128(9223372036854775807LL)));
+  // Used to recurse forever for the minimum value
+  EXPECT_EQ(int128(0), min_value * 2u);
+  EXPECT_EQ(int128(-15), int128(-5) * 3u);
+}
+
+TEST(Int128, Divide)
+{
+  const int128 min_value = std::numeric_limits<int128>::min();
+  int128 big = int128(1000000007LL) * int128(998244353LL) * int128(1000000009LL);
+  EXPECT_EQ(int128(998244353LL) * int128(1000000009LL), big / int128(1000000007LL));
+  EXPECT_EQ(int128(0), big % int128(1000000007LL));
+
+  // Truncates toward zero, with the remainder taking the sign of the dividend
+  EXPECT_EQ(int128(-2), int128(-7) / int128(3));
+  EXPECT_EQ(int128(-1), int128(-7) % int128(3));
+  EXPECT_EQ(int128(-2), int128(7) / int128(-3));
+  EXPECT_EQ(int128(1), int128(7) % int128(-3));
+  EXPECT_EQ(int128(2), int128(-7) / int128(-3));
+
+  // The one quotient that doesn't fit wraps
+  EXPECT_EQ(min_value, min_value / int128(-1));
+  EXPECT_EQ(int128(0), min_value % int128(-1));
+
+  int128 x = int128(100);
+  x /= int128(7);
+  EXPECT_EQ(int128(14), x);
+  x %= int128(4);
+  EXPECT_EQ(int128(2), x);
+
+  EXPECT_THROW(int128(1) / int128(0), zero_division_error);
+  EXPECT_THROW(int128(1) % int128(0), zero_division_error);
+}
+
+TEST(Int128, Shift)
+{
+  EXPECT_EQ(int128(1ULL, 0ULL), int128(1) << 64);
+  EXPECT_EQ(int128(0x8000000000000000ULL, 0ULL), int128(1) << 127);
+  EXPECT_EQ(int128(-1), int128(-16) >> 100);
+  EXPECT_EQ(int128(-4), int128(-16) >> 2);
+  EXPECT_EQ(int128(1), int128(1ULL, 0ULL) >> 64);
+}
+
+TEST(Int128, Overflow)
+{
+  const int128 min_value = std::numeric_limits<int128>::min();
+  const int128 max_value = std::numeric_limits<int128>::max();
+  int128 out;
+
+  EXPECT_FALSE(add_overflow(max_value - int128(1), int128(1), out));
+  EXPECT_EQ(max_value, out);
+  EXPECT_TRUE(add_overflow(max_value, int128(1), out));
+  EXPECT_EQ(min_value, out);
+  EXPECT_TRUE(add_overflow(min_value, int128(-1), out));
+
+  EXPECT_FALSE(sub_overflow(min_value + int128(1), int128(1), out));
+  EXPECT_EQ(min_value, out);
+  EXPECT_TRUE(sub_overflow(min_value, int128(1), out));
+  EXPECT_TRUE(sub_overflow(int128(0), min_value, out));
+
+  EXPECT_FALSE(mul_overflow(int128(-1), max_value, out));
+  EXPECT_EQ(min_value + int128(1), out);
+  EXPECT_TRUE(mul_overflow(int128(-1), min_value, out));
+  EXPECT_TRUE(mul_overflow(int128(1ULL, 0ULL), int128(1ULL, 0ULL), out));
+  EXPECT_FALSE(mul_overflow(int128(0x4000000000000000ULL, 0ULL), int128(-2), out));
+  EXPECT_EQ(min_value, out);
+}
+
+// multiply and divrem are the fallback for compilers without a 128-bit
+// integer, so they are called directly here rather than through the operators
+TEST(Int128, PortableMultiply)
+{
+  const int128 min_value = std::numeric_limits<int128>::min();
+  const int128 n(0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+  const int128 m(0ULL, 0xfedcba9876543210ULL);
+
+  EXPECT_EQ(int128(-6), int128(-2).multiply(int128(3)));
+  EXPECT_EQ(int128(6), int128(-2).multiply(int128(-3)));
+  EXPECT_EQ(int128(1), int128(-1).multiply(int128(-1)));
+  // Carries out of the low word
+  EXPECT_EQ(int128(0x1ff19927ae3de7bcULL, 0xdeec6cd7a44a4100ULL), n.multiply(m));
+  EXPECT_EQ(int128(0xe00e66d851c21843ULL, 0x211393285bb5bf00ULL), (-n).multiply(m));
+  EXPECT_EQ("-85070591730234615856620279821087277056",
+            to_string(int128(-9223372036854775807LL - 1).multiply(int128(9223372036854775807LL))));
+  // Wraps like the operator
+  EXPECT_EQ(min_value, min_value.multiply(int128(-1)));
+  EXPECT_EQ(n * m, n.multiply(m));
+}
+
+TEST(Int128, PortableDivide)
+{
+  const int128 min_value = std::numeric_limits<int128>::min();
+  const int128 n(0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+  int128 q, r;
+
+  // The signs of the quotient and remainder follow the builtin integers
+  int128(-7).divrem(int128(3), q, r);
+  EXPECT_EQ(int128(-2), q);
+  EXPECT_EQ(int128(-1), r);
+  int128(7).divrem(int128(-3), q, r);
+  EXPECT_EQ(int128(-2), q);
+  EXPECT_EQ(int128(1), r);
+  int128(-7).divrem(int128(-3), q, r);
+  EXPECT_EQ(int128(2), q);
+  EXPECT_EQ(int128(-1), r);
+
+  // Divisors wider than 32 and 64 bits take the shift-subtract path
+  n.divrem(int128(0ULL, 0x123456789ULL), q, r);
+  EXPECT_EQ(int128(0x1000000ULL, 0x96ffffef5910ffULL), q);
+  EXPECT_EQ(int128(0ULL, 0x118188099ULL), r);
+  n.divrem(int128(1ULL, 3ULL), q, r);
+  EXPECT_EQ(int128(0ULL, 0x123456789abcdefULL), q);
+  EXPECT_EQ(int128(0ULL, 0xfb72ea61d950c843ULL), r);
+  (-n).divrem(int128(1ULL, 3ULL), q, r);
+  EXPECT_EQ(-int128(0ULL, 0x123456789abcdefULL), q);
+  EXPECT_EQ(-int128(0ULL, 0xfb72ea61d950c843ULL), r);
+  EXPECT_EQ(int128(0ULL, 0x123456789abcdefULL), n / int128(1ULL, 3ULL));
+
+  // The one quotient that doesn't fit wraps
+  min_value.divrem(int128(-1), q, r);
+  EXPECT_EQ(min_value, q);
+  EXPECT_EQ(int128(0), r);
+
+  EXPECT_THROW(int128(1).divrem(int128(0), q, r), zero_division_error);
+}
+
+TEST(Int128, ToFloat)
+{
+  EXPECT_EQ(-9.0, static_cast<double>(int128(-9)));
+  EXPECT_EQ(-9.0f, static_cast<float>(int128(-9)));
+  EXPECT_EQ(-std::ldexp(1.0, 127), static_cast<double>(std::numeric_limits<int128>::min()));
+
+  // 2^64 + 2^63 + 2049 rounds up to the next float64, but rounding the low
+  // word first would leave a tie that rounds down to 2^64 + 2^63
+  const int128 x(1ULL, 0x8000000000000801ULL);
+  EXPECT_EQ(std::ldexp(3.0, 63) + 4096.0, static_cast<double>(x));
+  EXPECT_EQ(-(std::ldexp(3.0, 63) + 4096.0), static_cast<double>(-x));
+}
+
+TEST(UInt128, Arithmetic)
+{
+  const uint128 max_value = std::numeric_limits<uint128>::max();
+  EXPECT_EQ(uint128(0ULL, 0xffffffffffffffffULL), uint128(1ULL, 0ULL) - uint128(1));
+  EXPECT_EQ(max_value, uint128(0) - uint128(1));
+  EXPECT_EQ(max_value, -uint128(1));
+  EXPECT_TRUE(!uint128(0));
+  EXPECT_FALSE(!uint128(1ULL, 0ULL));
+
+  uint128 big = uint128(18446744073709551557ULL) * uint128(18446744073709551533ULL);
+  EXPECT_EQ("340282366920938460843936948965011886881", to_string(big));
+  EXPECT_EQ(uint128(18446744073709551557ULL), big / uint128(18446744073709551533ULL));
+  EXPECT_EQ(uint128(7), (big + uint128(7)) % uint128(18446744073709551533ULL));
+  EXPECT_EQ(uint128(1ULL, 0ULL), (max_value >> 127) << 64);
+
+  uint128 x = uint128(5);
+  x += 3u;
+  x *= uint128(10);
+  EXPECT_EQ(uint128(80), x);
+  x /= uint128(6);
+  EXPECT_EQ(uint128(13), x);
+
+  EXPECT_THROW(uint128(1) / uint128(0), zero_division_error);
+}
+
+TEST(UInt128, ToFloat)
+{
+  EXPECT_EQ(std::ldexp(1.0, 128), static_cast<double>(std::numeric_limits<uint128>::max()));
+  EXPECT_EQ(std::numeric_limits<float>::infinity(), static_cast<float>(std::numeric_limits<uint128>::max()));
+
+  // 2^127 + 2^74 is a tie that rounds to even, anything above it rounds up
+  EXPECT_EQ(std::ldexp(1.0, 127), static_cast<double>(uint128(0x8000000000000400ULL, 0ULL)));
+  EXPECT_EQ(std::ldexp(1.0, 127) + std::ldexp(1.0, 75), static_cast<double>(uint128(0x8000000000000400ULL, 1ULL)));
+  EXPECT_EQ(std::ldexp(1.0, 64) + std::ldexp(1.0, 12), static_cast<double>(uint128(1ULL, 0x0000000000000801ULL)));
+}
+
+TEST(UInt128, PortableMultiplyDivide)
+{
+  const uint128 max_value = std::numeric_limits<uint128>::max();
+  const uint128 n(0x0123456789abcdefULL, 0xfedcba9876543210ULL);
+  uint128 q, r;
+
+  // (2^64 - 1)^2 carries into every word of the result
+  EXPECT_EQ(uint128(0xfffffffffffffffeULL, 1ULL),
+            uint128(0xffffffffffffffffULL).multiply(uint128(0xffffffffffffffffULL)));
+  EXPECT_EQ(uint128(1), max_value.multiply(max_value));
+  EXPECT_EQ(uint128(0x1ff19927ae3de7bcULL, 0xdeec6cd7a44a4100ULL), n.multiply(uint128(0xfedcba9876543210ULL)));
+
+  n.divrem(uint128(0xfedcba9876543210ULL), q, r);
+  EXPECT_EQ(uint128(0ULL, 0x124924924924924ULL), q);
+  EXPECT_EQ(uint128(0ULL, 0x7e3649cb031697d0ULL), r);
+  max_value.divrem(max_value, q, r);
+  EXPECT_EQ(uint128(1), q);
+  EXPECT_EQ(uint128(0), r);
+  uint128(5).divrem(uint128(1ULL, 0ULL), q, r);
+  EXPECT_EQ(uint128(0), q);
+  EXPECT_EQ(uint128(5), r);
+
+  EXPECT_THROW(uint128(1).divrem(uint128(0), q, r), zero_division_error);
+}
+
+TEST(UInt128, Overflow)
+{
+  const uint128 max_value = std::numeric_limits<uint128>::max();
+  uint128 out;
+  EXPECT_TRUE(add_overflow(max_value, uint128(1), out));
+  EXPECT_EQ(uint128(0), out);
+  EXPECT_FALSE(add_overflow(max_value - uint128(1), uint128(1), out));
+  EXPECT_TRUE(sub_overflow(uint128(0), uint128(1), out));
+  EXPECT_FALSE(mul_overflow(uint128(0xffffffffffffffffULL), uint128(0xffffffffffffffffULL), out));
+  EXPECT_TRUE(mul_overflow(uint128(1ULL, 0ULL), uint128(1ULL, 0ULL), out));
+}
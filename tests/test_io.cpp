@@ -5,11 +5,15 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
 
 #include <dynd/gtest.hpp>
 #include <dynd/io.hpp>
+#include <dynd/json_formatter.hpp>
+#include <dynd/json_parser.hpp>
 
 using namespace std;
 using namespace dynd;
@@ -23,3 +27,121 @@ TEST(Serialize, FixedDimFixedDim) {
   EXPECT_ARRAY_EQ(bytes("\x00\x00\x00\x00\x01\x00\x00\x00\x02\x00\x00\x00\x03\x00\x00\x00"),
                   nd::serialize(nd::array{{0, 1}, {2, 3}}));
 }
+
+TEST(BinaryContainer, FixedDim) {
+  nd::array a = nd::array{{0.5, 1.5, 2.5}, {3.5, 4.5, 5.5}};
+  nd::save_binary("test_container.dynd", a);
+
+  nd::array b = nd::load_binary("test_container.dynd");
+  EXPECT_EQ(a.get_type(), b.get_type());
+  EXPECT_ARRAY_EQ(a, b);
+  // The data is read straight from the mapped file
+  EXPECT_FALSE((b.get_flags() & nd::write_access_flag) != 0);
+  EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(b.cdata()) % 64);
+
+  // Strided views are written in their default layout
+  nd::array c = a(irange(), irange().by(2));
+  nd::save_binary("test_container.dynd", c);
+  b = nd::load_binary("test_container.dynd");
+  EXPECT_ARRAY_EQ(c, b);
+
+  b = nd::array();
+  remove("test_container.dynd");
+}
+
+TEST(BinaryContainer, VarDim) {
+  nd::array a = parse_json("3 * var * var * int32", "[[[1, 2, 3], []], [], [[4], [5, 6]]]");
+  nd::save_binary("test_container.dynd", a);
+
+  nd::array b = nd::load_binary("test_container.dynd");
+  EXPECT_EQ(a.get_type(), b.get_type());
+  stringstream expected, actual;
+  format_json(expected, a);
+  format_json(actual, b);
+  EXPECT_EQ(expected.str(), actual.str());
+  EXPECT_EQ(6, b(2, 1, 1).as<int>());
+
+  b = nd::array();
+  remove("test_container.dynd");
+}
+
+TEST(BinaryContainer, String) {
+  nd::array a = nd::array{"a", "this string is too long for the small string optimization", ""};
+  nd::save_binary("test_container.dynd", a);
+
+  nd::array b = nd::load_binary("test_container.dynd");
+  EXPECT_EQ(a.get_type(), b.get_type());
+  EXPECT_ARRAY_EQ(a, b);
+
+  b = nd::array();
+  remove("test_container.dynd");
+}
+
+TEST(BinaryContainer, Struct) {
+  nd::array a = nd::empty(ndt::type("2 * {x: int8, y: float64, name: string, v: var * int16}"));
+  a(0).p("x").vals() = 1;
+  a(0).p("y").vals() = 2.5;
+  a(0).p("name").vals() = "first";
+  a(0).p("v").vals() = nd::array{1, 2};
+  a(1).p("x").vals() = 3;
+  a(1).p("y").vals() = 4.5;
+  a(1).p("name").vals() = "second";
+  a(1).p("v").vals() = nd::array{3};
+  nd::save_binary("test_container.dynd", a);
+
+  nd::array b = nd::load_binary("test_container.dynd");
+  EXPECT_EQ(a.get_type(), b.get_type());
+  EXPECT_EQ("second", b(1).p("name").as<std::string>());
+  EXPECT_EQ(4.5, b(1).p("y").as<double>());
+  EXPECT_EQ(2, b(0).p("v")(1).as<int>());
+
+  b = nd::array();
+  remove("test_container.dynd");
+}
+
+TEST(BinaryContainer, Errors) {
+  {
+    ofstream f("test_container.dynd", ios::binary);
+    f << "this is not a binary container, but it is long enough to hold a header";
+  }
+  EXPECT_THROW(nd::load_binary("test_container.dynd"), runtime_error);
+  remove("test_container.dynd");
+
+  EXPECT_THROW(nd::load_binary("test_container_missing.dynd"), runtime_error);
+}
+
+namespace {
+
+// Overwrites a uint64 in the data section of a saved binary container
+void patch_container_data(const char *filename, uint64_t data_pos, uint64_t value) {
+  fstream f(filename, ios::binary | ios::in | ios::out);
+  uint64_t data_offset;
+  // The data section offset follows the magic, version, byte order and datashape section
+  f.seekg(32);
+  f.read(reinterpret_cast<char *>(&data_offset), sizeof(data_offset));
+  f.seekp(data_offset + data_pos);
+  f.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+} // anonymous namespace
+
+TEST(BinaryContainer, CorruptMappedVarDim) {
+  nd::array a = parse_json("2 * 3 * var * int32", "[[[1, 2], [], [3]], [[4], [5, 6, 7], []]]");
+
+  // A var_dim size reaching past the end of the heap section
+  nd::save_binary("test_container.dynd", a);
+  patch_container_data("test_container.dynd", 8, uint64_t(1) << 40);
+  EXPECT_THROW(nd::load_binary("test_container.dynd"), runtime_error);
+
+  // A var_dim begin offset past the end of the heap section, in a later element
+  nd::save_binary("test_container.dynd", a);
+  patch_container_data("test_container.dynd", 4 * 16, uint64_t(1) << 20);
+  EXPECT_THROW(nd::load_binary("test_container.dynd"), runtime_error);
+
+  // A var_dim begin offset misaligned for its elements
+  nd::save_binary("test_container.dynd", a);
+  patch_container_data("test_container.dynd", 0, 1);
+  EXPECT_THROW(nd::load_binary("test_container.dynd"), runtime_error);
+
+  remove("test_container.dynd");
+}
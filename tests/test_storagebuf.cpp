@@ -0,0 +1,73 @@
+//
+// Copyright (C) 2011-16 DyND Developers
+// BSD 2-Clause License, see LICENSE.txt
+//
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+
+#include <dynd/callables/call_graph.hpp>
+#include <dynd/gtest.hpp>
+#include <dynd/kernels/base_strided_kernel.hpp>
+#include <dynd/kernels/kernel_builder.hpp>
+
+using namespace std;
+using namespace dynd;
+
+namespace {
+
+struct table_kernel : nd::base_strided_kernel<table_kernel, 0> {
+  aligned_kernel_storage<32 * sizeof(int32_t)> table;
+
+  table_kernel() {
+    int32_t *values = reinterpret_cast<int32_t *>(table.get());
+    for (int32_t i = 0; i < 32; ++i) {
+      values[i] = i * i;
+    }
+  }
+
+  void single(char *dst, char *const *DYND_UNUSED(src)) {
+    const int32_t *values = reinterpret_cast<const int32_t *>(table.get());
+    int32_t sum = 0;
+    for (int32_t i = 0; i < 32; ++i) {
+      sum += values[i];
+    }
+    *reinterpret_cast<int32_t *>(dst) = sum;
+  }
+};
+
+bool is_aligned(const void *ptr) { return reinterpret_cast<uintptr_t>(ptr) % storagebuf_alignment == 0; }
+
+} // anonymous namespace
+
+TEST(StorageBuf, Alignment) {
+  nd::kernel_builder kb;
+  EXPECT_TRUE(is_aligned(kb.get()));
+
+  kb.emplace_back(8);
+  // Without a call graph, place the kernel with the storagebuf directly
+  kb.storagebuf<nd::kernel_prefix, nd::kernel_builder>::emplace_back<table_kernel>(kernel_request_single);
+  const table_kernel *k = kb.get_at<table_kernel>(8);
+  EXPECT_TRUE(is_aligned(k->table.get()));
+
+  // Growing to the heap keeps the buffer aligned, so the table is still in place
+  kb.emplace_back(10 * kb.capacity());
+  EXPECT_TRUE(is_aligned(kb.get()));
+  k = kb.get_at<table_kernel>(8);
+  EXPECT_TRUE(is_aligned(k->table.get()));
+
+  int32_t sum = 0;
+  kb.get_at<table_kernel>(8)->single(reinterpret_cast<char *>(&sum), NULL);
+  EXPECT_EQ(10416, sum);
+}
+
+TEST(StorageBuf, SizeHint) {
+  nd::kernel_builder kb(nullptr, 4096);
+  EXPECT_LE(4096u, kb.capacity());
+  EXPECT_EQ(0u, kb.capacity() % storagebuf_alignment);
+  EXPECT_TRUE(is_aligned(kb.get()));
+
+  nd::call_graph cg;
+  EXPECT_EQ(0u, cg.kernel_size_hint());
+}
@@ -3,191 +3,145 @@
 // BSD 2-Clause License, see LICENSE.txt
 //
 
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
-#include "inc_gtest.hpp"
 
 #include <dynd/array.hpp>
+#include <dynd/array_range.hpp>
+#include <dynd/gtest.hpp>
+#include <dynd/types/categorical_kind_type.hpp>
 #include <dynd/types/categorical_type.hpp>
 #include <dynd/types/fixed_string_type.hpp>
 #include <dynd/types/string_type.hpp>
-#include <dynd/types/convert_type.hpp>
-#include <dynd/array_range.hpp>
-#include <dynd/func/comparison.hpp>
 
 using namespace std;
 using namespace dynd;
 
-TEST(CategoricalType, Create)
-{
-  const char *a_vals[] = {"foo", "bar", "baz"};
-  nd::array a = nd::empty(3, ndt::make_type<ndt::string_type>());
-  a.vals() = a_vals;
+TEST(CategoricalType, Create) {
+  nd::array a = nd::array{"foo", "bar", "baz"};
 
   ndt::type d;
-  d = ndt::categorical_type::make(a);
+  d = ndt::make_type<ndt::categorical_type>(a);
   EXPECT_EQ(categorical_id, d.get_id());
-  EXPECT_EQ(scalar_kind_id, d.get_base_id());
+  EXPECT_EQ(categorical_kind_id, d.get_base_id());
+  EXPECT_EQ(scalar_kind_id, ndt::make_type<ndt::categorical_kind_type>().get_base_id());
   EXPECT_EQ(1u, d.get_data_alignment());
   EXPECT_EQ(1u, d.get_data_size());
   EXPECT_FALSE(d.is_expression());
-  EXPECT_EQ(ndt::make_type<uint8_t>(), d.p("storage_type").as<ndt::type>());
-  EXPECT_EQ(a.get_dtype(), d.p("category_type").as<ndt::type>());
+  EXPECT_EQ(ndt::make_type<uint8_t>(), d.p<ndt::type>("storage_type"));
+  EXPECT_EQ(a.get_dtype(), d.p<ndt::type>("category_type"));
 
   // With <= 256 categories, storage is a uint8
-  a = nd::range(256);
-  d = ndt::categorical_type::make(a);
+  a = nd::old_range(int32_t(256));
+  d = ndt::make_type<ndt::categorical_type>(a);
   EXPECT_EQ(1u, d.get_data_alignment());
   EXPECT_EQ(1u, d.get_data_size());
-  EXPECT_EQ(ndt::make_type<uint8_t>(), d.p("storage_type").as<ndt::type>());
-  EXPECT_EQ(ndt::make_type<int32_t>(), d.p("category_type").as<ndt::type>());
+  EXPECT_EQ(ndt::make_type<uint8_t>(), d.p<ndt::type>("storage_type"));
+  EXPECT_EQ(ndt::make_type<int32_t>(), d.p<ndt::type>("category_type"));
 
   // With <= 65536 categories, storage is a uint16
-  a = nd::range(257);
-  d = ndt::categorical_type::make(a);
+  a = nd::old_range(int32_t(257));
+  d = ndt::make_type<ndt::categorical_type>(a);
   EXPECT_EQ(2u, d.get_data_alignment());
   EXPECT_EQ(2u, d.get_data_size());
-  a = nd::range(65536);
-  d = ndt::categorical_type::make(a);
+  a = nd::old_range(int32_t(65536));
+  d = ndt::make_type<ndt::categorical_type>(a);
   EXPECT_EQ(2u, d.get_data_alignment());
   EXPECT_EQ(2u, d.get_data_size());
-  EXPECT_EQ(ndt::make_type<uint16_t>(), d.p("storage_type").as<ndt::type>());
-  EXPECT_EQ(ndt::make_type<int32_t>(), d.p("category_type").as<ndt::type>());
+  EXPECT_EQ(ndt::make_type<uint16_t>(), d.p<ndt::type>("storage_type"));
+  EXPECT_EQ(ndt::make_type<int32_t>(), d.p<ndt::type>("category_type"));
 
   // Otherwise, storage is a uint32
-  a = nd::range(65537);
-  d = ndt::categorical_type::make(a);
+  a = nd::old_range(int32_t(65537));
+  d = ndt::make_type<ndt::categorical_type>(a);
   EXPECT_EQ(4u, d.get_data_alignment());
   EXPECT_EQ(4u, d.get_data_size());
-  EXPECT_EQ(ndt::make_type<uint32_t>(), d.p("storage_type").as<ndt::type>());
-  EXPECT_EQ(ndt::make_type<int32_t>(), d.p("category_type").as<ndt::type>());
+  EXPECT_EQ(ndt::make_type<uint32_t>(), d.p<ndt::type>("storage_type"));
+  EXPECT_EQ(ndt::make_type<int32_t>(), d.p<ndt::type>("category_type"));
 }
 
-TEST(CategoricalType, Convert)
-{
-  const char *a_vals[] = {"foo", "bar", "baz"};
-  nd::array a = nd::empty(3, ndt::fixed_string_type::make(3, string_encoding_ascii));
-  a.vals() = a_vals;
-
-  ndt::type cd = ndt::categorical_type::make(a);
-  ndt::type sd = ndt::make_type<ndt::string_type>();
-
-  // String conversions report false, so that assignments encodings
-  // get validated on assignment
-  EXPECT_FALSE(is_lossless_assignment(sd, cd));
-  EXPECT_FALSE(is_lossless_assignment(cd, sd));
+TEST(CategoricalType, Compare) {
+  nd::array a = nd::array{"foo", "bar", "baz"};
+  nd::array b = nd::array{"foo", "bar"};
 
-  // This operation was crashing, hence the test
-  ndt::type cvt = ndt::convert_type::make(sd, cd);
-  EXPECT_EQ(cd, cvt.operand_type());
-  EXPECT_EQ(sd, cvt.value_type());
-}
-
-TEST(CategoricalType, Compare)
-{
-  const char *a_vals[] = {"foo", "bar", "baz"};
-  nd::array a = nd::empty(3, ndt::make_type<ndt::string_type>());
-  a.vals() = a_vals;
-
-  const char *b_vals[] = {"foo", "bar"};
-  nd::array b = nd::empty(2, ndt::make_type<ndt::string_type>());
-  b.vals() = b_vals;
-
-  ndt::type da = ndt::categorical_type::make(a);
-  ndt::type da2 = ndt::categorical_type::make(a);
-  ndt::type db = ndt::categorical_type::make(b);
+  ndt::type da = ndt::make_type<ndt::categorical_type>(a);
+  ndt::type da2 = ndt::make_type<ndt::categorical_type>(a);
+  ndt::type db = ndt::make_type<ndt::categorical_type>(b);
 
   EXPECT_EQ(da, da);
   EXPECT_EQ(da, da2);
   EXPECT_NE(da, db);
 
-  nd::array i = nd::empty(3, ndt::make_type<int32_t>());
-  i(0).vals() = 0;
-  i(1).vals() = 10;
-  i(2).vals() = 100;
+  nd::array i = nd::array{0, 10, 100};
 
-  ndt::type di = ndt::categorical_type::make(i);
+  ndt::type di = ndt::make_type<ndt::categorical_type>(i);
   EXPECT_FALSE(da == di);
 }
 
-TEST(CategoricalType, Unique)
-{
-  const char *a_vals[] = {"foo", "bar", "foo"};
-  nd::array a = nd::empty(3, ndt::fixed_string_type::make(3, string_encoding_ascii));
-  a.vals() = a_vals;
+TEST(CategoricalType, Unique) {
+  nd::array a = nd::empty(3, ndt::make_type<ndt::fixed_string_type>(3, string_encoding_ascii));
+  a.assign(nd::array{"foo", "bar", "foo"});
 
-  EXPECT_THROW(ndt::categorical_type::make(a), std::runtime_error);
+  EXPECT_THROW(ndt::make_type<ndt::categorical_type>(a), std::runtime_error);
 
-  int i_vals[] = {0, 10, 10};
-  nd::array i = i_vals;
+  nd::array i = nd::array{0, 10, 10};
 
-  EXPECT_THROW(ndt::categorical_type::make(i), std::runtime_error);
+  EXPECT_THROW(ndt::make_type<ndt::categorical_type>(i), std::runtime_error);
+
+  // +0.0 and -0.0 are the same category
+  EXPECT_THROW(ndt::make_type<ndt::categorical_type>(nd::array{0.0, 1.0, -0.0}), std::runtime_error);
 }
 
-TEST(CategoricalType, FactorFixedString)
-{
-  const char *string_cats_vals[] = {"bar", "foo"};
-  nd::array string_cats = nd::empty(2, ndt::make_type<ndt::string_type>());
-  string_cats.vals() = string_cats_vals;
+TEST(CategoricalType, FactorFixedString) {
+  nd::array string_cats = nd::empty(2, ndt::make_type<ndt::fixed_string_type>(3, string_encoding_ascii));
+  string_cats.assign(nd::array{"bar", "foo"});
 
-  const char *a_vals[] = {"foo", "bar", "foo"};
-  nd::array a = nd::empty(3, ndt::make_type<ndt::string_type>());
-  a.vals() = a_vals;
+  nd::array a = nd::empty(3, ndt::make_type<ndt::fixed_string_type>(3, string_encoding_ascii));
+  a.assign(nd::array{"foo", "bar", "foo"});
 
   ndt::type da = ndt::factor_categorical(a);
-  EXPECT_EQ(ndt::categorical_type::make(string_cats), da);
+  EXPECT_EQ(ndt::make_type<ndt::categorical_type>(string_cats), da);
 }
 
-TEST(CategoricalType, FactorString)
-{
-  const char *cats_vals[] = {"bar", "foo", "foot"};
-  const char *a_vals[] = {"foo", "bar", "foot", "foo", "bar"};
-  nd::array cats = cats_vals, a = a_vals;
+TEST(CategoricalType, FactorString) {
+  nd::array cats = nd::array{"bar", "foo", "foot"};
+  nd::array a = nd::array{"foo", "bar", "foot", "foo", "bar"};
 
   ndt::type da = ndt::factor_categorical(a);
-  EXPECT_EQ(ndt::categorical_type::make(cats), da);
+  EXPECT_EQ(ndt::make_type<ndt::categorical_type>(cats), da);
 }
 
-TEST(CategoricalType, FactorStringLonger)
-{
-  const char *cats_vals[] = {"a", "abcdefghijklmnopqrstuvwxyz", "bar", "foo", "foot", "z"};
-  const char *a_vals[] = {"foo",
-                          "bar",
-                          "foot",
-                          "foo",
-                          "bar",
-                          "abcdefghijklmnopqrstuvwxyz",
-                          "foot",
-                          "foo",
-                          "z",
-                          "a",
-                          "abcdefghijklmnopqrstuvwxyz"};
-  ndt::type da = ndt::factor_categorical(a_vals);
-  EXPECT_EQ(ndt::categorical_type::make(cats_vals), da);
+TEST(CategoricalType, FactorStringLonger) {
+  nd::array cats = nd::array{"a", "abcdefghijklmnopqrstuvwxyz", "bar", "foo", "foot", "z"};
+  nd::array a = nd::array{"foo", "bar", "foot", "foo", "bar", "abcdefghijklmnopqrstuvwxyz",
+                          "foot", "foo", "z", "a", "abcdefghijklmnopqrstuvwxyz"};
+  ndt::type da = ndt::factor_categorical(a);
+  EXPECT_EQ(ndt::make_type<ndt::categorical_type>(cats), da);
 }
 
-TEST(CategoricalType, FactorInt)
-{
-  int int_cats_vals[] = {0, 10};
-  nd::array int_cats = nd::empty(2, ndt::make_type<int32_t>());
-  int_cats.vals() = int_cats_vals;
-
-  int i_vals[] = {10, 10, 0};
-  nd::array i = nd::empty(3, ndt::make_type<int32_t>());
-  i.vals() = i_vals;
+TEST(CategoricalType, FactorInt) {
+  nd::array int_cats = nd::array{0, 10};
+  nd::array i = nd::array{10, 10, 0};
 
   ndt::type di = ndt::factor_categorical(i);
-  EXPECT_EQ(ndt::categorical_type::make(int_cats), di);
+  EXPECT_EQ(ndt::make_type<ndt::categorical_type>(int_cats), di);
+
+  // Enough distinct values to grow the hash table several times
+  nd::array many = nd::empty(3000, ndt::make_type<int32_t>());
+  for (int32_t j = 0; j < 3000; ++j) {
+    many(j).assign((j * 7919) % 1000);
+  }
+  EXPECT_EQ(ndt::make_type<ndt::categorical_type>(nd::old_range(int32_t(1000))), ndt::factor_categorical(many));
 }
 
-TEST(CategoricalType, Values)
-{
-  const char *a_vals[] = {"foo", "bar", "baz"};
-  nd::array a = nd::empty(3, ndt::fixed_string_type::make(3, string_encoding_ascii));
-  a.vals() = a_vals;
+TEST(CategoricalType, Values) {
+  nd::array a = nd::empty(3, ndt::make_type<ndt::fixed_string_type>(3, string_encoding_ascii));
+  a.assign(nd::array{"foo", "bar", "baz"});
 
-  ndt::type dt = ndt::categorical_type::make(a);
+  ndt::type dt = ndt::make_type<ndt::categorical_type>(a);
 
   EXPECT_EQ(0u, static_cast<const ndt::categorical_type *>(dt.extended())->get_value_from_category(a(0)));
   EXPECT_EQ(1u, static_cast<const ndt::categorical_type *>(dt.extended())->get_value_from_category(a(1)));
@@ -203,107 +157,139 @@ TEST(CategoricalType, Values)
                std::runtime_error);
 }
 
-/*
-TEST(CategoricalType, ValuesLonger)
-{
-  const char *cats_vals[] = {"foo", "abcdefghijklmnopqrstuvwxyz", "z", "bar", "a", "foot"};
-  const char *a_vals[] = {"foo", "z",    "abcdefghijklmnopqrstuvwxyz", "z",                          "bar",
-                          "a",   "foot", "a",                          "abcdefghijklmnopqrstuvwxyz", "foo",
-                          "bar", "foo",  "foot"};
+TEST(CategoricalType, ValuesMany) {
+  // Strings longer than the small string buffer, in an order unrelated to
+  // the sorted one
+  const int count = 5000;
+  nd::array cats = nd::empty(count, ndt::make_type<ndt::string_type>());
+  for (int i = 0; i < count; ++i) {
+    cats(i).assign("category number " + std::to_string((i * 7919) % count));
+  }
+  ndt::type dt = ndt::make_type<ndt::categorical_type>(cats);
+  const ndt::categorical_type *cat_tp = static_cast<const ndt::categorical_type *>(dt.extended());
+  EXPECT_EQ(ndt::make_type<uint16_t>(), cat_tp->get_storage_type());
+
+  for (int i = 0; i < count; ++i) {
+    ASSERT_EQ(static_cast<uint32_t>(i), cat_tp->get_value_from_category(cats(i)));
+  }
+  EXPECT_THROW(cat_tp->get_value_from_category("category number 5000"), std::runtime_error);
+
+  ndt::type double_dt = ndt::make_type<ndt::categorical_type>(nd::array{2.5, -1.0, 0.0});
+  cat_tp = static_cast<const ndt::categorical_type *>(double_dt.extended());
+  EXPECT_EQ(2u, cat_tp->get_value_from_category(nd::array(-0.0)));
+  EXPECT_EQ(1u, cat_tp->get_value_from_category(nd::array(-1.0)));
+}
+
+TEST(CategoricalType, Convert) {
+  nd::array a = nd::empty(3, ndt::make_type<ndt::fixed_string_type>(3, string_encoding_ascii));
+  a.assign(nd::array{"foo", "bar", "baz"});
+
+  ndt::type cd = ndt::make_type<ndt::categorical_type>(a);
+  ndt::type sd = ndt::make_type<ndt::string_type>();
+
+  // String conversions report false, so that assignments encodings
+  // get validated on assignment
+  EXPECT_FALSE(is_lossless_assignment(sd, cd));
+  EXPECT_FALSE(is_lossless_assignment(cd, sd));
+
+  // Round trip through the categorical
+  nd::array c = nd::empty(3, cd);
+  c.assign(nd::array{"baz", "foo", "bar"});
+  nd::array s = nd::empty(3, sd);
+  s.assign(c);
+  EXPECT_EQ("baz", s(0).as<std::string>());
+  EXPECT_EQ("foo", s(1).as<std::string>());
+  EXPECT_EQ("bar", s(2).as<std::string>());
+}
+
+TEST(CategoricalType, ValuesLonger) {
+  nd::array cats = nd::array{"foo", "abcdefghijklmnopqrstuvwxyz", "z", "bar", "a", "foot"};
+  nd::array a_vals = nd::array{"foo", "z",   "abcdefghijklmnopqrstuvwxyz", "z",   "bar", "a",   "foot",
+                               "a",   "abcdefghijklmnopqrstuvwxyz", "foo", "bar", "foo", "foot"};
   uint32_t a_uints[] = {0, 2, 1, 2, 3, 4, 5, 4, 1, 0, 3, 0, 5};
-  int cats_count = sizeof(cats_vals) / sizeof(cats_vals[0]);
-  int a_count = sizeof(a_uints) / sizeof(a_uints[0]);
+  intptr_t cats_count = cats.get_dim_size();
+  intptr_t a_count = a_vals.get_dim_size();
 
-  ndt::type dt = ndt::categorical_type::make(cats_vals);
-  nd::array a = nd::array(a_vals).ucast(dt).eval();
-  nd::array a_view = a.p("ints");
+  ndt::type dt = ndt::make_type<ndt::categorical_type>(cats);
+  const ndt::categorical_type *cat_tp = static_cast<const ndt::categorical_type *>(dt.extended());
+  nd::array a = nd::empty(a_count, dt);
+  a.assign(a_vals);
 
   // Check that the categories got the right values
-  for (int i = 0; i < cats_count; ++i) {
-    EXPECT_EQ((uint32_t)i,
-              static_cast<const ndt::categorical_type *>(dt.extended())->get_value_from_category(cats_vals[i]));
+  for (intptr_t i = 0; i < cats_count; ++i) {
+    EXPECT_EQ(static_cast<uint32_t>(i), cat_tp->get_value_from_category(cats(i)));
   }
   // Check that everything in 'a' is right
-  for (int i = 0; i < a_count; ++i) {
-    EXPECT_EQ(a_vals[i], a(i).as<std::string>());
-    EXPECT_EQ(a_uints[i], a_view(i).as<uint32_t>());
+  for (intptr_t i = 0; i < a_count; ++i) {
+    EXPECT_EQ(a_vals(i).as<std::string>(), a(i).as<std::string>());
+    EXPECT_EQ(a_uints[i], cat_tp->get_value(a(i).cdata()));
   }
 }
 
-TEST(CategoricalType, AssignFixedString)
-{
-  const char *cat_vals[] = {"foo", "bar", "baz"};
-  nd::array cat = nd::empty(3, ndt::fixed_string_type::make(3, string_encoding_ascii));
-  cat.vals() = cat_vals;
+TEST(CategoricalType, AssignFixedString) {
+  nd::array cat = nd::empty(3, ndt::make_type<ndt::fixed_string_type>(3, string_encoding_ascii));
+  cat.assign(nd::array{"foo", "bar", "baz"});
 
-  ndt::type dt = ndt::categorical_type::make(cat);
+  ndt::type dt = ndt::make_type<ndt::categorical_type>(cat);
 
   nd::array a = nd::empty(3, dt);
-  a.val_assign(cat);
+  a.assign(cat);
   EXPECT_EQ("foo", a(0).as<std::string>());
   EXPECT_EQ("bar", a(1).as<std::string>());
   EXPECT_EQ("baz", a(2).as<std::string>());
-  a(0).vals() = cat(2);
+  a(0).assign(cat(2));
   EXPECT_EQ("baz", a(0).as<std::string>());
 
-  cat(0).vals() = "zzz";
-  EXPECT_THROW(a(0).vals() = cat(0), std::runtime_error);
+  cat(0).assign("zzz");
+  EXPECT_THROW(a(0).assign(cat(0)), std::runtime_error);
 
   nd::array tmp = nd::empty(3, cat.get_type().at(0));
-  tmp.val_assign(a);
+  tmp.assign(a);
   EXPECT_EQ("baz", tmp(0).as<std::string>());
   EXPECT_EQ("bar", tmp(1).as<std::string>());
   EXPECT_EQ("baz", tmp(2).as<std::string>());
-  tmp(0).vals() = a(1);
+  tmp(0).assign(a(1));
   EXPECT_EQ("bar", tmp(0).as<std::string>());
-  tmp(0).vals() = "foo";
+  tmp(0).assign("foo");
   EXPECT_EQ("foo", tmp(0).as<std::string>());
 }
 
-TEST(CategoricalType, AssignInt)
-{
-  int32_t cat_vals[] = {10, 100, 1000};
-  nd::array cat = cat_vals;
+TEST(CategoricalType, AssignInt) {
+  nd::array cat = nd::array{10, 100, 1000};
 
-  ndt::type dt = ndt::categorical_type::make(cat);
+  ndt::type dt = ndt::make_type<ndt::categorical_type>(cat);
 
   nd::array a = nd::empty(3, dt);
-  a.val_assign(cat);
+  a.assign(cat);
   EXPECT_EQ(10, a(0).as<int32_t>());
   EXPECT_EQ(100, a(1).as<int32_t>());
   EXPECT_EQ(1000, a(2).as<int32_t>());
-  a(0).vals() = cat(2);
+  a(0).assign(cat(2));
   EXPECT_EQ(1000, a(0).as<int32_t>());
 
-  // TODO implicit conversion?
-  // a(0).vals() = string("bar");
-  // cout << a << endl;
-
   nd::array tmp = nd::empty(3, cat.get_type().at(0));
-  tmp.val_assign(a);
+  tmp.assign(a);
   EXPECT_EQ(1000, tmp(0).as<int32_t>());
   EXPECT_EQ(100, tmp(1).as<int32_t>());
   EXPECT_EQ(1000, tmp(2).as<int32_t>());
-  tmp(0).vals() = a(1);
+  tmp(0).assign(a(1));
   EXPECT_EQ(100, tmp(0).as<int32_t>());
 }
 
-TEST(CategoricalType, AssignRange)
-{
-  const char *cat_vals[] = {"foo", "bar", "baz"};
-  nd::array cat = nd::empty(3, ndt::fixed_string_type::make(3, string_encoding_ascii));
-  cat.vals() = cat_vals;
+TEST(CategoricalType, AssignRange) {
+  nd::array cat = nd::empty(3, ndt::make_type<ndt::fixed_string_type>(3, string_encoding_ascii));
+  cat.assign(nd::array{"foo", "bar", "baz"});
 
-  ndt::type dt = ndt::categorical_type::make(cat);
+  ndt::type dt = ndt::make_type<ndt::categorical_type>(cat);
 
   nd::array a = nd::empty(9, dt);
   nd::array b = a(0 <= irange() < 3);
-  b.val_assign(cat);
+  b.assign(cat);
   nd::array c = a(3 <= irange() < 6);
-  c.val_assign(cat(0));
+  c.assign(cat(0));
   nd::array d = a(6 <= irange().by(2) < 9);
-  d.val_assign(cat(1));
-  a(7).vals() = cat(2);
+  d.assign(cat(1));
+  a(7).assign(cat(2));
 
   EXPECT_EQ("foo", a(0).as<std::string>());
   EXPECT_EQ("bar", a(1).as<std::string>());
@@ -316,24 +302,17 @@ TEST(CategoricalType, AssignRange)
   EXPECT_EQ("bar", a(8).as<std::string>());
 }
 
-TEST(CategoricalType, CategoriesProperty)
-{
-  const char *cats_vals[] = {"this", "is", "a", "test"};
-  nd::array cats = cats_vals;
-  ndt::type cd = ndt::categorical_type::make(cats_vals);
-  std::cout << cats << std::endl;
-  std::cout << cd.p("categories") << std::endl;
-  EXPECT_TRUE(cats.equals_exact(cd.p("categories")));
+TEST(CategoricalType, CategoriesProperty) {
+  nd::array cats = nd::array{"this", "is", "a", "test"};
+  ndt::type cd = ndt::make_type<ndt::categorical_type>(cats);
+  EXPECT_TRUE(cats.equals_exact(static_cast<const ndt::categorical_type *>(cd.extended())->get_categories()));
 }
 
-TEST(CategoricalType, AssignFromOther)
-{
-  int cats_values[] = {3, 6, 100, 1000};
-  ndt::type cd = ndt::categorical_type::make(cats_values);
-  int16_t a_values[] = {6, 3, 100, 3, 1000, 100, 6, 1000};
-  nd::array a = nd::array(a_values).ucast(cd);
-  EXPECT_EQ(ndt::make_fixed_dim(8, ndt::convert_type::make(cd, ndt::make_type<int16_t>())), a.get_type());
-  a = a.eval();
+TEST(CategoricalType, AssignFromOther) {
+  ndt::type cd = ndt::make_type<ndt::categorical_type>(nd::array{3, 6, 100, 1000});
+  nd::array a = nd::empty(8, cd);
+  a.assign(nd::array{int16_t(6), int16_t(3), int16_t(100), int16_t(3), int16_t(1000), int16_t(100), int16_t(6),
+                     int16_t(1000)});
   EXPECT_EQ(ndt::make_fixed_dim(8, cd), a.get_type());
   EXPECT_EQ(6, a(0).as<int>());
   EXPECT_EQ(3, a(1).as<int>());
@@ -345,11 +324,42 @@ TEST(CategoricalType, AssignFromOther)
   EXPECT_EQ(1000, a(7).as<int>());
 
   // Assignments from a few different input types
-  a(3).vals() = "1000";
+  a(3).assign("1000");
   EXPECT_EQ(1000, a(3).as<int>());
-  a(4).vals() = 6.0;
+  a(4).assign(6.0);
   EXPECT_EQ(6, a(4).as<int>());
-  a(5).vals() = (uint16_t)3;
+  a(5).assign((uint16_t)3);
   EXPECT_EQ(3, a(5).as<int>());
+
+  // From another categorical, with the same or different categories
+  nd::array b = nd::empty(2, cd);
+  b.assign(a(irange() < 2));
+  EXPECT_EQ(6, b(0).as<int>());
+  EXPECT_EQ(3, b(1).as<int>());
+  nd::array c = nd::empty(2, ndt::make_type<ndt::categorical_type>(nd::array{1000, 6, 3}));
+  c.assign(a(irange() < 2));
+  EXPECT_EQ(6, c(0).as<int>());
+  EXPECT_EQ(3, c(1).as<int>());
+  EXPECT_THROW(c(0).assign(a(2)), std::runtime_error);
+}
+
+TEST(CategoricalType, NaN) {
+  // All the NaNs are one category
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(ndt::make_type<ndt::categorical_type>(nd::array{1.0, nan, 2.0, -nan}), std::runtime_error);
+
+  ndt::type dt = ndt::make_type<ndt::categorical_type>(nd::array{nan, 2.0, -1.0, 0.5});
+  const ndt::categorical_type *cat_tp = static_cast<const ndt::categorical_type *>(dt.extended());
+  EXPECT_EQ(0u, cat_tp->get_value_from_category(nd::array(nan)));
+  EXPECT_EQ(0u, cat_tp->get_value_from_category(nd::array(-nan)));
+  EXPECT_EQ(2u, cat_tp->get_value_from_category(nd::array(-1.0)));
+  EXPECT_EQ(1u, cat_tp->get_value_from_category(nd::array(2.0)));
+
+  nd::array a = nd::empty(2, dt);
+  a.assign(nd::array{-nan, 0.5});
+  EXPECT_TRUE(std::isnan(a(0).as<double>()));
+  EXPECT_EQ(0.5, a(1).as<double>());
+
+  nd::array values = nd::array{nan, 1.0, -nan, 1.0, nan};
+  EXPECT_EQ(ndt::make_type<ndt::categorical_type>(nd::array{1.0, nan}), ndt::factor_categorical(values));
 }
-*/
@@ -122,3 +122,99 @@ TEST(FixedstringDType, Repr) {
     EXPECT_TYPE_REPR_EQ(s, ndt::type(s));
   }
 }
+
+TEST(FixedStringDType, TranscodeAsciiRuns) {
+  // Long enough for whole blocks of ASCII, with other characters between them
+  const char *strings[] = {"The quick brown fox jumps over the lazy dog, then naps in the sun",
+                           "caf\xc3\xa9 au lait and na\xc3\xafve r\xc3\xa9sum\xc3\xa9s, \xe2\x80\x94 all of them",
+                           "an emoji \xf0\x9f\x98\x80 between two long runs of plain ASCII characters", "", "x"};
+  string_encoding_t encodings[] = {string_encoding_utf_8, string_encoding_utf_16, string_encoding_utf_32};
+
+  for (const char *s : strings) {
+    nd::array a = s;
+    for (string_encoding_t src_encoding : encodings) {
+      nd::array b = nd::empty(ndt::make_type<ndt::fixed_string_type>(96, src_encoding));
+      b.assign(a);
+      EXPECT_EQ(s, b.as<std::string>());
+
+      for (string_encoding_t dst_encoding : encodings) {
+        nd::array c = nd::empty(ndt::make_type<ndt::fixed_string_type>(96, dst_encoding));
+        c.assign(b);
+        EXPECT_EQ(s, c.as<std::string>());
+      }
+    }
+  }
+
+  nd::array b = nd::empty(ndt::make_type<ndt::fixed_string_type>(96, string_encoding_ascii));
+  b.assign(strings[0]);
+  EXPECT_EQ(strings[0], b.as<std::string>());
+  EXPECT_THROW(b.assign(strings[1]), string_encode_error);
+
+  // Between UTF-16 and UTF-8, a run converts every valid character and stops
+  // at a zero or an unpaired surrogate
+  const uint16_t src[] = {'a', 'b', 'c', 0xe9, 'd', 0, 'e', 0xd800, 'f'};
+  char dst[16];
+  const char *src_it = reinterpret_cast<const char *>(src);
+  const char *src_end = reinterpret_cast<const char *>(src + 9);
+  char *dst_it = dst;
+  transcode_run_t run = get_transcode_run_function(string_encoding_utf_8, string_encoding_utf_16);
+  run(src_it, src_end, dst_it, dst + 16);
+  EXPECT_EQ(reinterpret_cast<const char *>(src + 5), src_it);
+  EXPECT_EQ("abc\xc3\xa9" "d", std::string(dst, dst_it));
+  src_it += 2;
+  run(src_it, src_end, dst_it, dst + 16);
+  EXPECT_EQ(reinterpret_cast<const char *>(src + 7), src_it);
+  EXPECT_EQ("abc\xc3\xa9" "de", std::string(dst, dst_it));
+
+  // Between other encodings, a run stops at the first character outside of
+  // ASCII
+  uint32_t dst32[8];
+  src_it = reinterpret_cast<const char *>(src);
+  dst_it = reinterpret_cast<char *>(dst32);
+  run = get_transcode_run_function(string_encoding_utf_32, string_encoding_utf_16);
+  run(src_it, src_end, dst_it, reinterpret_cast<char *>(dst32 + 8));
+  EXPECT_EQ(reinterpret_cast<const char *>(src + 3), src_it);
+  EXPECT_EQ(reinterpret_cast<char *>(dst32 + 3), dst_it);
+}
+
+TEST(FixedStringDType, TranscodeUnicodeRuns) {
+  // Long runs of one, two, three and four byte UTF-8 sequences, so the block
+  // conversions and the code point by code point ones both get used
+  std::string s;
+  for (int i = 0; i < 40; ++i) {
+    s += static_cast<char>('a' + i % 26);
+  }
+  for (uint32_t cp = 0xa0; cp < 0xa0 + 40; ++cp) {
+    s += static_cast<char>(0xc0 | (cp >> 6));
+    s += static_cast<char>(0x80 | (cp & 0x3f));
+  }
+  s += "x\xe2\x82\xac\xe2\x80\x94y\xf0\x9f\x98\x80z\xd7\x90\xd7\x91\xd7\x92";
+  for (int i = 0; i < 20; ++i) {
+    s += "\xe4\xb8\xad";
+  }
+  s += "and some ASCII to finish";
+
+  string_encoding_t encodings[] = {string_encoding_utf_8, string_encoding_utf_16, string_encoding_utf_32};
+  nd::array a = s;
+  for (string_encoding_t src_encoding : encodings) {
+    nd::array b = nd::empty(ndt::make_type<ndt::fixed_string_type>(256, src_encoding));
+    b.assign(a);
+    EXPECT_EQ(s, b.as<std::string>());
+
+    for (string_encoding_t dst_encoding : encodings) {
+      nd::array c = nd::empty(ndt::make_type<ndt::fixed_string_type>(256, dst_encoding));
+      c.assign(b);
+      EXPECT_EQ(s, c.as<std::string>());
+    }
+  }
+
+  // Invalid UTF-8 after a long valid run still raises an error
+  const char *invalid[] = {"\xc3\x28", "\xc0\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xe2\x82", "\x80"};
+  for (const char *bad : invalid) {
+    std::string t = s.substr(0, 120) + bad + "tail";
+    for (string_encoding_t dst_encoding : encodings) {
+      nd::array c = nd::empty(ndt::make_type<ndt::fixed_string_type>(256, dst_encoding));
+      EXPECT_ANY_THROW(c.assign(nd::array(t)));
+    }
+  }
+}
@@ -8,6 +8,7 @@
 #include <stdexcept>
 
 #include <dynd/array.hpp>
+#include <dynd/assignment.hpp>
 #include <dynd/json_parser.hpp>
 #include <dynd/option.hpp>
 #include <dynd/types/option_type.hpp>
@@ -91,6 +92,33 @@ TEST(OptionType, Cast) {
   EXPECT_ARRAY_EQ(nd::old_view(parse_json("3 * ?int", "[null, null, 25]"), "3 * int"), nd::old_view(b, "3 * int"));
 }
 
+TEST(OptionType, NAValues) {
+  nd::array a = parse_json("5 * string", "[\"-\", \"12\", \"n/a\", \"34\", \"\"]");
+  nd::array na_values = parse_json("3 * string", "[\"-\", \"n/a\", \"\"]");
+
+  nd::array b = nd::assign({a}, {{"dst_tp", ndt::type("5 * ?int32")}, {"na_values", na_values}});
+  EXPECT_ARRAY_EQ((nd::array{true, false, true, false, true}), nd::is_na(b));
+  EXPECT_EQ(12, b(1).as<int32_t>());
+  EXPECT_EQ(34, b(3).as<int32_t>());
+
+  b = nd::assign({a}, {{"dst_tp", ndt::type("5 * ?float64")}, {"na_values", na_values}});
+  EXPECT_ARRAY_EQ((nd::array{true, false, true, false, true}), nd::is_na(b));
+  EXPECT_EQ(34.0, b(3).as<double>());
+
+  // Given tokens replace the default ones
+  a = parse_json("2 * string", "[\"NA\", \"5\"]");
+  EXPECT_ANY_THROW(nd::assign({a}, {{"dst_tp", ndt::type("2 * ?int32")}, {"na_values", na_values}}));
+  b = nd::assign({a}, {{"dst_tp", ndt::type("2 * ?int32")}});
+  EXPECT_ARRAY_EQ((nd::array{true, false}), nd::is_na(b));
+
+  a = parse_json("4 * string", "[\"true\", \"NA\", \"no\", \"?\"]");
+  na_values = parse_json("2 * string", "[\"NA\", \"?\"]");
+  b = nd::assign({a}, {{"dst_tp", ndt::type("4 * ?bool")}, {"na_values", na_values}});
+  EXPECT_ARRAY_EQ((nd::array{false, true, false, true}), nd::is_na(b));
+  EXPECT_TRUE(b(0).as<bool>());
+  EXPECT_FALSE(b(2).as<bool>());
+}
+
 TEST(OptionType, FloatNAvsNaN) {
   nd::array a = nd::empty("3 * ?float64");
 
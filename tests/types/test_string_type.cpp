@@ -266,34 +266,98 @@ TEST(StringType, StringToInteger) {
     EXPECT_THROW(nd::array("9223372036854775808").ucast<int64_t>().eval(), runtime_error);
   */
 
-  /*
-    nd::array u8 = nd::empty(ndt::make_type<uint8_t>());
-    EXPECT_EQ(0u, u8.assign(nd::array("0")).as<uint8_t>());
-    EXPECT_EQ(255u, u8.assign(nd::array("255")).as<uint8_t>());
-    EXPECT_THROW(u8.assign(nd::array("-1")), invalid_argument);
-    EXPECT_THROW(u8.assign(nd::array("256")), out_of_range);
-
-    nd::array u16 = nd::empty(ndt::make_type<uint16_t>());
-    EXPECT_EQ(0u, u16.assign(nd::array("0")).as<uint16_t>());
-    EXPECT_EQ(65535u, u16.assign(nd::array("65535")).as<uint16_t>());
-    EXPECT_THROW(u16.assign(nd::array("-1")), invalid_argument);
-    EXPECT_THROW(u16.assign(nd::array("65536")), out_of_range);
-
-    nd::array u32 = nd::empty(ndt::make_type<uint32_t>());
-    EXPECT_EQ(0u, u32.assign(nd::array("0")).as<uint32_t>());
-    EXPECT_EQ(4294967295ULL, u32.assign(nd::array("4294967295")).as<uint32_t>());
-    EXPECT_THROW(u32.assign(nd::array("-1")), invalid_argument);
-    EXPECT_THROW(u32.assign(nd::array("4294967296")), out_of_range);
-
-    nd::array u64 = nd::empty(ndt::make_type<uint64_t>());
-    EXPECT_EQ(0u, u64.assign(nd::array("0")).as<uint64_t>());
-    EXPECT_EQ(18446744073709551615ULL, u64.assign(nd::array("18446744073709551615")).as<uint64_t>());
-    EXPECT_THROW(u64.assign(nd::array("-1")), invalid_argument);
-    EXPECT_THROW(u64.assign(nd::array("18446744073709551616")), out_of_range);
+  nd::array u8 = nd::empty(ndt::make_type<uint8_t>());
+  EXPECT_EQ(0u, u8.assign(nd::array("0")).as<uint8_t>());
+  EXPECT_EQ(255u, u8.assign(nd::array("255")).as<uint8_t>());
+  EXPECT_THROW(u8.assign(nd::array("-1")), invalid_argument);
+  EXPECT_THROW(u8.assign(nd::array("256")), out_of_range);
+
+  nd::array u16 = nd::empty(ndt::make_type<uint16_t>());
+  EXPECT_EQ(0u, u16.assign(nd::array("0")).as<uint16_t>());
+  EXPECT_EQ(65535u, u16.assign(nd::array("65535")).as<uint16_t>());
+  EXPECT_THROW(u16.assign(nd::array("-1")), invalid_argument);
+  EXPECT_THROW(u16.assign(nd::array("65536")), out_of_range);
+
+  nd::array u32 = nd::empty(ndt::make_type<uint32_t>());
+  EXPECT_EQ(0u, u32.assign(nd::array("0")).as<uint32_t>());
+  EXPECT_EQ(4294967295ULL, u32.assign(nd::array("4294967295")).as<uint32_t>());
+  EXPECT_THROW(u32.assign(nd::array("-1")), invalid_argument);
+  EXPECT_THROW(u32.assign(nd::array("4294967296")), out_of_range);
+
+  nd::array u64 = nd::empty(ndt::make_type<uint64_t>());
+  EXPECT_EQ(0u, u64.assign(nd::array("0")).as<uint64_t>());
+  EXPECT_EQ(18446744073709551615ULL, u64.assign(nd::array("18446744073709551615")).as<uint64_t>());
+  EXPECT_THROW(u64.assign(nd::array("-1")), invalid_argument);
+  EXPECT_THROW(u64.assign(nd::array("18446744073709551616")), out_of_range);
 
   EXPECT_THROW(u64.assign(nd::array("")), invalid_argument);
   EXPECT_THROW(u64.assign(nd::array("-")), invalid_argument);
-  */
+}
+
+TEST(StringType, StringToFloat) {
+  nd::array f64 = nd::empty(ndt::make_type<double>());
+  EXPECT_EQ(0.1, f64.assign(nd::array("0.1")).as<double>());
+  EXPECT_EQ(-2.5e-3, f64.assign(nd::array("  -2.5e-3 ")).as<double>());
+  EXPECT_EQ(1e23, f64.assign(nd::array("1e23")).as<double>());
+  EXPECT_ANY_THROW(f64.assign(nd::array("1.5x")));
+
+  nd::array f32 = nd::empty(ndt::make_type<float>());
+  EXPECT_EQ(0.1f, f32.assign(nd::array("0.1")).as<float>());
+  EXPECT_EQ(3.14159f, f32.assign(nd::array(" 3.14159")).as<float>());
+
+  nd::array i32 = nd::empty(ndt::make_type<int32_t>());
+  EXPECT_EQ(-12345678, i32.assign(nd::array(" -12345678 ")).as<int32_t>());
+}
+
+TEST(StringType, StridedStringToNumber) {
+  nd::array a = parse_json("6 * string", "[\"0\", \" 12 \", \"-7\", \"123456789012\", \"42\", \"-1\"]");
+  nd::array b = nd::empty("6 * int64");
+  b.vals() = a;
+  EXPECT_ARRAY_EQ((nd::array{0LL, 12LL, -7LL, 123456789012LL, 42LL, -1LL}), b);
+
+  a = parse_json("4 * string", "[\"0\", \"255\", \" 18446744073709551615\", \"7\"]");
+  b = nd::empty("4 * uint64");
+  b.vals() = a;
+  EXPECT_ARRAY_EQ((nd::array{0ULL, 255ULL, 18446744073709551615ULL, 7ULL}), b);
+  b = nd::empty("4 * uint8");
+  EXPECT_THROW(b.vals() = a, out_of_range);
+
+  // Overflow raises the same error whether one element or a whole stride is converted
+  a = parse_json("3 * string", "[\"1\", \" 300 \", \"2\"]");
+  b = nd::empty("3 * int8");
+  std::string strided_message, single_message;
+  try {
+    b.vals() = a;
+  } catch (const overflow_error &e) {
+    strided_message = e.what();
+  }
+  nd::array c = nd::empty("int8");
+  try {
+    c.vals() = a(1);
+  } catch (const overflow_error &e) {
+    single_message = e.what();
+  }
+  EXPECT_EQ("overflow converting string 300 to int8", strided_message);
+  EXPECT_EQ(strided_message, single_message);
+
+  a = parse_json("5 * string", "[\"0.1\", \" -2.5e-3\", \"1e23\", \"3\", \"0.3333333333333333\"]");
+  b = nd::empty("5 * float64");
+  b.vals() = a;
+  EXPECT_ARRAY_EQ((nd::array{0.1, -2.5e-3, 1e23, 3.0, 0.3333333333333333}), b);
+  b = nd::empty("5 * float32");
+  b.vals() = a;
+  EXPECT_ARRAY_EQ((nd::array{0.1f, -2.5e-3f, 1e23f, 3.0f, 0.3333333333333333f}), b);
+
+  a = parse_json("4 * string", "[\"true\", \" no\", \"1\", \"off\"]");
+  b = nd::empty("4 * bool");
+  b.vals() = a;
+  EXPECT_ARRAY_EQ((nd::array{true, false, true, false}), b);
+
+  // Other string types are converted to UTF-8 first
+  a = parse_json("3 * fixed_string[8, 'utf16']", "[\"5\", \" -6\", \"70\"]");
+  b = nd::empty("3 * int32");
+  b.vals() = a;
+  EXPECT_ARRAY_EQ((nd::array{5, -6, 70}), b);
 }
 
 TEST(StringType, Comparisons) {
@@ -161,6 +161,23 @@ TEST(Type, BasicConstructor) {
   EXPECT_EQ(d, ndt::type(d.str()));
 }
 
+TEST(Type, StringConstructorShared) {
+  // Types constructed from the same string share one base_type
+  ndt::type a("Fixed * {x: float64, y: ?int32}");
+  ndt::type b("Fixed * {x: float64, y: ?int32}");
+  EXPECT_EQ(a.get(), b.get());
+
+  // So do types spelled differently
+  ndt::type c("Fixed*{x:float64,y:?int32}");
+  EXPECT_EQ(a.get(), c.get());
+  EXPECT_EQ(a, c);
+
+  EXPECT_NE(a.get(), ndt::type("Fixed * {x: float64, y: ?int64}").get());
+  // Failed parses are not cached
+  EXPECT_THROW(ndt::type("Fixed * int33"), type_error);
+  EXPECT_THROW(ndt::type("Fixed * int33"), type_error);
+}
+
 TEST(TypeFor, InitializerList) {
   EXPECT_EQ(ndt::make_type<ndt::fixed_dim_type>(1, ndt::make_type<int>()), ndt::type_for({0}));
   EXPECT_EQ(ndt::make_type<ndt::fixed_dim_type>(2, ndt::make_type<int>()), ndt::type_for({10, -2}));
@@ -10,6 +10,7 @@
 #include <dynd/types/categorical_type.hpp>
 #include <dynd/types/fixed_string_type.hpp>
 #include <dynd/types/pow_dimsym_type.hpp>
+#include <dynd/types/type_pattern.hpp>
 #include <dynd/gtest.hpp>
 
 using namespace std;
@@ -233,7 +234,7 @@ TEST(TypePatternMatch, TypeVarConstructed) {
 
 TEST(TypePatternMatch, Broadcast) {
   // Confirm that "T..." type variables broadcast together as they match
-  std::map<std::string, ndt::type> tp_vars;
+  ndt::typevar_map tp_vars;
   EXPECT_TRUE(ndt::type("Dims... * int32").match(ndt::type("3 * 1 * int32"), tp_vars));
   EXPECT_TRUE(ndt::type("Dims... * float32").match(ndt::type("1 * 2 * float32"), tp_vars));
   EXPECT_EQ(ndt::type("3 * 2 * bool"), ndt::substitute(ndt::type("Dims... * bool"), tp_vars, true));
@@ -252,3 +253,66 @@ TEST(TypePatternMatch, TypeVar) {
   EXPECT_TYPE_MATCH("(S,T)->T", "(T,T)->T");
   EXPECT_FALSE(ndt::type("(T,T)->T").match(ndt::type("(S,T)->T")));
 }
+
+TEST(TypePatternMatch, TypeVarMap) {
+  ndt::typevar_map tp_vars;
+  EXPECT_TRUE(tp_vars.empty());
+
+  // More typevars than fit inline, with earlier bindings staying in place
+  const char *names[] = {"A", "B", "C", "D", "E", "F"};
+  ndt::type &a = tp_vars["A"];
+  for (const char *name : names) {
+    tp_vars[name] = ndt::type(std::string("Fixed * ") + name);
+  }
+  EXPECT_EQ(&a, &tp_vars["A"]);
+  EXPECT_EQ(6u, tp_vars.size());
+  EXPECT_EQ(1u, tp_vars.count("F"));
+  EXPECT_EQ(0u, tp_vars.count("G"));
+  EXPECT_EQ(ndt::type("Fixed * E"), tp_vars.find("E")->second);
+
+  // Bindings are kept in the order they were made
+  ndt::typevar_map copied = tp_vars;
+  size_t i = 0;
+  for (const auto &tp_var : copied) {
+    EXPECT_EQ(names[i++], tp_var.first);
+  }
+  EXPECT_EQ(6u, i);
+
+  tp_vars.clear();
+  EXPECT_TRUE(tp_vars.empty());
+  EXPECT_TRUE(tp_vars.find("A") == tp_vars.end());
+  EXPECT_EQ(ndt::type("Fixed * F"), copied["F"]);
+
+  ndt::typevar_map listed{{"T", ndt::type("int32")}, {"N", ndt::type("3 * void")}};
+  EXPECT_EQ(ndt::type("3 * 3 * int32"), ndt::substitute(ndt::type("N * 3 * T"), listed, true));
+}
+
+TEST(TypePatternMatch, Compiled) {
+  const char *patterns[] = {"Any",           "Scalar",           "Int",          "UInt",          "Float",
+                            "Complex",       "Bool",             "int32",        "string",        "T",
+                            "Dim * int32",   "Dim * Any",        "Dim * Dim * Scalar",            "Fixed * Any",
+                            "Fixed * Fixed * T",                 "3 * Scalar",   "3 * int32",     "var * Float",
+                            "?int32",        "?Int",             "Fixed * ?Scalar",               "Dims... * int32",
+                            "N * T",         "(int32, T)",       "Fixed * (T, T)", "var * 3 * Any"};
+  const char *candidates[] = {"int32",          "uint8",         "float64",        "bool",
+                              "complex[float64]", "string",      "3 * int32",      "4 * int32",
+                              "3 * 4 * float64", "var * float32", "var * 3 * int32", "?int32",
+                              "?float64",       "3 * ?int32",    "(int32, float64)", "(int32, int32)",
+                              "2 * (int32, int32)", "Fixed * int32", "Any",
+                              "Scalar",         "Int",           "?Int"};
+
+  for (const char *pattern : patterns) {
+    ndt::type pattern_tp(pattern);
+    ndt::type_pattern compiled(pattern_tp);
+    EXPECT_EQ(pattern_tp, compiled.get_type());
+    for (const char *candidate : candidates) {
+      ndt::type candidate_tp(candidate);
+      EXPECT_EQ(pattern_tp.match(candidate_tp), compiled.match(candidate_tp)) << pattern << " against " << candidate;
+    }
+  }
+
+  EXPECT_TRUE(ndt::type_pattern(ndt::type("Fixed * Fixed * Scalar")).match(ndt::type("3 * 4 * float64")));
+  EXPECT_FALSE(ndt::type_pattern(ndt::type("Fixed * Fixed * Scalar")).match(ndt::type("3 * var * float64")));
+  EXPECT_TRUE(ndt::type_pattern(ndt::type("var * ?Int")).match(ndt::type("var * ?int16")));
+  EXPECT_FALSE(ndt::type_pattern(ndt::type("var * ?Int")).match(ndt::type("var * ?float32")));
+}
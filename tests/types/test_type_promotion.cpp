@@ -6,9 +6,10 @@
 #include <iostream>
 #include <stdexcept>
 #include <cmath>
-#include "inc_gtest.hpp"
+#include <dynd/gtest.hpp>
 
 #include "dynd/type_promotion.hpp"
+#include "dynd/types/option_type.hpp"
 
 using namespace std;
 using namespace dynd;
@@ -97,3 +98,14 @@ TEST(DTypePromotion, ComplexWithComplex) {
     EXPECT_EQ(promote_types_arithmetic(ndt::make_type<dynd::complex<double> >(), ndt::make_type<dynd::complex<float> >()), ndt::make_type<dynd::complex<double> >());
     EXPECT_EQ(promote_types_arithmetic(ndt::make_type<dynd::complex<double> >(), ndt::make_type<dynd::complex<double> >()), ndt::make_type<dynd::complex<double> >());
 }
+
+TEST(DTypePromotion, VoidAndWide) {
+    EXPECT_EQ(ndt::make_type<int32_t>(), promote_types_arithmetic(ndt::make_type<void>(), ndt::make_type<int32_t>()));
+    EXPECT_EQ(ndt::make_type<int32_t>(), promote_types_arithmetic(ndt::make_type<int32_t>(), ndt::make_type<void>()));
+    EXPECT_EQ(ndt::make_type<float>(), promote_types_arithmetic(ndt::make_type<int8_t>(), ndt::make_type<float16>()));
+    EXPECT_EQ(ndt::make_type<float>(), promote_types_arithmetic(ndt::make_type<float16>(), ndt::make_type<float16>()));
+    EXPECT_EQ(ndt::make_type<int128>(), promote_types_arithmetic(ndt::make_type<int128>(), ndt::make_type<uint64_t>()));
+    EXPECT_EQ(ndt::make_type<uint128>(), promote_types_arithmetic(ndt::make_type<int128>(), ndt::make_type<uint128>()));
+    EXPECT_EQ(ndt::make_type<ndt::option_type>(ndt::make_type<int64_t>()),
+              promote_types_arithmetic(ndt::make_type<ndt::option_type>(ndt::make_type<int16_t>()), ndt::make_type<int64_t>()));
+}
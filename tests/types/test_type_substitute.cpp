@@ -18,7 +18,7 @@ using namespace dynd;
 TEST(SubstituteTypeVars, SimpleNoSubstitutions) {
 // SimpleNoSubstitutions is segfaulting on Mac OS X
 #ifndef __APPLE__
-  map<std::string, ndt::type> typevars;
+  ndt::typevar_map typevars;
   EXPECT_EQ(ndt::type("int32"), ndt::substitute(ndt::type("int32"), typevars, false));
   EXPECT_EQ(ndt::type("int32"), ndt::substitute(ndt::type("int32"), typevars, true));
   EXPECT_EQ(ndt::type("T"), ndt::substitute(ndt::type("T"), typevars, false));
@@ -31,7 +31,7 @@ TEST(SubstituteTypeVars, SimpleNoSubstitutions) {
 TEST(SubstituteTypeVars, SimpleSubstitution) {
 // SimpleSubstitution is segfaulting on Mac OS X
 #ifndef __APPLE__
-  map<std::string, ndt::type> typevars;
+  ndt::typevar_map typevars;
   typevars["Tint"] = ndt::type("int32");
   typevars["Tsym"] = ndt::type("S");
   typevars["Mfixed_sym"] = ndt::type("Fixed * void");
@@ -91,7 +91,7 @@ TEST(SubstituteTypeVars, SimpleSubstitution) {
 }
 
 TEST(SubstituteTypeVars, Tuple) {
-  map<std::string, ndt::type> typevars;
+  ndt::typevar_map typevars;
   typevars["T"] = ndt::type("int32");
   typevars["M"] = ndt::type("3 * void");
   typevars["A"] = ndt::make_dim_fragment(3, ndt::type("var * Fixed * 4 * void"));
@@ -108,7 +108,7 @@ TEST(SubstituteTypeVars, Tuple) {
 }
 
 TEST(SubstituteTypeVars, Struct) {
-  map<std::string, ndt::type> typevars;
+  ndt::typevar_map typevars;
   typevars["T"] = ndt::type("int32");
   typevars["M"] = ndt::type("3 * void");
   typevars["A"] = ndt::make_dim_fragment(3, ndt::type("var * Fixed * 4 * void"));
@@ -125,7 +125,7 @@ TEST(SubstituteTypeVars, Struct) {
 }
 
 TEST(SubstituteTypeVars, FuncProto) {
-  map<std::string, ndt::type> typevars;
+  ndt::typevar_map typevars;
   typevars["T"] = ndt::type("int32");
   typevars["M"] = ndt::type("3 * void");
   typevars["A"] = ndt::make_dim_fragment(3, ndt::type("var * 4 * 9 * void"));